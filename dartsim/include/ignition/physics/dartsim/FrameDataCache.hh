@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_DARTSIM_FRAMEDATACACHE_HH_
+#define IGNITION_PHYSICS_DARTSIM_FRAMEDATACACHE_HH_
+
+#include <cstddef>
+
+#include <ignition/physics/FeatureList.hh>
+
+namespace ignition {
+namespace physics {
+namespace dartsim {
+
+/////////////////////////////////////////////////
+/// \brief Number of frame data requests that were answered from the cache
+/// of FrameDataCacheFeature, and number that had to be computed.
+struct FrameDataCacheStatistics
+{
+  std::size_t hits = 0;
+  std::size_t misses = 0;
+};
+
+/////////////////////////////////////////////////
+/// \brief FrameDataCacheFeature remembers the frame data of links, models and
+/// shapes relative to the world, so that resolving several quantities against
+/// the same frames does not query dartsim each time.
+///
+/// The cache is shared by every world of the engine. It is emptied by each
+/// step, and by every feature that writes a pose, a velocity, an acceleration
+/// or a joint state, or that changes the structure of a model. The cache is
+/// off by default. It is locked while it is read or written, so frame data can
+/// still be queried from several threads at once.
+class FrameDataCacheFeature : public virtual Feature
+{
+  public: template <typename PolicyT, typename FeaturesT>
+  class Engine : public virtual Feature::Engine<PolicyT, FeaturesT>
+  {
+    /// \brief Turn the frame data cache on or off. Turning it off empties it.
+    /// \param[in] _enable True to cache frame data, false to compute it for
+    /// every request
+    public: void EnableFrameDataCache(bool _enable);
+
+    /// \brief Check whether frame data is cached.
+    public: bool FrameDataCacheEnabled() const;
+
+    /// \brief Get the number of hits and misses of the cache since the engine
+    /// was loaded, or since the statistics were last reset.
+    public: FrameDataCacheStatistics GetFrameDataCacheStatistics() const;
+
+    /// \brief Restart the count of hits and misses from zero.
+    public: void ResetFrameDataCacheStatistics();
+  };
+
+  public: template <typename PolicyT>
+  class Implementation : public virtual Feature::Implementation<PolicyT>
+  {
+    public: virtual void SetFrameDataCacheEnabled(
+        const Identity &_engineID, bool _enable) = 0;
+
+    public: virtual bool GetFrameDataCacheEnabled(
+        const Identity &_engineID) const = 0;
+
+    public: virtual FrameDataCacheStatistics GetFrameDataCacheStatistics(
+        const Identity &_engineID) const = 0;
+
+    public: virtual void ResetFrameDataCacheStatistics(
+        const Identity &_engineID) = 0;
+  };
+};
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+void FrameDataCacheFeature::Engine<PolicyT, FeaturesT>::EnableFrameDataCache(
+    bool _enable)
+{
+  this->template Interface<FrameDataCacheFeature>()
+      ->SetFrameDataCacheEnabled(this->identity, _enable);
+}
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+bool FrameDataCacheFeature::Engine<PolicyT, FeaturesT>
+::FrameDataCacheEnabled() const
+{
+  return this->template Interface<FrameDataCacheFeature>()
+      ->GetFrameDataCacheEnabled(this->identity);
+}
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+FrameDataCacheStatistics FrameDataCacheFeature::Engine<PolicyT, FeaturesT>
+::GetFrameDataCacheStatistics() const
+{
+  return this->template Interface<FrameDataCacheFeature>()
+      ->GetFrameDataCacheStatistics(this->identity);
+}
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+void FrameDataCacheFeature::Engine<PolicyT, FeaturesT>
+::ResetFrameDataCacheStatistics()
+{
+  this->template Interface<FrameDataCacheFeature>()
+      ->ResetFrameDataCacheStatistics(this->identity);
+}
+
+}
+}
+}
+
+#endif
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_DARTSIM_KINEMATIC_HH_
+#define IGNITION_PHYSICS_DARTSIM_KINEMATIC_HH_
+
+#include <ignition/physics/FeatureList.hh>
+
+namespace ignition {
+namespace physics {
+namespace dartsim {
+
+/////////////////////////////////////////////////
+/// \brief KinematicModelFeature switches a model between dynamic and
+/// kinematic mode at runtime, without rebuilding it.
+///
+/// A kinematic model is left out of forward dynamics and constraint solving.
+/// At each step its joint positions are integrated from its current joint
+/// velocities, which keep the values that a feature last set on them. There
+/// is no support for prescribing a trajectory: to move a kinematic model
+/// along a path, set its velocities or positions before each step. Other
+/// models still collide with it as if it had infinite mass. Kinematic models
+/// suit scripted objects such as doors and conveyors.
+class KinematicModelFeature : public virtual Feature
+{
+  public: template <typename PolicyT, typename FeaturesT>
+  class Model : public virtual Feature::Model<PolicyT, FeaturesT>
+  {
+    /// \brief Switch this model to kinematic or dynamic mode. Switching
+    /// back to dynamic mode restores the mobility that the model had before,
+    /// so a static model stays static.
+    /// \param[in] _kinematic True for kinematic mode, false for dynamic mode
+    public: void SetKinematic(bool _kinematic);
+
+    /// \brief Check whether this model is in kinematic mode.
+    public: bool IsKinematic() const;
+  };
+
+  public: template <typename PolicyT>
+  class Implementation : public virtual Feature::Implementation<PolicyT>
+  {
+    public: virtual void SetModelKinematic(
+        const Identity &_modelID, bool _kinematic) = 0;
+
+    public: virtual bool ModelIsKinematic(const Identity &_modelID) const = 0;
+  };
+};
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+void KinematicModelFeature::Model<PolicyT, FeaturesT>::SetKinematic(
+    bool _kinematic)
+{
+  this->template Interface<KinematicModelFeature>()->SetModelKinematic(
+      this->identity, _kinematic);
+}
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+bool KinematicModelFeature::Model<PolicyT, FeaturesT>::IsKinematic() const
+{
+  return this->template Interface<KinematicModelFeature>()->ModelIsKinematic(
+      this->identity);
+}
+
+}
+}
+}
+
+#endif
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_DARTSIM_PHYSICSONLYLOAD_HH_
+#define IGNITION_PHYSICS_DARTSIM_PHYSICSONLYLOAD_HH_
+
+#include <ignition/physics/FeatureList.hh>
+
+namespace ignition {
+namespace physics {
+namespace dartsim {
+
+/////////////////////////////////////////////////
+/// \brief When this is turned on, the engine only builds what simulation
+/// needs. ConstructSdfVisual returns an invalid identity without loading the
+/// geometry of the visual, so visual meshes are never read or converted.
+///
+/// Links, collisions, inertia and joints are constructed the same way in
+/// both modes, so simulation results do not change.
+class PhysicsOnlyLoadFeature : public virtual Feature
+{
+  public: template <typename PolicyT, typename FeaturesT>
+  class Engine : public virtual Feature::Engine<PolicyT, FeaturesT>
+  {
+    /// \brief Set whether visuals constructed after this call should be
+    /// skipped. This is off by default.
+    /// \param[in] _physicsOnly True to skip visuals
+    public: void SetPhysicsOnlyLoad(bool _physicsOnly);
+
+    /// \brief Get whether visuals are skipped.
+    public: bool GetPhysicsOnlyLoad() const;
+  };
+
+  public: template <typename PolicyT>
+  class Implementation : public virtual Feature::Implementation<PolicyT>
+  {
+    public: virtual void SetPhysicsOnlyLoad(
+        const Identity &_engineID, bool _physicsOnly) = 0;
+
+    public: virtual bool GetPhysicsOnlyLoad(
+        const Identity &_engineID) const = 0;
+  };
+};
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+void PhysicsOnlyLoadFeature::Engine<PolicyT, FeaturesT>::SetPhysicsOnlyLoad(
+    bool _physicsOnly)
+{
+  this->template Interface<PhysicsOnlyLoadFeature>()
+      ->SetPhysicsOnlyLoad(this->identity, _physicsOnly);
+}
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+bool PhysicsOnlyLoadFeature::Engine<PolicyT, FeaturesT>::GetPhysicsOnlyLoad()
+    const
+{
+  return this->template Interface<PhysicsOnlyLoadFeature>()
+      ->GetPhysicsOnlyLoad(this->identity);
+}
+
+}
+}
+}
+
+#endif
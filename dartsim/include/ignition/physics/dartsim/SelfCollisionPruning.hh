@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_DARTSIM_SELFCOLLISIONPRUNING_HH_
+#define IGNITION_PHYSICS_DARTSIM_SELFCOLLISIONPRUNING_HH_
+
+#include <string>
+
+#include <ignition/physics/FeatureList.hh>
+
+namespace ignition {
+namespace physics {
+namespace dartsim {
+
+/////////////////////////////////////////////////
+/// \brief SelfCollisionPruningFeature finds the pairs of links of a
+/// self-colliding model that never touch, by sampling the joint space of the
+/// model within its joint limits, and removes those pairs from collision
+/// checking. Adjacent links are already skipped by dartsim.
+///
+/// Sampling can be slow for models with many links, so the result can be
+/// cached on disk. Cache files are named after a hash of the model's
+/// structure, joint limits and collision geometry, so a model that changes
+/// is sampled again.
+///
+/// Attaching a shape to a pruned model clears its pruning, since the new
+/// shape was not part of the sampling. Call PruneSelfCollisions again to
+/// prune the model with the new shape.
+class SelfCollisionPruningFeature : public virtual Feature
+{
+  public: template <typename PolicyT, typename FeaturesT>
+  class Engine : public virtual Feature::Engine<PolicyT, FeaturesT>
+  {
+    /// \brief Prune the self-collision pairs of every self-colliding model
+    /// that is constructed from SDF after this call.
+    /// \param[in] _samples Number of joint configurations to sample for each
+    /// model. Zero turns pruning at load time off, which is the default.
+    /// Sampling can miss configurations where two links touch, and those
+    /// links will then pass through each other. Use more samples for models
+    /// whose links only touch in a small part of their joint space.
+    /// \param[in] _cacheDirectory Directory to read and write cached results.
+    /// Nothing is cached if this is empty.
+    public: void SetSelfCollisionPruning(
+        std::size_t _samples, const std::string &_cacheDirectory = "");
+  };
+
+  public: template <typename PolicyT, typename FeaturesT>
+  class Model : public virtual Feature::Model<PolicyT, FeaturesT>
+  {
+    /// \brief Prune the self-collision pairs of this model now. This uses
+    /// the cache directory of the engine.
+    /// \param[in] _samples Number of joint configurations to sample. Link
+    /// pairs that only touch in configurations that were not sampled are
+    /// pruned too, so too few samples let links pass through each other.
+    /// \return Number of link pairs that will no longer be checked
+    public: std::size_t PruneSelfCollisions(std::size_t _samples);
+  };
+
+  public: template <typename PolicyT>
+  class Implementation : public virtual Feature::Implementation<PolicyT>
+  {
+    public: virtual void SetSelfCollisionPruning(
+        const Identity &_engineID, std::size_t _samples,
+        const std::string &_cacheDirectory) = 0;
+
+    public: virtual std::size_t PruneSelfCollisions(
+        const Identity &_modelID, std::size_t _samples) = 0;
+  };
+};
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+void SelfCollisionPruningFeature::Engine<PolicyT, FeaturesT>
+::SetSelfCollisionPruning(
+    std::size_t _samples, const std::string &_cacheDirectory)
+{
+  this->template Interface<SelfCollisionPruningFeature>()
+      ->SetSelfCollisionPruning(this->identity, _samples, _cacheDirectory);
+}
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+std::size_t SelfCollisionPruningFeature::Model<PolicyT, FeaturesT>
+::PruneSelfCollisions(std::size_t _samples)
+{
+  return this->template Interface<SelfCollisionPruningFeature>()
+      ->PruneSelfCollisions(this->identity, _samples);
+}
+
+}
+}
+}
+
+#endif
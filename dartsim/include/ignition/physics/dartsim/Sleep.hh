@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_DARTSIM_SLEEP_HH_
+#define IGNITION_PHYSICS_DARTSIM_SLEEP_HH_
+
+#include <ignition/physics/FeatureList.hh>
+
+namespace ignition {
+namespace physics {
+namespace dartsim {
+
+/////////////////////////////////////////////////
+/// \brief SleepFeature lets a world stop simulating models that have come to
+/// rest. A model that stays below the velocity thresholds for a number of
+/// consecutive steps is made immobile, so dartsim neither integrates it nor
+/// solves its dynamics, while other models can still rest on it.
+///
+/// A sleeping model wakes up when a model that is moving touches it, or when
+/// a feature applies a force to it or writes its pose, joint state or
+/// velocity. Static models are never put to sleep.
+///
+/// While sleeping is enabled, each step writes a SleepStatistics entry to the
+/// ForwardStep::Output.
+class SleepFeature : public virtual Feature
+{
+  public: template <typename PolicyT, typename FeaturesT>
+  class World : public virtual Feature::World<PolicyT, FeaturesT>
+  {
+    /// \brief Start putting resting models of this world to sleep.
+    /// \param[in] _linearThreshold A model is resting while every one of its
+    /// links moves slower than this linear speed
+    /// \param[in] _angularThreshold A model is resting while every one of its
+    /// links turns slower than this angular speed
+    /// \param[in] _steps Number of consecutive resting steps before a model
+    /// falls asleep
+    public: void EnableSleeping(
+        double _linearThreshold, double _angularThreshold, std::size_t _steps);
+
+    /// \brief Stop putting models of this world to sleep, and wake every
+    /// model that is currently asleep.
+    public: void DisableSleeping();
+  };
+
+  public: template <typename PolicyT, typename FeaturesT>
+  class Model : public virtual Feature::Model<PolicyT, FeaturesT>
+  {
+    /// \brief Check whether this model is asleep.
+    public: bool IsAsleep() const;
+  };
+
+  public: template <typename PolicyT>
+  class Implementation : public virtual Feature::Implementation<PolicyT>
+  {
+    public: virtual void EnableWorldSleeping(
+        const Identity &_worldID, double _linearThreshold,
+        double _angularThreshold, std::size_t _steps) = 0;
+
+    public: virtual void DisableWorldSleeping(const Identity &_worldID) = 0;
+
+    public: virtual bool ModelIsAsleep(const Identity &_modelID) const = 0;
+  };
+};
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+void SleepFeature::World<PolicyT, FeaturesT>::EnableSleeping(
+    double _linearThreshold, double _angularThreshold, std::size_t _steps)
+{
+  this->template Interface<SleepFeature>()->EnableWorldSleeping(
+      this->identity, _linearThreshold, _angularThreshold, _steps);
+}
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+void SleepFeature::World<PolicyT, FeaturesT>::DisableSleeping()
+{
+  this->template Interface<SleepFeature>()->DisableWorldSleeping(
+      this->identity);
+}
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+bool SleepFeature::Model<PolicyT, FeaturesT>::IsAsleep() const
+{
+  return this->template Interface<SleepFeature>()->ModelIsAsleep(
+      this->identity);
+}
+
+}
+}
+}
+
+#endif
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_DARTSIM_WELDFIXEDJOINTS_HH_
+#define IGNITION_PHYSICS_DARTSIM_WELDFIXEDJOINTS_HH_
+
+#include <ignition/physics/FeatureList.hh>
+
+namespace ignition {
+namespace physics {
+namespace dartsim {
+
+/////////////////////////////////////////////////
+/// \brief When this is turned on, links of an SDF model that are connected to
+/// another link of the same model by a fixed joint are merged into the
+/// BodyNode of that link instead of getting a BodyNode and a WeldJoint of
+/// their own. The merged BodyNode carries the combined inertia and the
+/// collision shapes of every link that was welded into it.
+///
+/// Welded links keep their own Link identities. Frame queries on them, such
+/// as FrameDataRelativeToWorld, report the pose of the link itself. Other
+/// link operations, such as applying forces or attaching shapes, act on the
+/// BodyNode that the link was welded into. The fixed joints that were
+/// replaced by welding are not available as Joint entities.
+class WeldFixedJointsFeature : public virtual Feature
+{
+  public: template <typename PolicyT, typename FeaturesT>
+  class Engine : public virtual Feature::Engine<PolicyT, FeaturesT>
+  {
+    /// \brief Set whether models constructed from SDF after this call
+    /// should have their fixed-joint link chains welded into single bodies.
+    /// This is off by default.
+    /// \param[in] _weld True to weld fixed joints at load time
+    public: void SetWeldFixedJoints(bool _weld);
+
+    /// \brief Get whether fixed joints are welded at load time.
+    public: bool GetWeldFixedJoints() const;
+  };
+
+  public: template <typename PolicyT>
+  class Implementation : public virtual Feature::Implementation<PolicyT>
+  {
+    public: virtual void SetWeldFixedJoints(
+        const Identity &_engineID, bool _weld) = 0;
+
+    public: virtual bool GetWeldFixedJoints(
+        const Identity &_engineID) const = 0;
+  };
+};
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+void WeldFixedJointsFeature::Engine<PolicyT, FeaturesT>::SetWeldFixedJoints(
+    bool _weld)
+{
+  this->template Interface<WeldFixedJointsFeature>()
+      ->SetWeldFixedJoints(this->identity, _weld);
+}
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+bool WeldFixedJointsFeature::Engine<PolicyT, FeaturesT>::GetWeldFixedJoints()
+    const
+{
+  return this->template Interface<WeldFixedJointsFeature>()
+      ->GetWeldFixedJoints(this->identity);
+}
+
+}
+}
+}
+
+#endif
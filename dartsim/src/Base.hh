@@ -19,11 +19,13 @@
 #define IGNITION_PHYSICS_DARTSIM_BASE_HH_
 
 #include <dart/dynamics/BodyNode.hpp>
+#include <dart/dynamics/Joint.hpp>
 #include <dart/dynamics/SimpleFrame.hpp>
 #include <dart/dynamics/Skeleton.hpp>
 #include <dart/simulation/World.hpp>
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -31,8 +33,13 @@
 #include <vector>
 
 #include <ignition/common/Console.hh>
+#include <ignition/physics/ChangedWorldPoses.hh>
+#include <ignition/physics/FrameData.hh>
 #include <ignition/physics/Implements.hh>
 
+#include "CustomMeshShape.hh"
+#include "SelfCollisionMatrix.hh"
+
 namespace ignition {
 namespace physics {
 namespace dartsim {
@@ -52,6 +59,30 @@ struct ModelInfo
   dart::dynamics::SkeletonPtr model;
   dart::dynamics::SimpleFramePtr frame;
   std::string canonicalLinkName;
+
+  /// \brief IDs of the links of this model that were welded into the
+  /// BodyNode of another link. These links have no BodyNode of their own, so
+  /// they cannot be found by traversing the skeleton.
+  std::vector<std::size_t> weldedLinks;
+
+  /// \brief Number of consecutive steps that this model has been resting
+  std::size_t restingSteps = 0;
+
+  /// \brief True if this model was made immobile because it came to rest
+  bool asleep = false;
+
+  /// \brief True if this model was made immobile so that its motion is
+  /// prescribed rather than simulated
+  bool kinematic = false;
+
+  /// \brief Whether the skeleton was mobile when kinematic mode was turned
+  /// on, so that turning it off leaves a static model static
+  bool mobileBeforeKinematic = true;
+
+  /// \brief Link pairs of this model that are skipped by self-collision
+  /// checking, or nullptr if the model was not pruned. The collision filter
+  /// of the world shares this matrix.
+  std::shared_ptr<SelfCollisionMatrix> selfCollision;
 };
 
 struct LinkInfo
@@ -61,6 +92,11 @@ struct LinkInfo
   /// moving the BodyNode to a new skeleton), so we store the Gazebo-specified
   /// name of the Link here.
   std::string name;
+
+  /// \brief If this link was welded into the BodyNode of another link, this
+  /// frame is attached to that BodyNode at the pose of this link. Otherwise it
+  /// is a nullptr and the pose of the link is the pose of the BodyNode.
+  dart::dynamics::SimpleFramePtr weldFrame;
 };
 
 struct JointInfo
@@ -83,6 +119,104 @@ struct ShapeInfo
   /// where T_g is the relative transform according to Gazebo and T_d is the
   /// relative transform according to dartsim.
   Eigen::Isometry3d tf_offset = Eigen::Isometry3d::Identity();
+
+  /// \brief The weldFrame of the link that this shape belongs to, if that
+  /// link was welded into the BodyNode of another link. Otherwise it is a
+  /// nullptr and the shape belongs to the link that owns the BodyNode.
+  dart::dynamics::SimpleFrame *weldFrame = nullptr;
+};
+
+/// \brief Get the name of the ShapeNode of a shape of a link. dartsim requires
+/// ShapeNode names to be unique per Skeleton, so the name of the link's
+/// frame is prepended to the name of the shape.
+inline std::string ShapeNodeName(
+    const LinkInfo &_link, const std::string &_shapeName)
+{
+  return (_link.weldFrame ?
+            _link.weldFrame->getName() : _link.link->getName())
+      + ":" + _shapeName;
+}
+
+/// \brief Get the pose of a welded link relative to its BodyNode. Links that
+/// were not welded share the frame of their BodyNode.
+/// \param[in] _weldFrame The weldFrame of the link, which may be a nullptr
+inline Eigen::Isometry3d WeldOffset(
+    const dart::dynamics::SimpleFrame *_weldFrame)
+{
+  return _weldFrame ?
+      _weldFrame->getRelativeTransform() : Eigen::Isometry3d::Identity();
+}
+
+/// \brief The generalized state of a skeleton that is written back to it when
+/// its world is reset. The skeleton is held weakly so that capturing a reset
+/// state does not keep removed models alive.
+struct SkeletonResetState
+{
+  std::weak_ptr<dart::dynamics::Skeleton> model;
+  Eigen::VectorXd positions;
+  Eigen::VectorXd velocities;
+  Eigen::VectorXd accelerations;
+  Eigen::VectorXd forces;
+  Eigen::VectorXd commands;
+  std::vector<dart::dynamics::Joint::ActuatorType> actuatorTypes;
+};
+
+/// \brief Settings for putting the resting models of a world to sleep, and
+/// the number of models that fell asleep or woke up since the last step.
+struct WorldSleepState
+{
+  /// \brief A model is resting while the linear speed of each of its bodies
+  /// is at most this value
+  double linearThreshold = 0.0;
+
+  /// \brief A model is resting while the angular speed of each of its bodies
+  /// is at most this value
+  double angularThreshold = 0.0;
+
+  /// \brief Number of consecutive resting steps before a model falls asleep
+  std::size_t steps = 0;
+
+  std::size_t fellAsleep = 0;
+  std::size_t wokeUp = 0;
+};
+
+/// \brief The poses that were last reported for the links and models of a
+/// world, used to find the entities that moved during a step.
+struct WorldPoseTracker
+{
+  /// \brief Distance an entity must move to be reported as changed
+  double linearTolerance = 1e-6;
+
+  /// \brief Angle an entity must turn to be reported as changed
+  double angularTolerance = 1e-6;
+
+  /// \brief Map from an entity ID to the world pose last reported for it
+  std::unordered_map<std::size_t, Eigen::Isometry3d> reported;
+
+  /// \brief The entities that changed during the last step
+  WorldPoseChanges changes;
+};
+
+/// \brief Frame data relative to the world that was computed since the state
+/// of the engine last changed. Only used while it is enabled. Frame data can
+/// be queried from several threads at once, so the other members are only
+/// accessed while mutex is locked.
+struct FrameDataCache
+{
+  /// \brief Protects the other members
+  std::mutex mutex;
+
+  bool enabled = false;
+
+  /// \brief Map from a frame ID to its frame data relative to the world
+  std::unordered_map<std::size_t, FrameData3d> data;
+
+  /// \brief Incremented every time data is cleared, so that frame data that
+  /// was computed before the state changed is not stored afterwards
+  std::size_t generation = 0;
+
+  std::size_t hits = 0;
+  std::size_t misses = 0;
 };
 
 template <typename Value1, typename Key2 = Value1>
@@ -298,6 +432,27 @@ class Base : public Implements3d<FeatureList<Feature>>
     return id;
   }
 
+  /// \brief Add a link that has been welded into the BodyNode of another link
+  /// of the same model.
+  /// \param[in] _info The link, whose weldFrame is attached to the BodyNode
+  /// that the link was welded into
+  /// \param[in] _modelInfo The model that contains the link
+  /// \return The ID of the new link
+  public: inline std::size_t AddWeldedLink(
+      const LinkInfo &_info, ModelInfo &_modelInfo)
+  {
+    const std::size_t id = this->GetNextEntity();
+    auto info = std::make_shared<LinkInfo>(_info);
+
+    // The BodyNode already maps to the link that owns it, so the welded link
+    // is only reachable through its ID and its model.
+    this->links.idToObject[id] = info;
+    this->frames[id] = info->weldFrame.get();
+    _modelInfo.weldedLinks.push_back(id);
+
+    return id;
+  }
+
   public: inline std::size_t AddJoint(DartJoint *_joint)
   {
     const std::size_t id = this->GetNextEntity();
@@ -316,14 +471,97 @@ class Base : public Implements3d<FeatureList<Feature>>
     this->shapes.objectToID[_info.node] = id;
     this->frames[id] = _info.node.get();
 
+    // The self-collision pruning of the model was sampled without this
+    // shape, so the pairs that it skips may now collide
+    const auto modelIt = this->models.objectToID.find(
+        _info.node->getSkeleton());
+    if (modelIt != this->models.objectToID.end())
+    {
+      ModelInfo &modelInfo = *this->models.idToObject.at(modelIt->second);
+      if (modelInfo.selfCollision)
+      {
+        *modelInfo.selfCollision = SelfCollisionMatrix();
+        modelInfo.selfCollision.reset();
+        igndbg << "A shape was attached to model ["
+               << modelInfo.model->getName() << "], so its self-collision "
+               << "pruning was cleared.\n";
+      }
+    }
+
     return id;
   }
 
+  /// \brief Get the ShapeNodes of a link. The BodyNode of a link also carries
+  /// the shapes of the links that were welded into it, so only the shapes
+  /// that belong to the link itself are returned.
+  public: inline std::vector<dart::dynamics::ShapeNode*> ShapeNodesOfLink(
+      const LinkInfo &_link) const
+  {
+    std::vector<dart::dynamics::ShapeNode*> nodes;
+    for (dart::dynamics::ShapeNode *node : _link.link->getShapeNodes())
+    {
+      const dart::dynamics::SimpleFrame *owner =
+          this->shapes.HasEntity(node) ?
+            this->shapes.at(node)->weldFrame : nullptr;
+      if (owner == _link.weldFrame.get())
+        nodes.push_back(node);
+    }
+
+    return nodes;
+  }
+
+  /// \brief Get the ID of the link that a shape belongs to, or
+  /// INVALID_ENTITY_ID if that link has been removed.
+  public: inline std::size_t LinkIdOfShape(const ShapeInfo &_shape) const
+  {
+    DartBodyNode *const bn = _shape.node->getBodyNodePtr();
+    if (!_shape.weldFrame)
+    {
+      return this->links.HasEntity(bn) ?
+          this->links.IdentityOf(bn) : INVALID_ENTITY_ID;
+    }
+
+    const auto modelIt = this->models.objectToID.find(bn->getSkeleton());
+    if (modelIt == this->models.objectToID.end())
+      return INVALID_ENTITY_ID;
+
+    for (const std::size_t linkID :
+         this->models.at(modelIt->second)->weldedLinks)
+    {
+      if (this->links.at(linkID)->weldFrame.get() == _shape.weldFrame)
+        return linkID;
+    }
+
+    return INVALID_ENTITY_ID;
+  }
+
   public: void RemoveModelImpl(const std::size_t _worldID,
                                const std::size_t _modelID)
   {
     const auto &world = this->worlds.at(_worldID);
     auto skel = this->models.at(_modelID)->model;
+
+    const auto trackerIt = this->worldPoseTrackers.find(_worldID);
+    if (trackerIt != this->worldPoseTrackers.end())
+    {
+      auto &reported = trackerIt->second.reported;
+      reported.erase(_modelID);
+      for (const std::size_t linkID : this->models.at(_modelID)->weldedLinks)
+        reported.erase(linkID);
+      for (const auto &bn : skel->getBodyNodes())
+      {
+        if (this->links.HasEntity(bn))
+          reported.erase(this->links.IdentityOf(bn));
+      }
+    }
+    this->InvalidateFrameDataCache();
+
+    for (const std::size_t linkID : this->models.at(_modelID)->weldedLinks)
+    {
+      this->links.idToObject.erase(linkID);
+      this->frames.erase(linkID);
+    }
+
     // Remove the contents of the skeleton from local entity storage containers
     for (auto &jt : skel->getJoints())
     {
@@ -341,12 +579,127 @@ class Base : public Implements3d<FeatureList<Feature>>
     world->removeSkeleton(skel);
   }
 
+  /// \brief Make a model that was put to sleep mobile again, and restart the
+  /// count of steps that it has been resting. This is called whenever a
+  /// feature applies a force to a model or writes to its state.
+  /// \param[in] _skel The skeleton of the model
+  public: inline void WakeModel(const DartConstSkeletonPtr &_skel)
+  {
+    const auto idIt = this->models.objectToID.find(_skel);
+    if (idIt == this->models.objectToID.end())
+      return;
+
+    ModelInfo &info = *this->models.idToObject.at(idIt->second);
+    info.restingSteps = 0;
+    if (!info.asleep)
+      return;
+
+    info.asleep = false;
+    info.model->setMobile(true);
+
+    const auto sleepIt = this->worldSleepStates.find(
+        this->models.idToContainerID.at(idIt->second));
+    if (sleepIt != this->worldSleepStates.end())
+      ++sleepIt->second.wokeUp;
+  }
+
+  /// \brief Forget the cached frame data of every entity. This is called
+  /// whenever the engine steps, or a feature writes to the kinematic state or
+  /// the structure of a model.
+  public: inline void InvalidateFrameDataCache() const
+  {
+    std::lock_guard<std::mutex> lock(this->frameDataCache.mutex);
+    ++this->frameDataCache.generation;
+    if (!this->frameDataCache.data.empty())
+      this->frameDataCache.data.clear();
+  }
+
+  /// \brief Check whether frame data is cached.
+  /// \return True if the frame data cache is enabled
+  public: inline bool FrameDataCacheEnabled() const
+  {
+    std::lock_guard<std::mutex> lock(this->frameDataCache.mutex);
+    return this->frameDataCache.enabled;
+  }
+
+  /// \brief Record the state of every skeleton in a world so that the world
+  /// can later be returned to it without reconstructing any DART objects.
+  /// \param[in] _worldID ID of the world whose state should be captured
+  public: void SaveWorldResetState(const std::size_t _worldID)
+  {
+    const DartWorldPtr &world = this->worlds.at(_worldID);
+    std::vector<SkeletonResetState> &states =
+        this->worldResetStates[_worldID];
+
+    states.clear();
+    states.reserve(world->getNumSkeletons());
+    for (std::size_t i = 0; i < world->getNumSkeletons(); ++i)
+    {
+      const DartSkeletonPtr &skel = world->getSkeleton(i);
+
+      SkeletonResetState state;
+      state.model = skel;
+      state.positions = skel->getPositions();
+      state.velocities = skel->getVelocities();
+      state.accelerations = skel->getAccelerations();
+      state.forces = skel->getForces();
+      state.commands = skel->getCommands();
+
+      state.actuatorTypes.reserve(skel->getNumJoints());
+      for (std::size_t j = 0; j < skel->getNumJoints(); ++j)
+        state.actuatorTypes.push_back(skel->getJoint(j)->getActuatorType());
+
+      states.push_back(std::move(state));
+    }
+  }
+
   public: EntityStorage<DartWorldPtr, std::string> worlds;
   public: EntityStorage<ModelInfoPtr, DartConstSkeletonPtr> models;
   public: EntityStorage<LinkInfoPtr, const DartBodyNode*> links;
   public: EntityStorage<JointInfoPtr, const DartJoint*> joints;
   public: EntityStorage<ShapeInfoPtr, const DartShapeNode*> shapes;
   public: std::unordered_map<std::size_t, const dart::dynamics::Frame*> frames;
+
+  /// \brief Map from a world ID to the skeleton states that the world returns
+  /// to when it is reset
+  public: std::unordered_map<std::size_t, std::vector<SkeletonResetState>>
+      worldResetStates;
+
+  /// \brief Map from a world ID to its sleep settings. Resting models are
+  /// only put to sleep in worlds that have an entry.
+  public: std::unordered_map<std::size_t, WorldSleepState> worldSleepStates;
+
+  /// \brief Map from a world ID to the poses last reported for its entities.
+  /// Only worlds whose pose changes have been requested have an entry.
+  public: std::unordered_map<std::size_t, WorldPoseTracker> worldPoseTrackers;
+
+  /// \brief Map from a world ID to the largest number of contacts reported
+  /// for each pair of shapes. Worlds without an entry report every contact.
+  public: std::unordered_map<std::size_t, std::size_t>
+      worldMaxContactsPerPair;
+
+  /// \brief Cached results of FrameDataRelativeToWorld. It is mutable since
+  /// that function is const.
+  public: mutable FrameDataCache frameDataCache;
+
+  /// \brief Whether models constructed from SDF should have links that are
+  /// connected by fixed joints welded into single BodyNodes
+  public: bool weldFixedJoints = false;
+
+  /// \brief Whether ConstructSdfVisual should skip visuals instead of
+  /// building their shapes
+  public: bool physicsOnlyLoad = false;
+
+  /// \brief Number of joint space samples used to find link pairs of a
+  /// self-colliding SDF model that never touch. Zero turns this off.
+  public: std::size_t selfCollisionSamples = 0;
+
+  /// \brief Directory where the pruned self-collision pairs of each model are
+  /// cached. Nothing is cached if this is empty.
+  public: std::string selfCollisionCacheDir;
+
+  /// \brief Converted meshes that are shared by every world of this engine
+  public: CustomMeshShapeCache meshCache;
 };
 
 }
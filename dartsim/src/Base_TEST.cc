@@ -31,7 +31,11 @@
 #include "dart/dynamics/Skeleton.hpp"
 #include "dart/simulation/World.hpp"
 
+#include <ignition/common/Mesh.hh>
+#include <ignition/common/SubMesh.hh>
+
 #include "Base.hh"
+#include "CustomMeshShape.hh"
 #include "EntityManagementFeatures.hh"
 #include "SDFFeatures.hh"
 
@@ -133,6 +137,97 @@ TEST(BaseClass, RemoveModel)
   EXPECT_EQ(0u, curSize);
 }
 
+/////////////////////////////////////////////////
+/// \brief Create a mesh made of a single triangle
+std::unique_ptr<ignition::common::Mesh> CreateTriangleMesh(
+    const std::string &_path)
+{
+  auto subMesh = std::make_unique<ignition::common::SubMesh>();
+  subMesh->SetPrimitiveType(ignition::common::SubMesh::TRIANGLES);
+  subMesh->AddVertex(ignition::math::Vector3d(0, 0, 0));
+  subMesh->AddVertex(ignition::math::Vector3d(1, 0, 0));
+  subMesh->AddVertex(ignition::math::Vector3d(0, 1, 0));
+  for (unsigned int i = 0; i < 3; ++i)
+  {
+    subMesh->AddNormal(ignition::math::Vector3d::UnitZ);
+    subMesh->AddIndex(i);
+  }
+
+  auto mesh = std::make_unique<ignition::common::Mesh>();
+  mesh->SetPath(_path);
+  mesh->AddSubMesh(std::move(subMesh));
+  return mesh;
+}
+
+/////////////////////////////////////////////////
+TEST(BaseClass, AttachedShapeClearsSelfCollisionPruning)
+{
+  dartsim::Base base;
+  base.InitiateEngine(0);
+
+  dart::simulation::WorldPtr world = dart::simulation::World::create("default");
+  auto worldID = base.AddWorld(world, world->getName());
+
+  auto skel = dart::dynamics::Skeleton::create("arm");
+  auto frame = dart::dynamics::SimpleFrame::createShared(
+      dart::dynamics::Frame::World(), "arm_frame");
+  auto pair = skel->createJointAndBodyNodePair<dart::dynamics::FreeJoint>();
+  auto boxShape = std::make_shared<dart::dynamics::BoxShape>(
+      Eigen::Vector3d::Constant(1.0));
+
+  auto res = base.AddModel({skel, frame, ""}, worldID);
+  base.AddLink(pair.second);
+  base.AddJoint(pair.first);
+
+  // Pretend that the model was pruned
+  auto &modelInfo = std::get<1>(res);
+  auto matrix = std::make_shared<dartsim::SelfCollisionMatrix>();
+  modelInfo.selfCollision = matrix;
+
+  auto sn = pair.second->createShapeNodeWith<dart::dynamics::CollisionAspect>(
+      boxShape);
+  base.AddShape({sn, "box"});
+
+  // The new shape was not sampled, so the pruning no longer applies
+  EXPECT_EQ(nullptr, modelInfo.selfCollision);
+}
+
+/////////////////////////////////////////////////
+TEST(BaseClass, MeshCache)
+{
+  dartsim::CustomMeshShapeCache cache;
+  const Eigen::Vector3d scale(1.0, 1.0, 1.0);
+
+  // A mesh that is attached twice with the same scale shares one shape
+  auto mesh = CreateTriangleMesh("triangle.dae");
+  auto shape = cache.Get(*mesh, scale);
+  EXPECT_EQ(shape, cache.Get(*mesh, scale));
+  EXPECT_NE(shape, cache.Get(*mesh, 2.0 * scale));
+  EXPECT_EQ(1u, cache.Size());
+
+  // Another mesh from the same file, such as a centered submesh, has its own
+  // shape
+  auto submesh = CreateTriangleMesh("triangle.dae");
+  auto submeshShape = cache.Get(*submesh, scale);
+  EXPECT_NE(shape, submeshShape);
+  EXPECT_EQ(2u, cache.Size());
+  submeshShape.reset();
+
+  // Meshes without a path are never shared, since their address may be
+  // reused by another mesh
+  auto unnamed = CreateTriangleMesh("");
+  auto unnamedShape = cache.Get(*unnamed, scale);
+  EXPECT_NE(unnamedShape, cache.Get(*unnamed, scale));
+  EXPECT_EQ(1u, cache.Size());
+
+  // A released shape is converted again
+  shape.reset();
+  EXPECT_EQ(0u, cache.Size());
+  shape = cache.Get(*mesh, scale);
+  ASSERT_NE(nullptr, shape);
+  EXPECT_EQ(1u, cache.Size());
+}
+
 int main(int argc, char *argv[])
 {
   ::testing::InitGoogleTest(&argc, argv);
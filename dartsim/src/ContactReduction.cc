@@ -0,0 +1,353 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include "ContactReduction.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Geometry>
+#include <Eigen/QR>
+
+#include <dart/collision/CollisionObject.hpp>
+
+namespace ignition {
+namespace physics {
+namespace dartsim {
+
+namespace {
+/////////////////////////////////////////////////
+/// \brief The contacts of one pair of shapes
+struct ShapePairContacts
+{
+  /// \brief Indices of the contacts of the pair
+  std::vector<std::size_t> indices;
+
+  /// \brief For each contact, whether its shapes are in the opposite order
+  /// of the first contact of the pair, so that its normal and force point the
+  /// other way
+  std::vector<bool> flipped;
+};
+
+/////////////////////////////////////////////////
+/// \brief Group contacts by the unordered pair of shapes that they touch.
+/// Groups are returned in the order of their first contact.
+std::vector<ShapePairContacts> GroupByShapePair(
+    const std::vector<dart::collision::Contact> &_contacts)
+{
+  using ShapePair = std::pair<const void*, const void*>;
+  std::map<ShapePair, std::size_t> groupOfPair;
+  std::vector<ShapePairContacts> groups;
+
+  for (std::size_t i = 0; i < _contacts.size(); ++i)
+  {
+    const void *shape1 = _contacts[i].collisionObject1->getShapeFrame();
+    const void *shape2 = _contacts[i].collisionObject2->getShapeFrame();
+    const bool swapped = std::less<const void*>()(shape2, shape1);
+    const ShapePair key = swapped ?
+        ShapePair(shape2, shape1) : ShapePair(shape1, shape2);
+
+    const auto inserted = groupOfPair.insert({key, groups.size()});
+    if (inserted.second)
+      groups.emplace_back();
+
+    ShapePairContacts &group = groups[inserted.first->second];
+    if (group.indices.empty())
+    {
+      group.indices.push_back(i);
+      group.flipped.push_back(false);
+      continue;
+    }
+
+    const auto &first = _contacts[group.indices.front()];
+    group.indices.push_back(i);
+    group.flipped.push_back(
+        first.collisionObject1 != _contacts[i].collisionObject1);
+  }
+
+  return groups;
+}
+
+/////////////////////////////////////////////////
+/// \brief Area of the convex hull of points in a plane.
+double HullArea(std::vector<Eigen::Vector2d> _points)
+{
+  if (_points.size() < 3)
+    return 0.0;
+
+  std::sort(_points.begin(), _points.end(),
+      [](const Eigen::Vector2d &_a, const Eigen::Vector2d &_b)
+      {
+        return _a.x() < _b.x() || (_a.x() == _b.x() && _a.y() < _b.y());
+      });
+
+  const auto cross = [](const Eigen::Vector2d &_o, const Eigen::Vector2d &_a,
+                        const Eigen::Vector2d &_b)
+  {
+    return (_a.x() - _o.x()) * (_b.y() - _o.y()) -
+           (_a.y() - _o.y()) * (_b.x() - _o.x());
+  };
+
+  // Andrew's monotone chain
+  std::vector<Eigen::Vector2d> hull(2 * _points.size());
+  std::size_t k = 0;
+  for (std::size_t i = 0; i < _points.size(); ++i)
+  {
+    while (k >= 2 && cross(hull[k-2], hull[k-1], _points[i]) <= 0.0)
+      --k;
+    hull[k++] = _points[i];
+  }
+  for (std::size_t i = _points.size() - 1, lower = k + 1; i > 0; --i)
+  {
+    while (k >= lower && cross(hull[k-2], hull[k-1], _points[i-1]) <= 0.0)
+      --k;
+    hull[k++] = _points[i-1];
+  }
+
+  double area = 0.0;
+  for (std::size_t i = 0; i + 1 < k; ++i)
+    area += hull[i].x() * hull[i+1].y() - hull[i+1].x() * hull[i].y();
+  return 0.5 * std::abs(area);
+}
+
+/////////////////////////////////////////////////
+/// \brief Choose the representatives of a pair of shapes that span the
+/// largest support polygon.
+/// \return Positions within _group of the chosen contacts
+std::vector<std::size_t> SelectSupportContacts(
+    const std::vector<dart::collision::Contact> &_contacts,
+    const ShapePairContacts &_group, const std::size_t _count)
+{
+  const std::size_t n = _group.indices.size();
+
+  // Project the contacts onto the plane of their average normal
+  Eigen::Vector3d normal = Eigen::Vector3d::Zero();
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    const Eigen::Vector3d &contactNormal =
+        _contacts[_group.indices[i]].normal;
+    normal += _group.flipped[i] ? -contactNormal : contactNormal;
+  }
+  if (normal.squaredNorm() < 1e-12)
+    normal = Eigen::Vector3d::UnitZ();
+  normal.normalize();
+
+  const Eigen::Vector3d u = normal.unitOrthogonal();
+  const Eigen::Vector3d v = normal.cross(u);
+  std::vector<Eigen::Vector2d> points(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    const Eigen::Vector3d &p = _contacts[_group.indices[i]].point;
+    points[i] = Eigen::Vector2d(p.dot(u), p.dot(v));
+  }
+
+  std::vector<bool> chosen(n, false);
+  std::vector<std::size_t> selected;
+  std::vector<Eigen::Vector2d> polygon;
+  const auto choose = [&](const std::size_t _i)
+  {
+    chosen[_i] = true;
+    selected.push_back(_i);
+    polygon.push_back(points[_i]);
+  };
+
+  // Start from the deepest contact
+  std::size_t deepest = 0;
+  for (std::size_t i = 1; i < n; ++i)
+  {
+    if (_contacts[_group.indices[i]].penetrationDepth >
+        _contacts[_group.indices[deepest]].penetrationDepth)
+    {
+      deepest = i;
+    }
+  }
+  choose(deepest);
+
+  double area = 0.0;
+  while (selected.size() < _count)
+  {
+    // Prefer the contact that grows the polygon the most. While the polygon
+    // has no area, or when no contact grows it, take the contact that is
+    // farthest from every chosen contact instead.
+    std::size_t best = n;
+    double bestGain = 1e-12;
+    double bestArea = area;
+    if (polygon.size() >= 2)
+    {
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        if (chosen[i])
+          continue;
+
+        polygon.push_back(points[i]);
+        const double candidateArea = HullArea(polygon);
+        polygon.pop_back();
+
+        if (candidateArea - area > bestGain)
+        {
+          best = i;
+          bestGain = candidateArea - area;
+          bestArea = candidateArea;
+        }
+      }
+    }
+
+    if (best == n)
+    {
+      double bestDistance = -1.0;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        if (chosen[i])
+          continue;
+
+        double distance = std::numeric_limits<double>::infinity();
+        for (const Eigen::Vector2d &p : polygon)
+          distance = std::min(distance, (points[i] - p).squaredNorm());
+
+        if (distance > bestDistance)
+        {
+          best = i;
+          bestDistance = distance;
+        }
+      }
+    }
+
+    area = bestArea;
+    choose(best);
+  }
+
+  return selected;
+}
+}
+
+/////////////////////////////////////////////////
+void ReduceContacts(
+    const std::vector<dart::collision::Contact> &_contacts,
+    const std::size_t _maxPerPair,
+    std::vector<dart::collision::Contact> &_reduced)
+{
+  if (_maxPerPair == 0)
+  {
+    _reduced = _contacts;
+    return;
+  }
+
+  _reduced.clear();
+  _reduced.reserve(CountReducedContacts(_contacts, _maxPerPair));
+
+  for (const ShapePairContacts &group : GroupByShapePair(_contacts))
+  {
+    const std::size_t n = group.indices.size();
+    if (n <= _maxPerPair)
+    {
+      for (const std::size_t index : group.indices)
+        _reduced.push_back(_contacts[index]);
+      continue;
+    }
+
+    const std::vector<std::size_t> selected =
+        SelectSupportContacts(_contacts, group, _maxPerPair);
+
+    const std::size_t firstOfGroup = _reduced.size();
+    std::vector<std::size_t> representativeOf(n, n);
+    for (std::size_t s = 0; s < selected.size(); ++s)
+    {
+      _reduced.push_back(_contacts[group.indices[selected[s]]]);
+      representativeOf[selected[s]] = s;
+    }
+
+    // Spread the force of every other contact over the representatives, with
+    // weights whose average of the representative points is the point of the
+    // dropped contact. This keeps both the net force and its moment when the
+    // point lies in the plane of the representatives. The weights are the
+    // minimum-norm solution around the centroid of the representatives, so
+    // they always sum to one.
+    Eigen::Vector3d centroid = Eigen::Vector3d::Zero();
+    for (const std::size_t s : selected)
+      centroid += _contacts[group.indices[s]].point;
+    centroid /= static_cast<double>(selected.size());
+
+    Eigen::MatrixXd offsets(3, selected.size());
+    for (std::size_t s = 0; s < selected.size(); ++s)
+    {
+      offsets.col(static_cast<Eigen::Index>(s)) =
+          _contacts[group.indices[selected[s]]].point - centroid;
+    }
+    const Eigen::CompleteOrthogonalDecomposition<Eigen::MatrixXd>
+        decomposition(offsets);
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      if (representativeOf[i] != n)
+        continue;
+
+      const dart::collision::Contact &contact = _contacts[group.indices[i]];
+      const Eigen::VectorXd weights =
+          decomposition.solve(contact.point - centroid).array() +
+          1.0 / static_cast<double>(selected.size());
+
+      // The nearest representative takes the deepest penetration
+      std::size_t nearest = 0;
+      double nearestDistance = std::numeric_limits<double>::infinity();
+      for (std::size_t s = 0; s < selected.size(); ++s)
+      {
+        dart::collision::Contact &representative = _reduced[firstOfGroup + s];
+        const bool sameOrder =
+            group.flipped[i] == group.flipped[selected[s]];
+        const double weight = weights[static_cast<Eigen::Index>(s)];
+        representative.force +=
+            sameOrder ? weight * contact.force : -weight * contact.force;
+
+        const double distance =
+            (representative.point - contact.point).squaredNorm();
+        if (distance < nearestDistance)
+        {
+          nearest = s;
+          nearestDistance = distance;
+        }
+      }
+
+      dart::collision::Contact &representative =
+          _reduced[firstOfGroup + nearest];
+      representative.penetrationDepth = std::max(
+          representative.penetrationDepth, contact.penetrationDepth);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+std::size_t CountReducedContacts(
+    const std::vector<dart::collision::Contact> &_contacts,
+    const std::size_t _maxPerPair)
+{
+  if (_maxPerPair == 0)
+    return _contacts.size();
+
+  std::size_t count = 0;
+  for (const ShapePairContacts &group : GroupByShapePair(_contacts))
+    count += std::min(group.indices.size(), _maxPerPair);
+  return count;
+}
+
+}
+}
+}
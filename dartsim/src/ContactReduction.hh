@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_DARTSIM_SRC_CONTACTREDUCTION_HH_
+#define IGNITION_PHYSICS_DARTSIM_SRC_CONTACTREDUCTION_HH_
+
+#include <vector>
+
+#include <dart/collision/Contact.hpp>
+
+namespace ignition {
+namespace physics {
+namespace dartsim {
+
+/// \brief Reduce the contacts of each pair of shapes to at most
+/// _maxPerPair representative contacts.
+///
+/// The representatives of a pair are chosen to span the largest support
+/// polygon in the contact plane: the deepest contact first, then the contact
+/// farthest from it, then the contacts that grow the area of the polygon the
+/// most. The force of every other contact of the pair is spread over the
+/// representatives so that the total force of the pair is kept, and so is its
+/// moment when the representatives and the dropped contact lie in one plane,
+/// as they do on a flat face. Otherwise the moment is kept as closely as the
+/// representatives allow; a single representative keeps only the net force.
+/// A representative can receive a pulling share when a dropped contact lies
+/// outside of their polygon. The nearest representative of each dropped
+/// contact takes the deeper of their penetrations.
+///
+/// Pairs with no more than _maxPerPair contacts are kept unchanged, in their
+/// original order.
+///
+/// With a _maxPerPair of zero every contact is copied into _reduced. Callers
+/// that do not reduce contacts should read _contacts directly instead.
+/// \param[in] _contacts Contacts reported by the collision detector
+/// \param[in] _maxPerPair Largest number of contacts to keep for each pair of
+/// shapes. Zero keeps every contact.
+/// \param[out] _reduced Receives the reduced contacts, grouped by pair of
+/// shapes. Its previous content is discarded, but its capacity is reused.
+void ReduceContacts(
+    const std::vector<dart::collision::Contact> &_contacts,
+    std::size_t _maxPerPair,
+    std::vector<dart::collision::Contact> &_reduced);
+
+/// \brief Count the contacts that ReduceContacts() would return, without
+/// reducing them.
+/// \param[in] _contacts Contacts reported by the collision detector
+/// \param[in] _maxPerPair Largest number of contacts to keep for each pair of
+/// shapes. Zero keeps every contact.
+/// \return Number of reduced contacts
+std::size_t CountReducedContacts(
+    const std::vector<dart::collision::Contact> &_contacts,
+    std::size_t _maxPerPair);
+
+}
+}
+}
+
+#endif  // IGNITION_PHYSICS_DARTSIM_SRC_CONTACTREDUCTION_HH_
@@ -28,6 +28,143 @@ dart::simulation::WorldPtr CustomFeatures::GetDartsimWorld(
   return this->worlds.at(_worldID);
 }
 
+/////////////////////////////////////////////////
+void CustomFeatures::SetFrameDataCacheEnabled(
+    const Identity &/*_engineID*/, bool _enable)
+{
+  {
+    std::lock_guard<std::mutex> lock(this->frameDataCache.mutex);
+    this->frameDataCache.enabled = _enable;
+  }
+  this->InvalidateFrameDataCache();
+}
+
+/////////////////////////////////////////////////
+bool CustomFeatures::GetFrameDataCacheEnabled(
+    const Identity &/*_engineID*/) const
+{
+  return this->FrameDataCacheEnabled();
+}
+
+/////////////////////////////////////////////////
+FrameDataCacheStatistics CustomFeatures::GetFrameDataCacheStatistics(
+    const Identity &/*_engineID*/) const
+{
+  std::lock_guard<std::mutex> lock(this->frameDataCache.mutex);
+  return {this->frameDataCache.hits, this->frameDataCache.misses};
+}
+
+/////////////////////////////////////////////////
+void CustomFeatures::ResetFrameDataCacheStatistics(
+    const Identity &/*_engineID*/)
+{
+  std::lock_guard<std::mutex> lock(this->frameDataCache.mutex);
+  this->frameDataCache.hits = 0;
+  this->frameDataCache.misses = 0;
+}
+
+/////////////////////////////////////////////////
+void CustomFeatures::SetModelKinematic(
+    const Identity &_modelID, bool _kinematic)
+{
+  ModelInfo &info = *this->ReferenceInterface<ModelInfo>(_modelID);
+  if (info.kinematic == _kinematic)
+    return;
+
+  // A sleeping model is already immobile, so wake it up first to leave only
+  // one reason for it to be immobile
+  this->WakeModel(info.model);
+  info.kinematic = _kinematic;
+  if (_kinematic)
+  {
+    info.mobileBeforeKinematic = info.model->isMobile();
+    info.model->setMobile(false);
+  }
+  else
+  {
+    info.model->setMobile(info.mobileBeforeKinematic);
+  }
+}
+
+/////////////////////////////////////////////////
+bool CustomFeatures::ModelIsKinematic(const Identity &_modelID) const
+{
+  return this->ReferenceInterface<ModelInfo>(_modelID)->kinematic;
+}
+
+/////////////////////////////////////////////////
+void CustomFeatures::SetPhysicsOnlyLoad(
+    const Identity &/*_engineID*/, bool _physicsOnly)
+{
+  this->physicsOnlyLoad = _physicsOnly;
+}
+
+/////////////////////////////////////////////////
+bool CustomFeatures::GetPhysicsOnlyLoad(const Identity &/*_engineID*/) const
+{
+  return this->physicsOnlyLoad;
+}
+
+/////////////////////////////////////////////////
+void CustomFeatures::SetSelfCollisionPruning(
+    const Identity &/*_engineID*/, std::size_t _samples,
+    const std::string &_cacheDirectory)
+{
+  this->selfCollisionSamples = _samples;
+  this->selfCollisionCacheDir = _cacheDirectory;
+}
+
+/////////////////////////////////////////////////
+std::size_t CustomFeatures::PruneSelfCollisions(
+    const Identity &_modelID, std::size_t _samples)
+{
+  return this->ApplySelfCollisionPruning(_modelID, _samples);
+}
+
+/////////////////////////////////////////////////
+void CustomFeatures::EnableWorldSleeping(
+    const Identity &_worldID, double _linearThreshold,
+    double _angularThreshold, std::size_t _steps)
+{
+  WorldSleepState &state = this->worldSleepStates[_worldID];
+  state.linearThreshold = _linearThreshold;
+  state.angularThreshold = _angularThreshold;
+  state.steps = _steps;
+}
+
+/////////////////////////////////////////////////
+void CustomFeatures::DisableWorldSleeping(const Identity &_worldID)
+{
+  const auto modelsIt = this->models.indexInContainerToID.find(_worldID);
+  if (modelsIt != this->models.indexInContainerToID.end())
+  {
+    for (const std::size_t modelID : modelsIt->second)
+      this->WakeModel(this->models.at(modelID)->model);
+  }
+
+  this->worldSleepStates.erase(_worldID);
+}
+
+/////////////////////////////////////////////////
+bool CustomFeatures::ModelIsAsleep(const Identity &_modelID) const
+{
+  return this->ReferenceInterface<ModelInfo>(_modelID)->asleep;
+}
+
+/////////////////////////////////////////////////
+void CustomFeatures::SetWeldFixedJoints(
+    const Identity &/*_engineID*/, bool _weld)
+{
+  this->weldFixedJoints = _weld;
+}
+
+/////////////////////////////////////////////////
+bool CustomFeatures::GetWeldFixedJoints(
+    const Identity &/*_engineID*/) const
+{
+  return this->weldFixedJoints;
+}
+
 }
 }
 }
@@ -18,26 +18,84 @@
 #ifndef IGNITION_PHYSICS_SRC_CUSTOMFEATURES_HH
 #define IGNITION_PHYSICS_SRC_CUSTOMFEATURES_HH
 
+#include <string>
+
 #include <ignition/physics/Implements.hh>
 
+#include <ignition/physics/dartsim/FrameDataCache.hh>
+#include <ignition/physics/dartsim/Kinematic.hh>
+#include <ignition/physics/dartsim/PhysicsOnlyLoad.hh>
+#include <ignition/physics/dartsim/SelfCollisionPruning.hh>
+#include <ignition/physics/dartsim/Sleep.hh>
+#include <ignition/physics/dartsim/WeldFixedJoints.hh>
 #include <ignition/physics/dartsim/World.hh>
 
-#include "Base.hh"
+#include "EntityManagementFeatures.hh"
 
 namespace ignition {
 namespace physics {
 namespace dartsim {
 
 using CustomFeatureList = FeatureList<
-  RetrieveWorld
+  FrameDataCacheFeature,
+  KinematicModelFeature,
+  PhysicsOnlyLoadFeature,
+  RetrieveWorld,
+  SelfCollisionPruningFeature,
+  SleepFeature,
+  WeldFixedJointsFeature
 >;
 
 class CustomFeatures :
-    public virtual Base,
+    public virtual EntityManagementFeatures,
     public virtual Implements3d<CustomFeatureList>
 {
   public: dart::simulation::WorldPtr GetDartsimWorld(
       const Identity &_worldID) override;
+
+  public: void SetFrameDataCacheEnabled(
+      const Identity &_engineID, bool _enable) override;
+
+  public: bool GetFrameDataCacheEnabled(
+      const Identity &_engineID) const override;
+
+  public: FrameDataCacheStatistics GetFrameDataCacheStatistics(
+      const Identity &_engineID) const override;
+
+  public: void ResetFrameDataCacheStatistics(
+      const Identity &_engineID) override;
+
+  public: void SetModelKinematic(
+      const Identity &_modelID, bool _kinematic) override;
+
+  public: bool ModelIsKinematic(const Identity &_modelID) const override;
+
+  public: void SetPhysicsOnlyLoad(
+      const Identity &_engineID, bool _physicsOnly) override;
+
+  public: bool GetPhysicsOnlyLoad(
+      const Identity &_engineID) const override;
+
+  public: void SetSelfCollisionPruning(
+      const Identity &_engineID, std::size_t _samples,
+      const std::string &_cacheDirectory) override;
+
+  public: std::size_t PruneSelfCollisions(
+      const Identity &_modelID, std::size_t _samples) override;
+
+  public: void EnableWorldSleeping(
+      const Identity &_worldID, double _linearThreshold,
+      double _angularThreshold, std::size_t _steps) override;
+
+  public: void DisableWorldSleeping(const Identity &_worldID) override;
+
+  public: bool ModelIsAsleep(const Identity &_modelID) const override;
+
+  public: void SetWeldFixedJoints(
+      const Identity &_engineID, bool _weld) override;
+
+  public: bool GetWeldFixedJoints(
+      const Identity &_engineID) const override;
 };
 
 }
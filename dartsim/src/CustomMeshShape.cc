@@ -222,6 +222,55 @@ CustomMeshShape::CustomMeshShape(
   this->mIsVolumeDirty = true;
 }
 
+/////////////////////////////////////////////////
+std::shared_ptr<CustomMeshShape> CustomMeshShapeCache::Get(
+    const ignition::common::Mesh &_input,
+    const Eigen::Vector3d &_scale)
+{
+  const std::string &path = _input.Path();
+  if (path.empty())
+    return std::make_shared<CustomMeshShape>(_input, _scale);
+
+  const Key key{&_input, path, _input.Name(),
+      _scale[0], _scale[1], _scale[2]};
+
+  auto it = this->shapes.find(key);
+  if (it != this->shapes.end())
+  {
+    std::shared_ptr<CustomMeshShape> shape = it->second.lock();
+    if (shape)
+      return shape;
+  }
+
+  // Either this mesh has never been requested with this scale, or every shape
+  // node that used it has been removed. Converting it costs far more than a
+  // pass over the cache, so this is when the released entries are dropped.
+  for (auto entry = this->shapes.begin(); entry != this->shapes.end();)
+  {
+    if (entry->second.expired())
+      entry = this->shapes.erase(entry);
+    else
+      ++entry;
+  }
+
+  auto shape = std::make_shared<CustomMeshShape>(_input, _scale);
+  this->shapes[key] = shape;
+  return shape;
+}
+
+/////////////////////////////////////////////////
+std::size_t CustomMeshShapeCache::Size() const
+{
+  std::size_t count = 0;
+  for (const auto &entry : this->shapes)
+  {
+    if (!entry.second.expired())
+      ++count;
+  }
+
+  return count;
+}
+
 }
 }
 }
@@ -18,6 +18,11 @@
 #ifndef IGNITION_PHYSICS_DARTSIM_SRC_CUSTOMMESHSHAPE_HH_
 #define IGNITION_PHYSICS_DARTSIM_SRC_CUSTOMMESHSHAPE_HH_
 
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+
 #include <dart/dynamics/MeshShape.hpp>
 #include <ignition/common/Mesh.hh>
 
@@ -35,6 +40,38 @@ class CustomMeshShape : public dart::dynamics::MeshShape
       const Eigen::Vector3d &_scale);
 };
 
+/// \brief This class shares one CustomMeshShape between every ShapeNode that
+/// attaches the same mesh with the same scale, so a mesh that is instantiated
+/// many times is only converted and stored once. Meshes are identified by
+/// their address together with their path and name. The address tells apart
+/// meshes that come from the same file, such as a submesh that was extracted
+/// and centered, and the path and name guard against the address being reused
+/// by another mesh. Meshes without a path are converted every time.
+///
+/// The cache only holds weak references, so a converted mesh is released as
+/// soon as the last ShapeNode that uses it is destroyed. The entries of
+/// released meshes are pruned whenever a mesh has to be converted.
+class CustomMeshShapeCache
+{
+  /// \brief Get the converted shape for a mesh, converting it if no live
+  /// shape exists for this mesh and scale yet.
+  /// \param[in] _input The mesh to convert
+  /// \param[in] _scale The scale to apply to the mesh
+  /// \return A shape that may be shared with other ShapeNodes
+  public: std::shared_ptr<CustomMeshShape> Get(
+      const ignition::common::Mesh &_input,
+      const Eigen::Vector3d &_scale);
+
+  /// \brief Get the number of converted meshes that are currently in use.
+  public: std::size_t Size() const;
+
+  /// \brief Mesh address, path, name and scale factors.
+  private: using Key = std::tuple<const ignition::common::Mesh*, std::string,
+      std::string, double, double, double>;
+
+  private: std::map<Key, std::weak_ptr<CustomMeshShape>> shapes;
+};
+
 }
 }
 }
@@ -17,9 +17,14 @@
 
 #include "EntityManagementFeatures.hh"
 
+#include <algorithm>
+#include <iomanip>
+#include <iterator>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 #include <dart/config.hpp>
 #include <dart/collision/ode/OdeCollisionDetector.hpp>
@@ -29,6 +34,11 @@
 #include <dart/collision/CollisionFilter.hpp>
 #include <dart/collision/CollisionObject.hpp>
 
+#include <ignition/common/Filesystem.hh>
+#include <ignition/common/Profiler.hh>
+
+#include "SelfCollisionMatrix.hh"
+
 namespace ignition {
 namespace physics {
 namespace dartsim {
@@ -44,6 +54,9 @@ class BitmaskContactFilter : public dart::collision::BodyNodeCollisionFilter
 
   private: std::unordered_map<DartShapeConstPtr, uint16_t> bitmaskMap;
 
+  private: std::unordered_map<const dart::dynamics::Skeleton*,
+      std::shared_ptr<const SelfCollisionMatrix>> selfCollisionMap;
+
   public: bool ignoresCollision(
       DartCollisionConstPtr _object1,
       DartCollisionConstPtr _object2) const override
@@ -55,6 +68,22 @@ class BitmaskContactFilter : public dart::collision::BodyNodeCollisionFilter
           _object1, _object2))
       return true;
 
+    // Skip pairs of bodies of one skeleton that were found to never collide
+    const auto bn1 = shapeNode1->getBodyNodePtr();
+    const auto bn2 = shapeNode2->getBodyNodePtr();
+    if (bn1->getSkeleton() == bn2->getSkeleton())
+    {
+      auto matrixIter = this->selfCollisionMap.find(bn1->getSkeleton().get());
+      if (matrixIter != this->selfCollisionMap.end() &&
+          matrixIter->second->BodyCount() ==
+            bn1->getSkeleton()->getNumBodyNodes() &&
+          matrixIter->second->Ignores(
+            bn1->getIndexInSkeleton(), bn2->getIndexInSkeleton()))
+      {
+        return true;
+      }
+    }
+
     auto shape1Iter = bitmaskMap.find(shapeNode1);
     auto shape2Iter = bitmaskMap.find(shapeNode2);
     if (shape1Iter != bitmaskMap.end() && shape2Iter != bitmaskMap.end() &&
@@ -85,6 +114,13 @@ class BitmaskContactFilter : public dart::collision::BodyNodeCollisionFilter
       bitmaskMap.erase(shapeIter);
   }
 
+  public: void SetSelfCollisionMatrix(
+      const dart::dynamics::Skeleton *_skelPtr,
+      std::shared_ptr<const SelfCollisionMatrix> _matrix)
+  {
+    this->selfCollisionMap[_skelPtr] = std::move(_matrix);
+  }
+
   public: void RemoveSkeletonCollisions(dart::dynamics::SkeletonPtr _skelPtr)
   {
     for (std::size_t i = 0; i < _skelPtr->getNumShapeNodes(); ++i)
@@ -92,6 +128,7 @@ class BitmaskContactFilter : public dart::collision::BodyNodeCollisionFilter
       auto shapePtr = _skelPtr->getShapeNode(i);
       this->RemoveIgnoredCollision(shapePtr);
     }
+    this->selfCollisionMap.erase(_skelPtr.get());
   }
 
   public: virtual ~BitmaskContactFilter() = default;
@@ -271,17 +308,34 @@ Identity EntityManagementFeatures::GetWorldOfModel(
 std::size_t EntityManagementFeatures::GetLinkCount(
     const Identity &_modelID) const
 {
-  return this->ReferenceInterface<ModelInfo>(_modelID)
-      ->model->getNumBodyNodes();
+  const auto *modelInfo = this->ReferenceInterface<ModelInfo>(_modelID);
+
+  // Links that were welded into the BodyNode of another link come after the
+  // links that own a BodyNode
+  return modelInfo->model->getNumBodyNodes() + modelInfo->weldedLinks.size();
 }
 
 /////////////////////////////////////////////////
 Identity EntityManagementFeatures::GetLink(
     const Identity &_modelID, const std::size_t _linkIndex) const
 {
-  DartBodyNode *const bn =
-      this->ReferenceInterface<ModelInfo>(_modelID)->model->getBodyNode(
-          _linkIndex);
+  const auto *modelInfo = this->ReferenceInterface<ModelInfo>(_modelID);
+  const std::size_t numBodyNodes = modelInfo->model->getNumBodyNodes();
+
+  if (_linkIndex >= numBodyNodes)
+  {
+    const std::size_t weldedIndex = _linkIndex - numBodyNodes;
+    if (weldedIndex < modelInfo->weldedLinks.size())
+    {
+      const std::size_t linkID = modelInfo->weldedLinks[weldedIndex];
+      if (this->links.HasEntity(linkID))
+        return this->GenerateIdentity(linkID, this->links.at(linkID));
+    }
+
+    return this->GenerateInvalidId();
+  }
+
+  DartBodyNode *const bn = modelInfo->model->getBodyNode(_linkIndex);
 
   // If the link doesn't exist in "links", it means the containing entity has
   // been removed.
@@ -304,9 +358,23 @@ Identity EntityManagementFeatures::GetLink(
 Identity EntityManagementFeatures::GetLink(
     const Identity &_modelID, const std::string &_linkName) const
 {
-  DartBodyNode *const bn =
-      this->ReferenceInterface<ModelInfo>(_modelID)->model->getBodyNode(
-          _linkName);
+  const auto *modelInfo = this->ReferenceInterface<ModelInfo>(_modelID);
+  DartBodyNode *const bn = modelInfo->model->getBodyNode(_linkName);
+
+  if (!bn)
+  {
+    // Links that were welded into the BodyNode of another link are not part
+    // of the skeleton, so look for them by name.
+    for (const std::size_t linkID : modelInfo->weldedLinks)
+    {
+      const auto linkIt = this->links.idToObject.find(linkID);
+      if (linkIt != this->links.idToObject.end() &&
+          linkIt->second->name == _linkName)
+      {
+        return this->GenerateIdentity(linkID, linkIt->second);
+      }
+    }
+  }
 
   // If the link doesn't exist in "links", it means the containing entity has
   // been removed.
@@ -393,8 +461,20 @@ const std::string &EntityManagementFeatures::GetLinkName(
 std::size_t EntityManagementFeatures::GetLinkIndex(
     const Identity &_linkID) const
 {
-  return this->ReferenceInterface<LinkInfo>(_linkID)
-      ->link->getIndexInSkeleton();
+  const auto *linkInfo = this->ReferenceInterface<LinkInfo>(_linkID);
+  if (!linkInfo->weldFrame)
+    return linkInfo->link->getIndexInSkeleton();
+
+  // Welded links are indexed after the links that own a BodyNode, in the
+  // order that they were welded
+  const auto &skel = linkInfo->link->getSkeleton();
+  const auto &weldedLinks =
+      this->models.at(this->models.IdentityOf(skel))->weldedLinks;
+  const auto it =
+      std::find(weldedLinks.begin(), weldedLinks.end(), _linkID.id);
+
+  return skel->getNumBodyNodes()
+      + static_cast<std::size_t>(std::distance(weldedLinks.begin(), it));
 }
 
 /////////////////////////////////////////////////
@@ -421,16 +501,18 @@ Identity EntityManagementFeatures::GetModelOfLink(
 std::size_t EntityManagementFeatures::GetShapeCount(
     const Identity &_linkID) const
 {
-  return this->ReferenceInterface<LinkInfo>(_linkID)->link->getNumShapeNodes();
+  return this->ShapeNodesOfLink(
+      *this->ReferenceInterface<LinkInfo>(_linkID)).size();
 }
 
 /////////////////////////////////////////////////
 Identity EntityManagementFeatures::GetShape(
     const Identity &_linkID, const std::size_t _shapeIndex) const
 {
+  const auto nodes =
+      this->ShapeNodesOfLink(*this->ReferenceInterface<LinkInfo>(_linkID));
   DartShapeNode *const sn =
-      this->ReferenceInterface<LinkInfo>(_linkID)->link->getShapeNode(
-          _shapeIndex);
+      _shapeIndex < nodes.size() ? nodes[_shapeIndex] : nullptr;
 
   // If the shape doesn't exist in "shapes", it means the containing entity has
   // been removed.
@@ -453,10 +535,10 @@ Identity EntityManagementFeatures::GetShape(
 Identity EntityManagementFeatures::GetShape(
     const Identity &_linkID, const std::string &_shapeName) const
 {
-  auto bn = this->ReferenceInterface<LinkInfo>(_linkID)->link;
+  const auto *linkInfo = this->ReferenceInterface<LinkInfo>(_linkID);
 
-  DartShapeNode *const sn = bn->getSkeleton()->getShapeNode(
-          bn->getName() + ":" + _shapeName);
+  DartShapeNode *const sn = linkInfo->link->getSkeleton()->getShapeNode(
+          ShapeNodeName(*linkInfo, _shapeName));
 
   // If the shape doesn't exist in "shapes", it means the containing entity has
   // been removed.
@@ -523,7 +605,14 @@ std::size_t EntityManagementFeatures::GetShapeIndex(
     const Identity &_shapeID) const
 {
   const auto shapeInfo = this->ReferenceInterface<ShapeInfo>(_shapeID);
-  return shapeInfo->node->getIndexInBodyNode();
+  if (!shapeInfo->weldFrame)
+    return shapeInfo->node->getIndexInBodyNode();
+
+  // Only count the shapes of the welded link, not those of its BodyNode
+  const std::size_t linkID = this->LinkIdOfShape(*shapeInfo);
+  const auto nodes = this->ShapeNodesOfLink(*this->links.at(linkID));
+  const auto it = std::find(nodes.begin(), nodes.end(), shapeInfo->node.get());
+  return static_cast<std::size_t>(std::distance(nodes.begin(), it));
 }
 
 /////////////////////////////////////////////////
@@ -531,13 +620,12 @@ Identity EntityManagementFeatures::GetLinkOfShape(
     const Identity &_shapeID) const
 {
   auto shapeInfo = this->ReferenceInterface<ShapeInfo>(_shapeID);
-  DartBodyNode *const bn = shapeInfo->node->getBodyNodePtr();
 
   // If the link containing the shape doesn't exist in "links", it means this
   // shape belongs to a removed link.
-  if (this->links.HasEntity(bn))
+  const std::size_t linkID = this->LinkIdOfShape(*shapeInfo);
+  if (this->links.HasEntity(linkID))
   {
-    const std::size_t linkID = this->links.IdentityOf(bn);
     return this->GenerateIdentity(linkID, this->links.at(linkID));
   }
   else
@@ -684,6 +772,48 @@ void EntityManagementFeatures::RemoveCollisionFilterMask(
   filterPtr->RemoveIgnoredCollision(shapeNode);
 }
 
+/////////////////////////////////////////////////
+std::size_t EntityManagementFeatures::ApplySelfCollisionPruning(
+    const std::size_t _modelID, const std::size_t _samples)
+{
+  IGN_PROFILE("EntityManagementFeatures::ApplySelfCollisionPruning");
+  const DartSkeletonPtr &skel = this->models.at(_modelID)->model;
+  const uint64_t hash = SelfCollisionMatrix::Hash(*skel, _samples);
+
+  std::string cachePath;
+  if (!this->selfCollisionCacheDir.empty())
+  {
+    std::stringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << hash << ".scm";
+    cachePath = common::joinPaths(this->selfCollisionCacheDir, name.str());
+  }
+
+  auto matrix = std::make_shared<SelfCollisionMatrix>();
+  if (cachePath.empty() || !matrix->Load(cachePath, hash))
+  {
+    *matrix = SelfCollisionMatrix::Compute(skel, _samples);
+
+    if (!cachePath.empty() &&
+        (!common::createDirectories(this->selfCollisionCacheDir) ||
+         !matrix->Save(cachePath, hash)))
+    {
+      ignwarn << "Unable to write the self-collision cache file ["
+              << cachePath << "] for model [" << skel->getName() << "]\n";
+    }
+  }
+
+  const std::size_t worldID = this->models.idToContainerID.at(_modelID);
+  GetFilterPtr(this, worldID)->SetSelfCollisionMatrix(skel.get(), matrix);
+  this->models.at(_modelID)->selfCollision = matrix;
+
+  const std::size_t pruned = matrix->PrunedPairCount();
+  ignmsg << "Skipping self-collision checks of [" << pruned << "] link pairs "
+         << "of model [" << skel->getName() << "] that did not touch in ["
+         << _samples << "] samples\n";
+
+  return pruned;
+}
+
 }
 }
 }
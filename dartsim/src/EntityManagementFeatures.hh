@@ -155,6 +155,15 @@ class EntityManagementFeatures :
       const Identity &_shapeID) const override;
 
   public: void RemoveCollisionFilterMask(const Identity &_shapeID) override;
+
+  /// \brief Sample the joint space of a model and stop checking collisions
+  /// between pairs of its links that never touched. The result is read from
+  /// and written to selfCollisionCacheDir when that is set.
+  /// \param[in] _modelID ID of the model
+  /// \param[in] _samples Number of joint configurations to sample
+  /// \return Number of link pairs that will be skipped
+  public: std::size_t ApplySelfCollisionPruning(
+      const std::size_t _modelID, const std::size_t _samples);
 };
 
 }
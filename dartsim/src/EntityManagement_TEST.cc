@@ -15,6 +15,10 @@
  *
 */
 
+#include <dart/dynamics/BodyNode.hpp>
+#include <dart/dynamics/Skeleton.hpp>
+#include <dart/simulation/World.hpp>
+
 #include <gtest/gtest.h>
 
 #include <ignition/plugin/Loader.hh>
@@ -27,19 +31,22 @@
 #include <ignition/physics/RequestEngine.hh>
 #include <ignition/physics/RevoluteJoint.hh>
 
+#include "CustomFeatures.hh"
 #include "EntityManagementFeatures.hh"
 #include "JointFeatures.hh"
 #include "KinematicsFeatures.hh"
 #include "ShapeFeatures.hh"
 
 struct TestFeatureList : ignition::physics::FeatureList<
+    ignition::physics::dartsim::CustomFeatureList,
     ignition::physics::dartsim::EntityManagementFeatureList,
     ignition::physics::dartsim::JointFeatureList,
     ignition::physics::dartsim::KinematicsFeatureList,
     ignition::physics::dartsim::ShapeFeatureList
 > { };
 
-TEST(EntityManagement_TEST, ConstructEmptyWorld)
+/////////////////////////////////////////////////
+auto LoadEngine()
 {
   ignition::plugin::Loader loader;
   loader.LoadLib(dartsim_plugin_LIB);
@@ -47,8 +54,12 @@ TEST(EntityManagement_TEST, ConstructEmptyWorld)
   ignition::plugin::PluginPtr dartsim =
       loader.Instantiate("ignition::physics::dartsim::Plugin");
 
-  auto engine =
-      ignition::physics::RequestEngine3d<TestFeatureList>::From(dartsim);
+  return ignition::physics::RequestEngine3d<TestFeatureList>::From(dartsim);
+}
+
+TEST(EntityManagement_TEST, ConstructEmptyWorld)
+{
+  auto engine = LoadEngine();
   ASSERT_NE(nullptr, engine);
 
   auto world = engine->ConstructEmptyWorld("empty world");
@@ -187,14 +198,7 @@ TEST(EntityManagement_TEST, ConstructEmptyWorld)
 
 TEST(EntityManagement_TEST, RemoveEntities)
 {
-  ignition::plugin::Loader loader;
-  loader.LoadLib(dartsim_plugin_LIB);
-
-  ignition::plugin::PluginPtr dartsim =
-      loader.Instantiate("ignition::physics::dartsim::Plugin");
-
-  auto engine =
-      ignition::physics::RequestEngine3d<TestFeatureList>::From(dartsim);
+  auto engine = LoadEngine();
   ASSERT_NE(nullptr, engine);
 
   auto world = engine->ConstructEmptyWorld("empty world");
@@ -204,6 +208,12 @@ TEST(EntityManagement_TEST, RemoveEntities)
 
   auto modelAlias = world->GetModel(0);
 
+  // Looking the model up by name again gives the same entity
+  auto modelByName = world->GetModel("empty model");
+  ASSERT_NE(nullptr, modelByName);
+  EXPECT_EQ(model->EntityID(), modelByName->EntityID());
+  EXPECT_EQ(model->EntityID(), world->GetModel("empty model")->EntityID());
+
   model->Remove();
   EXPECT_TRUE(model->Removed());
   EXPECT_TRUE(modelAlias->Removed());
@@ -219,6 +229,68 @@ TEST(EntityManagement_TEST, RemoveEntities)
   EXPECT_EQ(0ul, model2->GetIndex());
   world->RemoveModel(0);
   EXPECT_EQ(0ul, world->GetModelCount());
+
+  // A new model that reuses the name of a removed model is found by that name
+  auto model3 = world->ConstructEmptyModel("empty model");
+  ASSERT_NE(nullptr, model3);
+  EXPECT_NE(model->EntityID(), model3->EntityID());
+  ASSERT_NE(nullptr, world->GetModel("empty model"));
+  EXPECT_EQ(model3->EntityID(), world->GetModel("empty model")->EntityID());
+}
+
+TEST(EntityManagement_TEST, SharedMeshShapes)
+{
+  auto engine = LoadEngine();
+  ASSERT_NE(nullptr, engine);
+
+  const std::string meshFilename = IGNITION_PHYSICS_RESOURCE_DIR "/chassis.dae";
+  auto &meshManager = *ignition::common::MeshManager::Instance();
+  auto *mesh = meshManager.Load(meshFilename);
+  ASSERT_NE(nullptr, mesh);
+
+  const Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+  const Eigen::Vector3d scale(0.5, 0.5, 0.5);
+
+  auto world = engine->ConstructEmptyWorld("mesh world");
+  auto model = world->ConstructEmptyModel("mesh model");
+  auto link1 = model->ConstructEmptyLink("link1");
+  auto link2 = model->ConstructEmptyLink("link2");
+  link1->AttachMeshShape("chassis", *mesh);
+  link2->AttachMeshShape("chassis", *mesh);
+  auto scaledShape =
+      link2->AttachMeshShape("small_chassis", *mesh, pose, scale);
+
+  // A world of the same engine reuses the meshes that were already converted
+  auto otherWorld = engine->ConstructEmptyWorld("other mesh world");
+  auto otherModel = otherWorld->ConstructEmptyModel("mesh model");
+  auto link3 = otherModel->ConstructEmptyLink("link3");
+  link3->AttachMeshShape("small_chassis", *mesh, pose, scale);
+
+  const auto skeleton =
+      world->GetDartsimWorld()->getSkeleton("mesh model");
+  const auto otherSkeleton =
+      otherWorld->GetDartsimWorld()->getSkeleton("mesh model");
+  ASSERT_NE(nullptr, skeleton);
+  ASSERT_NE(nullptr, otherSkeleton);
+
+  const auto &fullShape1 = skeleton->getBodyNode("link1")->getShapeNode(0)
+      ->getShape();
+  const auto &fullShape2 = skeleton->getBodyNode("link2")->getShapeNode(0)
+      ->getShape();
+  const auto &scaledShape2 = skeleton->getBodyNode("link2")->getShapeNode(1)
+      ->getShape();
+  const auto &scaledShape3 = otherSkeleton->getBodyNode("link3")
+      ->getShapeNode(0)->getShape();
+
+  EXPECT_EQ(fullShape1, fullShape2);
+  EXPECT_NE(fullShape1, scaledShape2);
+  EXPECT_EQ(scaledShape2, scaledShape3);
+
+  // Sharing the conversion must not affect the reported size of each shape
+  const auto originalMeshSize = mesh->Max() - mesh->Min();
+  const auto scaledSize = scaledShape->GetSize();
+  for (std::size_t i = 0; i < 3; ++i)
+    EXPECT_NEAR(originalMeshSize[i] * scale[i], scaledSize[i], 1e-6);
 }
 
 int main(int argc, char *argv[])
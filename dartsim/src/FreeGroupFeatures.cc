@@ -110,6 +110,8 @@ void FreeGroupFeatures::SetFreeGroupWorldPose(
     const PoseType &_pose)
 {
   const FreeGroupInfo &info = GetCanonicalInfo(_groupID);
+  this->WakeModel(info.link->getSkeleton());
+  this->InvalidateFrameDataCache();
   if (!info.model)
   {
     static_cast<dart::dynamics::FreeJoint*>(info.link->getParentJoint())
@@ -135,6 +137,8 @@ void FreeGroupFeatures::SetFreeGroupWorldLinearVelocity(
     const Identity &_groupID, const LinearVelocity &_linearVelocity)
 {
   const FreeGroupInfo &info = GetCanonicalInfo(_groupID);
+  this->WakeModel(info.link->getSkeleton());
+  this->InvalidateFrameDataCache();
   if (!info.model)
   {
     static_cast<dart::dynamics::FreeJoint*>(info.link->getParentJoint())
@@ -160,6 +164,8 @@ void FreeGroupFeatures::SetFreeGroupWorldAngularVelocity(
     const Identity &_groupID, const AngularVelocity &_angularVelocity)
 {
   const FreeGroupInfo &info = GetCanonicalInfo(_groupID);
+  this->WakeModel(info.link->getSkeleton());
+  this->InvalidateFrameDataCache();
   if (!info.model)
   {
     static_cast<dart::dynamics::FreeJoint*>(info.link->getParentJoint())
@@ -16,6 +16,7 @@
 */
 
 #include <dart/dynamics/BodyNode.hpp>
+#include <dart/dynamics/DegreeOfFreedom.hpp>
 #include <dart/dynamics/Joint.hpp>
 #include <dart/dynamics/FreeJoint.hpp>
 #include <dart/dynamics/PrismaticJoint.hpp>
@@ -28,6 +29,78 @@ namespace ignition {
 namespace physics {
 namespace dartsim {
 
+namespace {
+/////////////////////////////////////////////////
+/// \brief Check that a joint state vector can be applied to a skeleton
+/// as a whole.
+/// \param[in] _skeleton The skeleton that the vector is meant for
+/// \param[in] _values The joint state vector
+/// \param[in] _quantity Name of the quantity, used in error messages
+/// \return True if the vector has one finite entry for each DOF
+bool ValidJointStateVector(
+    const dart::dynamics::SkeletonPtr &_skeleton,
+    const Eigen::VectorXd &_values,
+    const char *_quantity)
+{
+  if (static_cast<std::size_t>(_values.size()) != _skeleton->getNumDofs())
+  {
+    ignerr << "Invalid number of joint " << _quantity << " values ["
+           << _values.size() << "] set on model [" << _skeleton->getName()
+           << "], which has [" << _skeleton->getNumDofs()
+           << "] degrees of freedom. The values will be ignored\n";
+    return false;
+  }
+
+  // Take extra care that the values are finite. A nan can cause the DART
+  // constraint solver to fail, which will in turn either cause a crash or
+  // collisions to fail
+  if (!_values.allFinite())
+  {
+    ignerr << "Invalid joint " << _quantity << " values set on model ["
+           << _skeleton->getName() << "]. The values will be ignored\n";
+    return false;
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////
+/// \brief Apply a joint command vector to every joint of a skeleton that has
+/// degrees of freedom, giving those joints the actuator type that the
+/// commands are meant for. The joint that connects a free-floating skeleton
+/// to the world is left alone, because switching it to a servo would pin the
+/// base of the model in place.
+/// \param[in] _skeleton The skeleton whose joints are commanded
+/// \param[in] _commands One command for each DOF of the skeleton
+/// \param[in] _type The actuator type that the commands are meant for
+void CommandJoints(
+    const dart::dynamics::SkeletonPtr &_skeleton,
+    const Eigen::VectorXd &_commands,
+    const dart::dynamics::Joint::ActuatorType _type)
+{
+  for (std::size_t i = 0; i < _skeleton->getNumJoints(); ++i)
+  {
+    dart::dynamics::Joint *joint = _skeleton->getJoint(i);
+    const std::size_t numDofs = joint->getNumDofs();
+    if (numDofs == 0)
+      continue;
+
+    if (nullptr == joint->getParentBodyNode() &&
+        joint->getType() == dart::dynamics::FreeJoint::getStaticType())
+    {
+      continue;
+    }
+
+    if (joint->getActuatorType() != _type)
+      joint->setActuatorType(_type);
+
+    joint->setCommands(_commands.segment(
+        static_cast<Eigen::Index>(joint->getIndexInSkeleton(0)),
+        static_cast<Eigen::Index>(numDofs)));
+  }
+}
+}
+
 /////////////////////////////////////////////////
 double JointFeatures::GetJointPosition(
     const Identity &_id, const std::size_t _dof) const
@@ -79,7 +152,9 @@ void JointFeatures::SetJointPosition(
            << "]. The value will be ignored\n";
     return;
   }
+  this->WakeModel(joint->getSkeleton());
   joint->setPosition(_dof, _value);
+  this->InvalidateFrameDataCache();
 }
 
 /////////////////////////////////////////////////
@@ -98,7 +173,9 @@ void JointFeatures::SetJointVelocity(
            << "]. The value will be ignored\n";
     return;
   }
+  this->WakeModel(joint->getSkeleton());
   joint->setVelocity(_dof, _value);
+  this->InvalidateFrameDataCache();
 }
 
 /////////////////////////////////////////////////
@@ -117,7 +194,9 @@ void JointFeatures::SetJointAcceleration(
            << "]. The value will be ignored\n";
     return;
   }
+  this->WakeModel(joint->getSkeleton());
   joint->setAcceleration(_dof, _value);
+  this->InvalidateFrameDataCache();
 }
 
 /////////////////////////////////////////////////
@@ -136,6 +215,7 @@ void JointFeatures::SetJointForce(
            << "]. The value will be ignored\n";
     return;
   }
+  this->WakeModel(joint->getSkeleton());
   if (joint->getActuatorType() != dart::dynamics::Joint::FORCE)
   {
     joint->setActuatorType(dart::dynamics::Joint::FORCE);
@@ -159,6 +239,7 @@ void JointFeatures::SetJointVelocityCommand(
            << "]. The command will be ignored\n";
     return;
   }
+  this->WakeModel(joint->getSkeleton());
   if (joint->getActuatorType() != dart::dynamics::Joint::SERVO)
   {
     joint->setActuatorType(dart::dynamics::Joint::SERVO);
@@ -190,16 +271,20 @@ Pose3d JointFeatures::GetJointTransformToChild(const Identity &_id) const
 void JointFeatures::SetJointTransformFromParent(
     const Identity &_id, const Pose3d &_pose)
 {
-  this->ReferenceInterface<JointInfo>(_id)
-      ->joint->setTransformFromParentBodyNode(_pose);
+  auto joint = this->ReferenceInterface<JointInfo>(_id)->joint;
+  this->WakeModel(joint->getSkeleton());
+  joint->setTransformFromParentBodyNode(_pose);
+  this->InvalidateFrameDataCache();
 }
 
 /////////////////////////////////////////////////
 void JointFeatures::SetJointTransformToChild(
     const Identity &_id, const Pose3d &_pose)
 {
-  this->ReferenceInterface<JointInfo>(_id)
-      ->joint->setTransformFromChildBodyNode(_pose.inverse());
+  auto joint = this->ReferenceInterface<JointInfo>(_id)->joint;
+  this->WakeModel(joint->getSkeleton());
+  joint->setTransformFromChildBodyNode(_pose.inverse());
+  this->InvalidateFrameDataCache();
 }
 
 /////////////////////////////////////////////////
@@ -275,6 +360,7 @@ void JointFeatures::DetachJoint(const Identity &_jointId)
   // TODO(addisu) Remove incrementVersion once DART has been updated to
   // internally increment the BodyNode's version after moveTo.
   child->incrementVersion();
+  this->InvalidateFrameDataCache();
 }
 
 /////////////////////////////////////////////////
@@ -324,6 +410,7 @@ Identity JointFeatures::AttachFixedJoint(
   // TODO(addisu) Remove incrementVersion once DART has been updated to
   // internally increment the BodyNode's version after moveTo.
   bn->incrementVersion();
+  this->InvalidateFrameDataCache();
   return this->GenerateIdentity(jointID, this->joints.at(jointID));
 }
 
@@ -345,9 +432,11 @@ Identity JointFeatures::CastToFreeJoint(
 void JointFeatures::SetFreeJointRelativeTransform(
     const Identity &_jointID, const Pose3d &_pose)
 {
-  static_cast<dart::dynamics::FreeJoint *>(
-      this->ReferenceInterface<JointInfo>(_jointID)->joint.get())
+  auto joint = this->ReferenceInterface<JointInfo>(_jointID)->joint;
+  this->WakeModel(joint->getSkeleton());
+  static_cast<dart::dynamics::FreeJoint *>(joint.get())
       ->setRelativeTransform(_pose);
+  this->InvalidateFrameDataCache();
 }
 
 /////////////////////////////////////////////////
@@ -416,6 +505,7 @@ Identity JointFeatures::AttachRevoluteJoint(
   // TODO(addisu) Remove incrementVersion once DART has been updated to
   // internally increment the BodyNode's version after moveTo.
   bn->incrementVersion();
+  this->InvalidateFrameDataCache();
   return this->GenerateIdentity(jointID, this->joints.at(jointID));
 }
 
@@ -485,9 +575,105 @@ Identity JointFeatures::AttachPrismaticJoint(
   // TODO(addisu) Remove incrementVersion once DART has been updated to
   // internally increment the BodyNode's version after moveTo.
   bn->incrementVersion();
+  this->InvalidateFrameDataCache();
   return this->GenerateIdentity(jointID, this->joints.at(jointID));
 }
 
+/////////////////////////////////////////////////
+std::size_t JointFeatures::GetModelDofCount(const Identity &_modelID) const
+{
+  return this->ReferenceInterface<ModelInfo>(_modelID)->model->getNumDofs();
+}
+
+/////////////////////////////////////////////////
+std::vector<ModelDof> JointFeatures::GetModelDofTable(
+    const Identity &_modelID) const
+{
+  const auto &skeleton = this->ReferenceInterface<ModelInfo>(_modelID)->model;
+
+  std::vector<ModelDof> table;
+  table.reserve(skeleton->getNumDofs());
+  for (std::size_t i = 0; i < skeleton->getNumDofs(); ++i)
+  {
+    const dart::dynamics::DegreeOfFreedom *dof = skeleton->getDof(i);
+    table.push_back({dof->getJoint()->getName(), dof->getIndexInJoint()});
+  }
+
+  return table;
+}
+
+/////////////////////////////////////////////////
+Eigen::VectorXd JointFeatures::GetModelJointPositions(
+    const Identity &_modelID) const
+{
+  return this->ReferenceInterface<ModelInfo>(_modelID)->model->getPositions();
+}
+
+/////////////////////////////////////////////////
+Eigen::VectorXd JointFeatures::GetModelJointVelocities(
+    const Identity &_modelID) const
+{
+  return this->ReferenceInterface<ModelInfo>(_modelID)
+      ->model->getVelocities();
+}
+
+/////////////////////////////////////////////////
+Eigen::VectorXd JointFeatures::GetModelJointForces(
+    const Identity &_modelID) const
+{
+  return this->ReferenceInterface<ModelInfo>(_modelID)->model->getForces();
+}
+
+/////////////////////////////////////////////////
+void JointFeatures::SetModelJointPositions(
+    const Identity &_modelID, const Eigen::VectorXd &_positions)
+{
+  const auto &skeleton = this->ReferenceInterface<ModelInfo>(_modelID)->model;
+  if (!ValidJointStateVector(skeleton, _positions, "position"))
+    return;
+
+  this->WakeModel(skeleton);
+  skeleton->setPositions(_positions);
+  this->InvalidateFrameDataCache();
+}
+
+/////////////////////////////////////////////////
+void JointFeatures::SetModelJointVelocities(
+    const Identity &_modelID, const Eigen::VectorXd &_velocities)
+{
+  const auto &skeleton = this->ReferenceInterface<ModelInfo>(_modelID)->model;
+  if (!ValidJointStateVector(skeleton, _velocities, "velocity"))
+    return;
+
+  this->WakeModel(skeleton);
+  skeleton->setVelocities(_velocities);
+  this->InvalidateFrameDataCache();
+}
+
+/////////////////////////////////////////////////
+void JointFeatures::SetModelJointForces(
+    const Identity &_modelID, const Eigen::VectorXd &_forces)
+{
+  const auto &skeleton = this->ReferenceInterface<ModelInfo>(_modelID)->model;
+  if (!ValidJointStateVector(skeleton, _forces, "force"))
+    return;
+
+  this->WakeModel(skeleton);
+  CommandJoints(skeleton, _forces, dart::dynamics::Joint::FORCE);
+}
+
+/////////////////////////////////////////////////
+void JointFeatures::SetModelJointVelocityCommands(
+    const Identity &_modelID, const Eigen::VectorXd &_velocities)
+{
+  const auto &skeleton = this->ReferenceInterface<ModelInfo>(_modelID)->model;
+  if (!ValidJointStateVector(skeleton, _velocities, "velocity command"))
+    return;
+
+  this->WakeModel(skeleton);
+  CommandJoints(skeleton, _velocities, dart::dynamics::Joint::SERVO);
+}
+
 }
 }
 }
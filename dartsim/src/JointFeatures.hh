@@ -19,10 +19,12 @@
 #define IGNITION_PHYSICS_DARTSIM_SRC_JOINTFEATURES_HH_
 
 #include <string>
+#include <vector>
 
 #include <ignition/physics/Joint.hh>
 #include <ignition/physics/FixedJoint.hh>
 #include <ignition/physics/FreeJoint.hh>
+#include <ignition/physics/ModelJointState.hh>
 #include <ignition/physics/PrismaticJoint.hh>
 #include <ignition/physics/RevoluteJoint.hh>
 
@@ -52,7 +54,10 @@ struct JointFeatureList : FeatureList<
   GetPrismaticJointProperties,
   AttachPrismaticJointFeature,
 
-  SetJointVelocityCommandFeature
+  SetJointVelocityCommandFeature,
+
+  GetModelJointState,
+  SetModelJointState
 > { };
 
 class JointFeatures :
@@ -171,6 +176,34 @@ class JointFeatures :
   public: void SetJointVelocityCommand(
       const Identity &_id, const std::size_t _dof,
       const double _value) override;
+
+  // ----- Model Joint State -----
+  public: std::size_t GetModelDofCount(
+      const Identity &_modelID) const override;
+
+  public: std::vector<ModelDof> GetModelDofTable(
+      const Identity &_modelID) const override;
+
+  public: Eigen::VectorXd GetModelJointPositions(
+      const Identity &_modelID) const override;
+
+  public: Eigen::VectorXd GetModelJointVelocities(
+      const Identity &_modelID) const override;
+
+  public: Eigen::VectorXd GetModelJointForces(
+      const Identity &_modelID) const override;
+
+  public: void SetModelJointPositions(
+      const Identity &_modelID, const Eigen::VectorXd &_positions) override;
+
+  public: void SetModelJointVelocities(
+      const Identity &_modelID, const Eigen::VectorXd &_velocities) override;
+
+  public: void SetModelJointForces(
+      const Identity &_modelID, const Eigen::VectorXd &_forces) override;
+
+  public: void SetModelJointVelocityCommands(
+      const Identity &_modelID, const Eigen::VectorXd &_velocities) override;
 };
 
 }
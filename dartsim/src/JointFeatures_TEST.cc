@@ -16,6 +16,7 @@
  */
 
 #include <dart/dynamics/BodyNode.hpp>
+#include <dart/dynamics/FreeJoint.hpp>
 #include <dart/dynamics/Skeleton.hpp>
 #include <dart/simulation/World.hpp>
 
@@ -35,6 +36,7 @@
 #include <ignition/physics/FixedJoint.hh>
 #include <ignition/physics/GetEntities.hh>
 #include <ignition/physics/Joint.hh>
+#include <ignition/physics/ModelJointState.hh>
 #include <ignition/physics/RevoluteJoint.hh>
 #include <ignition/physics/dartsim/World.hh>
 #include <ignition/physics/sdf/ConstructModel.hh>
@@ -58,9 +60,11 @@ using TestFeatureList = ignition::physics::FeatureList<
   physics::FreeJointCast,
   physics::GetBasicJointState,
   physics::GetEntities,
+  physics::GetModelJointState,
   physics::RevoluteJointCast,
   physics::SetBasicJointState,
   physics::SetJointVelocityCommandFeature,
+  physics::SetModelJointState,
   physics::sdf::ConstructSdfModel,
   physics::sdf::ConstructSdfWorld
 >;
@@ -163,6 +167,158 @@ TEST_F(JointFeaturesFixture, JointSetCommand)
   }
 }
 
+// Test reading and writing the joint state of a whole model at once
+TEST_F(JointFeaturesFixture, ModelJointState)
+{
+  sdf::Root root;
+  const sdf::Errors errors = root.Load(TEST_WORLD_DIR "test.world");
+  ASSERT_TRUE(errors.empty()) << errors.front();
+
+  auto world = this->engine->ConstructWorld(*root.WorldByIndex(0));
+  auto model = world->GetModel("double_pendulum_with_base");
+  auto upperJoint = model->GetJoint("upper_joint");
+  auto lowerJoint = model->GetJoint("lower_joint");
+
+  // The base is free-floating, so the model has the 6 DOFs of its root joint
+  // followed by one DOF for each revolute joint.
+  const std::size_t dofCount = model->GetDofCount();
+  ASSERT_EQ(8u, dofCount);
+
+  const std::vector<physics::ModelDof> table = model->GetDofTable();
+  ASSERT_EQ(dofCount, table.size());
+  for (std::size_t i = 0; i < 6; ++i)
+    EXPECT_EQ(i, table[i].jointDof);
+  EXPECT_EQ("upper_joint", table[6].jointName);
+  EXPECT_EQ(0u, table[6].jointDof);
+  EXPECT_EQ("lower_joint", table[7].jointName);
+  EXPECT_EQ(0u, table[7].jointDof);
+
+  // The vectors agree with the state of each joint
+  Eigen::VectorXd positions = model->GetJointPositions();
+  ASSERT_EQ(static_cast<int>(dofCount), positions.size());
+  EXPECT_DOUBLE_EQ(upperJoint->GetPosition(0), positions[6]);
+  EXPECT_DOUBLE_EQ(lowerJoint->GetPosition(0), positions[7]);
+
+  positions[6] = 0.5;
+  positions[7] = -0.25;
+  model->SetJointPositions(positions);
+  EXPECT_DOUBLE_EQ(0.5, upperJoint->GetPosition(0));
+  EXPECT_DOUBLE_EQ(-0.25, lowerJoint->GetPosition(0));
+  EXPECT_TRUE(positions.isApprox(model->GetJointPositions()));
+
+  Eigen::VectorXd velocities = Eigen::VectorXd::Zero(dofCount);
+  velocities[7] = 2.0;
+  model->SetJointVelocities(velocities);
+  EXPECT_DOUBLE_EQ(0.0, upperJoint->GetVelocity(0));
+  EXPECT_DOUBLE_EQ(2.0, lowerJoint->GetVelocity(0));
+  EXPECT_TRUE(velocities.isApprox(model->GetJointVelocities()));
+
+  // Vectors of the wrong size or with non-finite entries are ignored
+  // entirely
+  model->SetJointPositions(Eigen::VectorXd::Zero(dofCount - 1));
+  EXPECT_DOUBLE_EQ(0.5, upperJoint->GetPosition(0));
+
+  Eigen::VectorXd invalid = Eigen::VectorXd::Zero(dofCount);
+  invalid[7] = std::numeric_limits<double>::quiet_NaN();
+  model->SetJointPositions(invalid);
+  EXPECT_DOUBLE_EQ(0.5, upperJoint->GetPosition(0));
+  EXPECT_DOUBLE_EQ(-0.25, lowerJoint->GetPosition(0));
+
+  // Forces are applied as commands during the next step, the same way as
+  // Joint::SetForce
+  dart::simulation::WorldPtr dartWorld = world->GetDartsimWorld();
+  const auto *dartJoint =
+      dartWorld->getSkeleton("double_pendulum_with_base")->getJoint(
+          "upper_joint");
+
+  Eigen::VectorXd forces = Eigen::VectorXd::Zero(dofCount);
+  forces[6] = 10.0;
+  model->SetJointForces(forces);
+  EXPECT_EQ(dart::dynamics::Joint::FORCE, dartJoint->getActuatorType());
+  EXPECT_DOUBLE_EQ(10.0, dartJoint->getCommand(0));
+
+  // Velocity commands switch the joints to servo actuators
+  model->SetJointVelocityCommands(Eigen::VectorXd::Zero(dofCount));
+  EXPECT_EQ(dart::dynamics::Joint::SERVO, dartJoint->getActuatorType());
+  EXPECT_DOUBLE_EQ(0.0, dartJoint->getCommand(0));
+
+  // The root joint of the free-floating base is neither switched to a servo
+  // nor commanded, so the base is not pinned in place
+  const auto *rootJoint =
+      dartWorld->getSkeleton("double_pendulum_with_base")->getRootJoint();
+  ASSERT_EQ(dart::dynamics::FreeJoint::getStaticType(), rootJoint->getType());
+  EXPECT_EQ(dart::dynamics::Joint::FORCE, rootJoint->getActuatorType());
+  for (std::size_t i = 0; i < 6; ++i)
+    EXPECT_DOUBLE_EQ(0.0, rootJoint->getCommand(i));
+
+  Eigen::VectorXd commands = Eigen::VectorXd::Constant(dofCount, 1.0);
+  model->SetJointVelocityCommands(commands);
+  EXPECT_EQ(dart::dynamics::Joint::FORCE, rootJoint->getActuatorType());
+  for (std::size_t i = 0; i < 6; ++i)
+    EXPECT_DOUBLE_EQ(0.0, rootJoint->getCommand(i));
+  EXPECT_DOUBLE_EQ(1.0, dartJoint->getCommand(0));
+}
+
+// Test commanding joints and reading joint positions through ForwardStep
+TEST_F(JointFeaturesFixture, StepInputOutput)
+{
+  sdf::Root root;
+  const sdf::Errors errors = root.Load(TEST_WORLD_DIR "test.world");
+  ASSERT_TRUE(errors.empty()) << errors.front();
+
+  auto world = this->engine->ConstructWorld(*root.WorldByIndex(0));
+  auto model = world->GetModel("double_pendulum_with_base");
+  auto upperJoint = model->GetJoint("upper_joint");
+  auto lowerJoint = model->GetJoint("lower_joint");
+
+  physics::ForwardStep::Output output;
+  physics::ForwardStep::State state;
+  physics::ForwardStep::Input input;
+
+  // Command a velocity on the upper joint and a force on the lower joint
+  physics::GeneralizedParameters velocity;
+  velocity.dofs = {upperJoint->EntityID()};
+  velocity.forces = {1.0};
+  input.Get<physics::VelocityControlCommands>().commands.push_back(velocity);
+
+  physics::GeneralizedParameters force;
+  force.dofs = {lowerJoint->EntityID()};
+  force.forces = {std::numeric_limits<double>::quiet_NaN()};
+  input.Get<physics::ApplyGeneralizedForces>().forces.push_back(force);
+
+  output.Get<physics::JointPositions>();
+  world->Step(output, state, input);
+
+  EXPECT_NEAR(1.0, upperJoint->GetVelocity(0), 1e-6);
+
+  // The pose of every link of every model is reported
+  std::size_t linkCount = 0;
+  for (std::size_t i = 0; i < world->GetModelCount(); ++i)
+    linkCount += world->GetModel(i)->GetLinkCount();
+  EXPECT_EQ(linkCount, output.Get<physics::WorldPoses>().entries.size());
+
+  // Joint positions are reported for each DOF of each joint
+  const auto &positions = output.Get<physics::JointPositions>();
+  ASSERT_EQ(positions.dofs.size(), positions.positions.size());
+  bool foundUpper = false;
+  bool foundLower = false;
+  for (std::size_t i = 0; i < positions.dofs.size(); ++i)
+  {
+    if (positions.dofs[i] == upperJoint->EntityID())
+    {
+      foundUpper = true;
+      EXPECT_DOUBLE_EQ(upperJoint->GetPosition(0), positions.positions[i]);
+    }
+    else if (positions.dofs[i] == lowerJoint->EntityID())
+    {
+      foundLower = true;
+      EXPECT_DOUBLE_EQ(lowerJoint->GetPosition(0), positions.positions[i]);
+    }
+  }
+  EXPECT_TRUE(foundUpper);
+  EXPECT_TRUE(foundLower);
+}
+
 // Test detaching joints.
 TEST_F(JointFeaturesFixture, JointDetach)
 {
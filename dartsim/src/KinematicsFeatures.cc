@@ -24,6 +24,72 @@ namespace ignition {
 namespace physics {
 namespace dartsim {
 
+namespace {
+/////////////////////////////////////////////////
+/// \brief Fill the selected fields of _data with the state of _frame
+/// relative to the world.
+void FillFrameData(
+    const dart::dynamics::Frame &_frame,
+    const unsigned int _fields,
+    FrameData3d &_data)
+{
+  if (_fields & FRAME_DATA_POSE)
+    _data.pose = _frame.getWorldTransform();
+
+  if (_fields & FRAME_DATA_VELOCITIES)
+  {
+    _data.linearVelocity = _frame.getLinearVelocity();
+    _data.angularVelocity = _frame.getAngularVelocity();
+  }
+
+  if (_fields & FRAME_DATA_ACCELERATIONS)
+  {
+    _data.linearAcceleration = _frame.getLinearAcceleration();
+    _data.angularAcceleration = _frame.getAngularAcceleration();
+  }
+}
+
+/////////////////////////////////////////////////
+/// \brief Get the number of links of a model, which is the number that
+/// GetLinkCount reports for it.
+std::size_t LinkCount(const ModelInfo &_modelInfo)
+{
+  return _modelInfo.model->getNumBodyNodes() + _modelInfo.weldedLinks.size();
+}
+
+/////////////////////////////////////////////////
+/// \brief Append the frame data of every link of a model to _data, in the
+/// order of their indices in the model. Like GetLink(index), this lists the
+/// BodyNodes of the skeleton first, followed by the links that were welded
+/// into them.
+/// \param[in] _modelInfo The model
+/// \param[in] _frames Map from the entity ID of each welded link to its frame
+/// \param[in] _fields FrameDataFields that should be filled in
+/// \param[out] _data The frame data is appended to this
+void AppendLinkFrameData(
+    const ModelInfo &_modelInfo,
+    const std::unordered_map<std::size_t, const dart::dynamics::Frame*>
+        &_frames,
+    const unsigned int _fields,
+    std::vector<FrameData3d> &_data)
+{
+  const dart::dynamics::Skeleton &skel = *_modelInfo.model;
+  for (std::size_t i = 0; i < skel.getNumBodyNodes(); ++i)
+  {
+    _data.emplace_back();
+    FillFrameData(*skel.getBodyNode(i), _fields, _data.back());
+  }
+
+  for (const std::size_t linkID : _modelInfo.weldedLinks)
+  {
+    _data.emplace_back();
+    const auto frameIt = _frames.find(linkID);
+    if (frameIt != _frames.end())
+      FillFrameData(*frameIt->second, _fields, _data.back());
+  }
+}
+}
+
 /////////////////////////////////////////////////
 FrameData3d KinematicsFeatures::FrameDataRelativeToWorld(
     const FrameID &_id) const
@@ -39,17 +105,95 @@ FrameData3d KinematicsFeatures::FrameDataRelativeToWorld(
     return data;
   }
 
-  const dart::dynamics::Frame *frame = SelectFrame(_id);
+  // The cache is only locked while it is read or written, so that queries
+  // from other threads are not held up while the frame data is computed
+  bool cacheEnabled = false;
+  std::size_t generation = 0;
+  {
+    std::lock_guard<std::mutex> lock(this->frameDataCache.mutex);
+    cacheEnabled = this->frameDataCache.enabled;
+    generation = this->frameDataCache.generation;
+    if (cacheEnabled)
+    {
+      const auto cached = this->frameDataCache.data.find(_id.ID());
+      if (cached != this->frameDataCache.data.end())
+      {
+        ++this->frameDataCache.hits;
+        return cached->second;
+      }
+      ++this->frameDataCache.misses;
+    }
+  }
+
+  FillFrameData(*SelectFrame(_id), FRAME_DATA_ALL, data);
 
-  data.pose = frame->getWorldTransform();
-  data.linearVelocity = frame->getLinearVelocity();
-  data.angularVelocity = frame->getAngularVelocity();
-  data.linearAcceleration = frame->getLinearAcceleration();
-  data.angularAcceleration = frame->getAngularAcceleration();
+  if (cacheEnabled)
+  {
+    std::lock_guard<std::mutex> lock(this->frameDataCache.mutex);
+    if (this->frameDataCache.enabled &&
+        this->frameDataCache.generation == generation)
+    {
+      this->frameDataCache.data.emplace(_id.ID(), data);
+    }
+  }
 
   return data;
 }
 
+/////////////////////////////////////////////////
+FrameData3d KinematicsFeatures::SelectedFrameDataRelativeToWorld(
+    const FrameID &_id, const unsigned int _fields) const
+{
+  // The cache only holds complete frame data, so it is cheaper to fill in
+  // every field once than to bypass it for each partial request.
+  if (_id.IsWorld() || this->FrameDataCacheEnabled())
+    return this->FrameDataRelativeToWorld(_id);
+
+  // Accelerations make dartsim update the spatial accelerations of every
+  // BodyNode up the tree, so they are only computed when they are requested.
+  FrameData3d data;
+  FillFrameData(*SelectFrame(_id), _fields, data);
+  return data;
+}
+
+/////////////////////////////////////////////////
+void KinematicsFeatures::GetWorldLinkFrameData(
+    const Identity &_worldID,
+    std::vector<FrameData3d> &_data,
+    const unsigned int _fields) const
+{
+  _data.clear();
+
+  // Go through the models in the order of their indices in the world
+  const auto modelsIt = this->models.indexInContainerToID.find(_worldID);
+  if (modelsIt == this->models.indexInContainerToID.end())
+    return;
+
+  std::size_t linkCount = 0;
+  for (const std::size_t modelID : modelsIt->second)
+    linkCount += LinkCount(*this->models.at(modelID));
+
+  _data.reserve(linkCount);
+  for (const std::size_t modelID : modelsIt->second)
+  {
+    AppendLinkFrameData(
+        *this->models.at(modelID), this->frames, _fields, _data);
+  }
+}
+
+/////////////////////////////////////////////////
+void KinematicsFeatures::GetModelLinkFrameData(
+    const Identity &_modelID,
+    std::vector<FrameData3d> &_data,
+    const unsigned int _fields) const
+{
+  const ModelInfo &modelInfo = *this->ReferenceInterface<ModelInfo>(_modelID);
+
+  _data.clear();
+  _data.reserve(LinkCount(modelInfo));
+  AppendLinkFrameData(modelInfo, this->frames, _fields, _data);
+}
+
 /////////////////////////////////////////////////
 const dart::dynamics::Frame *KinematicsFeatures::SelectFrame(
     const FrameID &_id) const
@@ -18,8 +18,11 @@
 #ifndef IGNITION_PHYSICS_DARTSIM_SRC_KINEMATICSFEATURES_HH_
 #define IGNITION_PHYSICS_DARTSIM_SRC_KINEMATICSFEATURES_HH_
 
+#include <vector>
+
 #include <ignition/physics/FrameSemantics.hh>
 #include <ignition/physics/FreeGroup.hh>
+#include <ignition/physics/LinkFrameData.hh>
 
 #include "Base.hh"
 
@@ -30,7 +33,8 @@ namespace dartsim {
 struct KinematicsFeatureList : FeatureList<
   LinkFrameSemantics,
   ShapeFrameSemantics,
-  FreeGroupFrameSemantics
+  FreeGroupFrameSemantics,
+  GetLinkFrameDataFeature
 > { };
 
 class KinematicsFeatures :
@@ -39,6 +43,19 @@ class KinematicsFeatures :
 {
   public: FrameData3d FrameDataRelativeToWorld(const FrameID &_id) const;
 
+  public: FrameData3d SelectedFrameDataRelativeToWorld(
+      const FrameID &_id, unsigned int _fields) const override;
+
+  public: void GetWorldLinkFrameData(
+      const Identity &_worldID,
+      std::vector<FrameData3d> &_data,
+      unsigned int _fields) const override;
+
+  public: void GetModelLinkFrameData(
+      const Identity &_modelID,
+      std::vector<FrameData3d> &_data,
+      unsigned int _fields) const override;
+
   public: const dart::dynamics::Frame *SelectFrame(const FrameID &_id) const;
 };
 
@@ -15,21 +15,80 @@
  *
  */
 
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #include <dart/dynamics/BodyNode.hpp>
 #include <dart/dynamics/FreeJoint.hpp>
 
+#include <ignition/common/Profiler.hh>
+
 #include "LinkFeatures.hh"
 
 namespace ignition {
 namespace physics {
 namespace dartsim {
 
+namespace {
+/// \brief Wrenches are only split across threads when there are at least this
+/// many of them for each thread, since starting a thread costs more than
+/// applying a few thousand wrenches.
+const std::size_t kMinWrenchesPerThread = 2048;
+
+/// \brief A wrench entry that has been matched to the BodyNode it acts on
+struct ResolvedWrench
+{
+  dart::dynamics::BodyNode *bn;
+  const LinkInfo *info;
+  std::size_t index;
+};
+
+/////////////////////////////////////////////////
+/// \brief Apply a range of resolved wrenches.
+void ApplyWrenches(
+    const ExternalWrenches3d &_wrenches,
+    std::vector<ResolvedWrench>::const_iterator _begin,
+    std::vector<ResolvedWrench>::const_iterator _end)
+{
+  for (auto it = _begin; it != _end; ++it)
+  {
+    if (!_wrenches.forces.empty())
+    {
+      const Eigen::Vector3d &force = _wrenches.forces[it->index];
+      if (!_wrenches.positions.empty())
+      {
+        it->bn->addExtForce(
+            force, _wrenches.positions[it->index], false, false);
+      }
+      else if (it->info->weldFrame)
+      {
+        // A welded link does not share the origin of its BodyNode
+        it->bn->addExtForce(
+            force, it->info->weldFrame->getWorldTransform().translation(),
+            false, false);
+      }
+      else
+      {
+        it->bn->addExtForce(force, Eigen::Vector3d::Zero(), false, true);
+      }
+    }
+
+    if (!_wrenches.torques.empty())
+      it->bn->addExtTorque(_wrenches.torques[it->index], false);
+  }
+}
+}
+
 /////////////////////////////////////////////////
 void LinkFeatures::AddLinkExternalForceInWorld(
     const Identity &_id, const LinearVectorType &_force,
     const LinearVectorType &_position)
 {
   auto bn = this->ReferenceInterface<LinkInfo>(_id)->link;
+  this->WakeModel(bn->getSkeleton());
   bn->addExtForce(_force, _position, false, false);
 }
 
@@ -38,9 +97,101 @@ void LinkFeatures::AddLinkExternalTorqueInWorld(
     const Identity &_id, const AngularVectorType &_torque)
 {
   auto bn = this->ReferenceInterface<LinkInfo>(_id)->link;
+  this->WakeModel(bn->getSkeleton());
   bn->addExtTorque(_torque, false);
 }
 
+/////////////////////////////////////////////////
+void LinkFeatures::AddWorldExternalWrenches(
+    const Identity &_worldID, const ExternalWrenches3d &_wrenches)
+{
+  IGN_PROFILE("LinkFeatures::AddWorldExternalWrenches");
+  const std::size_t count = _wrenches.links.size();
+  if ((!_wrenches.forces.empty() && _wrenches.forces.size() != count) ||
+      (!_wrenches.torques.empty() && _wrenches.torques.size() != count) ||
+      (!_wrenches.positions.empty() && _wrenches.positions.size() != count))
+  {
+    ignerr << "The arrays of external wrenches applied to world ["
+           << this->worlds.at(_worldID)->getName() << "] have different "
+           << "sizes. The wrenches will be ignored\n";
+    return;
+  }
+
+  // Match every entry to its BodyNode, skipping links of other worlds
+  std::vector<ResolvedWrench> resolved;
+  resolved.reserve(count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    const auto linkIt = this->links.idToObject.find(_wrenches.links[i]);
+    if (linkIt == this->links.idToObject.end())
+      continue;
+
+    DartBodyNode *bn = linkIt->second->link.get();
+    const auto modelIt = this->models.objectToID.find(bn->getSkeleton());
+    if (modelIt == this->models.objectToID.end() ||
+        this->models.idToContainerID.at(modelIt->second) != _worldID.id)
+    {
+      continue;
+    }
+
+    resolved.push_back({bn, linkIt->second.get(), i});
+  }
+
+  // Group the entries by skeleton. Wrenches on different skeletons touch
+  // disjoint DART state, so each group can be applied independently.
+  std::stable_sort(resolved.begin(), resolved.end(),
+      [](const ResolvedWrench &_a, const ResolvedWrench &_b)
+      {
+        return _a.bn->getSkeleton().get() < _b.bn->getSkeleton().get();
+      });
+
+  std::vector<std::vector<ResolvedWrench>::const_iterator> groups;
+  for (auto it = resolved.cbegin(); it != resolved.cend(); ++it)
+  {
+    if (groups.empty() ||
+        (*groups.back()).bn->getSkeleton() != it->bn->getSkeleton())
+    {
+      groups.push_back(it);
+      this->WakeModel(it->bn->getSkeleton());
+    }
+  }
+
+  const std::size_t threadCount = std::min<std::size_t>({
+      std::max(1u, std::thread::hardware_concurrency()),
+      groups.size(),
+      resolved.size() / kMinWrenchesPerThread});
+
+  if (threadCount <= 1)
+  {
+    ApplyWrenches(_wrenches, resolved.cbegin(), resolved.cend());
+    return;
+  }
+
+  // Give each thread a contiguous run of whole groups with roughly the same
+  // number of entries
+  std::vector<std::thread> threads;
+  threads.reserve(threadCount - 1);
+  auto begin = resolved.cbegin();
+  std::size_t group = 0;
+  for (std::size_t t = 1; t < threadCount; ++t)
+  {
+    const auto target = resolved.cbegin() +
+        static_cast<std::ptrdiff_t>(resolved.size() * t / threadCount);
+    while (group < groups.size() && groups[group] < target)
+      ++group;
+    const auto end = group < groups.size() ? groups[group] : resolved.cend();
+    if (end == begin)
+      continue;
+
+    threads.emplace_back(ApplyWrenches, std::cref(_wrenches), begin, end);
+    begin = end;
+  }
+  ApplyWrenches(_wrenches, begin, resolved.cend());
+
+  for (auto &thread : threads)
+    thread.join();
+}
+
 }
 }
 }
@@ -27,7 +27,8 @@ namespace physics {
 namespace dartsim {
 
 struct LinkFeatureList : FeatureList<
-  AddLinkExternalForceTorque
+  AddLinkExternalForceTorque,
+  AddExternalWrenchesFeature
 > { };
 
 class LinkFeatures :
@@ -42,6 +43,11 @@ class LinkFeatures :
 
   public: void AddLinkExternalTorqueInWorld(
       const Identity &_id, const AngularVectorType &_torque) override;
+
+  // ----- Add External Wrenches -----
+  public: void AddWorldExternalWrenches(
+      const Identity &_worldID,
+      const ExternalWrenches3d &_wrenches) override;
 };
 
 }
@@ -18,6 +18,8 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include <ignition/physics/FindFeatures.hh>
 #include <ignition/plugin/Loader.hh>
@@ -41,6 +43,7 @@
 
 struct TestFeatureList : ignition::physics::FeatureList<
     ignition::physics::AddLinkExternalForceTorque,
+    ignition::physics::AddExternalWrenchesFeature,
     ignition::physics::ForwardStep,
     ignition::physics::sdf::ConstructSdfWorld,
     ignition::physics::sdf::ConstructSdfModel,
@@ -287,6 +290,110 @@ TEST_F(LinkFeaturesFixture, LinkForceTorque)
   }
 }
 
+// Test applying wrenches to many links at once.
+TEST_F(LinkFeaturesFixture, ExternalWrenches)
+{
+  auto world = LoadWorld(this->engine, TEST_WORLD_DIR "/empty.sdf",
+                         Eigen::Vector3d::Zero());
+
+  const double mass = 1.0;
+  math::MassMatrix3d massMatrix{mass, math::Vector3d{0.4, 0.4, 0.4},
+                                math::Vector3d::Zero};
+  const Eigen::Matrix3d moi = math::eigen3::convert(massMatrix.Moi());
+
+  // Add spheres rotated by pi about z, so that their local x and y axes point
+  // along -x and -y of the world frame
+  std::vector<physics::Link3dPtr<TestFeatureList>> links;
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    sdf::Model modelSDF;
+    modelSDF.SetName("sphere" + std::to_string(i));
+    modelSDF.SetRawPose(math::Pose3d(2.0 * i, 0, 2, 0, 0, IGN_PI));
+    auto model = world->ConstructModel(modelSDF);
+
+    sdf::Link linkSDF;
+    linkSDF.SetName("sphere_link");
+    linkSDF.SetInertial({massMatrix, math::Pose3d::Zero});
+    links.push_back(model->ConstructLink(linkSDF));
+  }
+
+  ignition::physics::ForwardStep::Input input;
+  ignition::physics::ForwardStep::State state;
+  ignition::physics::ForwardStep::Output output;
+
+  AssertVectorApprox vectorPredicate(1e-4);
+
+  // Apply a force at the origin of the first sphere, a torque to the second
+  // one and an off-center force to the third one
+  const Eigen::Vector3d cmdForce{1, -1, 0};
+  const Eigen::Vector3d cmdTorque{0, 0, 0.1 * IGN_PI};
+  const Eigen::Vector3d offset{0.1, 0.2, 0.3};
+
+  physics::ExternalWrenches3d wrenches;
+  wrenches.links = {links[0]->EntityID(), links[1]->EntityID(),
+                    links[2]->EntityID()};
+  wrenches.forces = {cmdForce, Eigen::Vector3d::Zero(), cmdForce};
+  wrenches.torques = {Eigen::Vector3d::Zero(), cmdTorque,
+                      Eigen::Vector3d::Zero()};
+  wrenches.positions = {Eigen::Vector3d(0, 0, 2), Eigen::Vector3d(2, 0, 2),
+                        Eigen::Vector3d(4, 0, 2) + offset};
+  world->AddExternalWrenches(wrenches);
+
+  world->Step(output, state, input);
+
+  {
+    const auto frameData0 = links[0]->FrameDataRelativeToWorld();
+    EXPECT_PRED_FORMAT2(vectorPredicate, cmdForce,
+                        mass * frameData0.linearAcceleration);
+    EXPECT_PRED_FORMAT2(vectorPredicate, Eigen::Vector3d::Zero(),
+                        moi * frameData0.angularAcceleration);
+
+    const auto frameData1 = links[1]->FrameDataRelativeToWorld();
+    EXPECT_PRED_FORMAT2(vectorPredicate, Eigen::Vector3d::Zero(),
+                        mass * frameData1.linearAcceleration);
+    EXPECT_PRED_FORMAT2(vectorPredicate, cmdTorque,
+                        moi * frameData1.angularAcceleration);
+
+    const auto frameData2 = links[2]->FrameDataRelativeToWorld();
+    EXPECT_PRED_FORMAT2(vectorPredicate, cmdForce,
+                        mass * frameData2.linearAcceleration);
+    EXPECT_PRED_FORMAT2(vectorPredicate, offset.cross(cmdForce),
+                        moi * frameData2.angularAcceleration);
+  }
+
+  // Arrays of mismatched sizes are ignored entirely
+  wrenches.torques.pop_back();
+  world->AddExternalWrenches(wrenches);
+  world->Step(output, state, input);
+  for (const auto &link : links)
+  {
+    EXPECT_PRED_FORMAT2(vectorPredicate, Eigen::Vector3d::Zero(),
+                        link->FrameDataRelativeToWorld().linearAcceleration);
+  }
+
+  // Force-torques can also be passed as an input of ForwardStep, in the
+  // frame of the link
+  physics::ForceTorque forceTorque;
+  forceTorque.body = links[0]->EntityID();
+  forceTorque.force.vec = math::eigen3::convert(cmdForce);
+  forceTorque.force.inCoordinatesOf = forceTorque.body;
+  forceTorque.torque.vec = math::Vector3d::Zero;
+  forceTorque.torque.inCoordinatesOf = physics::FrameID::World().ID();
+  forceTorque.location.point = math::Vector3d::Zero;
+  forceTorque.location.relativeTo = forceTorque.body;
+  forceTorque.location.inCoordinatesOf = forceTorque.body;
+  input.Get<physics::ApplyExternalForceTorques>().entries.push_back(
+      forceTorque);
+
+  world->Step(output, state, input);
+  {
+    const Eigen::Vector3d expectedForce =
+        Eigen::AngleAxisd(IGN_PI, Eigen::Vector3d::UnitZ()) * cmdForce;
+    EXPECT_PRED_FORMAT2(vectorPredicate, expectedForce,
+        mass * links[0]->FrameDataRelativeToWorld().linearAcceleration);
+  }
+}
+
 TEST_F(LinkFeaturesFixture, AxisAlignedBoundingBox)
 {
   auto world =
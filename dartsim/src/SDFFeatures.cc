@@ -17,9 +17,13 @@
 
 #include "SDFFeatures.hh"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <dart/constraint/ConstraintSolver.hpp>
 #include <dart/dynamics/BallJoint.hpp>
@@ -50,6 +54,7 @@
 #include <sdf/Material.hh>
 #include <sdf/Mesh.hh>
 #include <sdf/Model.hh>
+#include <sdf/Physics.hh>
 #include <sdf/Sphere.hh>
 #include <sdf/Visual.hh>
 #include <sdf/World.hh>
@@ -229,6 +234,62 @@ static dart::dynamics::UniversalJoint *ConstructUniversalJoint(
   return _child->moveTo<dart::dynamics::UniversalJoint>(_parent, properties);
 }
 
+/////////////////////////////////////////////////
+/// \brief Find the links of a model that are rigidly attached to another link
+/// of the same model by a fixed joint.
+/// \return Map from the name of each such link to the name of the link at the
+/// top of its chain of fixed joints, whose BodyNode it can be welded into.
+static std::unordered_map<std::string, std::string> FindWeldedLinks(
+    const ::sdf::Model &_sdfModel)
+{
+  // Map from the child link of a fixed joint to the parent link of that joint
+  std::unordered_map<std::string, std::string> fixedParent;
+  std::unordered_map<std::string, std::size_t> parentJointCount;
+  for (std::size_t i = 0; i < _sdfModel.JointCount(); ++i)
+  {
+    const ::sdf::Joint *sdfJoint = _sdfModel.JointByIndex(i);
+    if (!sdfJoint)
+      continue;
+
+    const std::string &parent = sdfJoint->ParentLinkName();
+    const std::string &child = sdfJoint->ChildLinkName();
+    ++parentJointCount[child];
+
+    if (::sdf::JointType::FIXED == sdfJoint->Type() && parent != child &&
+        _sdfModel.LinkNameExists(parent) && _sdfModel.LinkNameExists(child))
+    {
+      fixedParent[child] = parent;
+    }
+  }
+
+  std::unordered_map<std::string, std::string> weldedLinks;
+  for (const auto &[child, parent] : fixedParent)
+  {
+    // A link with more than one parent joint closes a kinematic loop. Leave it
+    // alone so that BuildSdfJoint reports it the usual way.
+    if (parentJointCount[child] > 1)
+      continue;
+
+    std::string root = parent;
+    std::size_t steps = 0;
+    for (auto it = fixedParent.find(root);
+         it != fixedParent.end() && parentJointCount[root] == 1
+         && steps <= fixedParent.size();
+         it = fixedParent.find(root), ++steps)
+    {
+      root = it->second;
+    }
+
+    // The fixed joints form a cycle, so there is no link to weld into
+    if (steps > fixedParent.size())
+      continue;
+
+    weldedLinks[child] = root;
+  }
+
+  return weldedLinks;
+}
+
 /////////////////////////////////////////////////
 struct ShapeAndTransform
 {
@@ -312,6 +373,55 @@ static ShapeAndTransform ConstructGeometry(
 
   return {nullptr};
 }
+
+/////////////////////////////////////////////////
+/// \brief Resolve the poses of a link and of its collisions.
+/// \param[in] _sdfLink The link
+/// \param[out] _poses Receives the poses
+void ResolveSdfLinkPoses(const ::sdf::Link &_sdfLink, ResolvedSdfPoses &_poses)
+{
+  _poses.links[&_sdfLink] = ResolveSdfPose(_sdfLink.SemanticPose());
+  for (std::size_t i = 0; i < _sdfLink.CollisionCount(); ++i)
+  {
+    const ::sdf::Collision *collision = _sdfLink.CollisionByIndex(i);
+    if (collision)
+      _poses.collisions[collision] = ResolveSdfPose(collision->SemanticPose());
+  }
+}
+
+/////////////////////////////////////////////////
+/// \brief Read what is needed to build a model from its SDF.
+/// \param[in] _sdfModel The model
+/// \param[in] _weldFixedJoints Whether links that hang from a fixed joint are
+/// welded into the BodyNode of another link
+/// \return The prepared model
+PreparedSdfModel PrepareSdfModel(
+    const ::sdf::Model &_sdfModel, const bool _weldFixedJoints)
+{
+  PreparedSdfModel prepared;
+  prepared.sdfModel = &_sdfModel;
+  prepared.pose = ResolveSdfPose(_sdfModel.SemanticPose());
+
+  for (std::size_t i = 0; i < _sdfModel.LinkCount(); ++i)
+    ResolveSdfLinkPoses(*_sdfModel.LinkByIndex(i), prepared.poses);
+
+  for (std::size_t i = 0; i < _sdfModel.JointCount(); ++i)
+  {
+    const ::sdf::Joint *sdfJoint = _sdfModel.JointByIndex(i);
+    if (sdfJoint)
+    {
+      prepared.poses.joints[sdfJoint] =
+          ResolveSdfPose(sdfJoint->SemanticPose());
+    }
+  }
+
+  // Links that are rigidly attached to another link are merged into the
+  // BodyNode of that link instead of getting one of their own
+  if (_weldFixedJoints)
+    prepared.weldedLinks = FindWeldedLinks(_sdfModel);
+
+  return prepared;
+}
 }
 
 /////////////////////////////////////////////////
@@ -325,9 +435,31 @@ Identity SDFFeatures::ConstructSdfWorld(
 
   world->setGravity(ignition::math::eigen3::convert(_sdfWorld.Gravity()));
 
-  // TODO(MXG): Add a Physics class to the SDFormat DOM and then parse that
-  // information here. For now, we'll just use dartsim's default physics
-  // parameters.
+  // The SDFormat DOM does not cover the dartsim specific physics parameters
+  // yet, so read them from the element of the default physics profile. Only
+  // parameters that are present in the file are applied, so that worlds
+  // without them keep the defaults of ConstructEmptyWorld.
+  const ::sdf::Physics *physics = _sdfWorld.PhysicsDefault();
+  if (physics && physics->Element() &&
+      physics->Element()->HasElement("dart"))
+  {
+    const ::sdf::ElementPtr dartElem = physics->Element()->GetElement("dart");
+    if (dartElem->HasElement("collision_detector"))
+    {
+      this->SetWorldCollisionDetector(worldID,
+          dartElem->Get<std::string>("collision_detector"));
+    }
+
+    if (dartElem->HasElement("solver"))
+    {
+      const ::sdf::ElementPtr solverElem = dartElem->GetElement("solver");
+      if (solverElem->HasElement("solver_type"))
+      {
+        this->SetWorldSolver(worldID,
+            solverElem->Get<std::string>("solver_type"));
+      }
+    }
+  }
 
   for (std::size_t i=0; i < _sdfWorld.ModelCount(); ++i)
   {
@@ -339,6 +471,10 @@ Identity SDFFeatures::ConstructSdfWorld(
     this->ConstructSdfModel(worldID, *model);
   }
 
+  // Remember the state of the freshly loaded world so that it can be reset
+  // without being reconstructed.
+  this->SaveWorldResetState(worldID);
+
   return worldID;
 }
 
@@ -355,54 +491,139 @@ Identity SDFFeatures::ConstructSdfModel(
     return this->GenerateInvalidId();
   }
 
+  return this->CommitSdfModel(_worldID, this->BuildSdfModel(
+      PrepareSdfModel(_sdfModel, this->weldFixedJoints)));
+}
+
+/////////////////////////////////////////////////
+PendingModel SDFFeatures::BuildSdfModel(
+    const PreparedSdfModel &_prepared) const
+{
+  const ::sdf::Model &sdfModel = *_prepared.sdfModel;
+  const ResolvedSdfPoses &poses = _prepared.poses;
+  const auto &weldedLinks = _prepared.weldedLinks;
+
   dart::dynamics::SkeletonPtr model =
-      dart::dynamics::Skeleton::create(_sdfModel.Name());
+      dart::dynamics::Skeleton::create(sdfModel.Name());
 
   dart::dynamics::SimpleFramePtr modelFrame =
       dart::dynamics::SimpleFrame::createShared(
         dart::dynamics::Frame::World(),
-        _sdfModel.Name()+"_frame",
-        ResolveSdfPose(_sdfModel.SemanticPose()));
+        sdfModel.Name()+"_frame",
+        _prepared.pose);
 
   // Set canonical link name
-  auto [modelID, modelInfo] = this->AddModel( // NOLINT
-      {model, modelFrame, _sdfModel.CanonicalLinkName()}, _worldID);
+  PendingModel pending;
+  pending.info = {model, modelFrame, sdfModel.CanonicalLinkName()};
+  const ModelInfo &modelInfo = pending.info;
+  std::vector<PendingEntity> &entities = pending.entities;
 
-  model->setMobile(!_sdfModel.Static());
-  model->setSelfCollisionCheck(_sdfModel.SelfCollide());
-
-  auto modelIdentity =
-      this->GenerateIdentity(modelID, this->models.at(modelID));
+  model->setMobile(!sdfModel.Static());
+  model->setSelfCollisionCheck(sdfModel.SelfCollide());
 
   // First, construct all links
-  for (std::size_t i=0; i < _sdfModel.LinkCount(); ++i)
+  for (std::size_t i=0; i < sdfModel.LinkCount(); ++i)
   {
-    this->FindOrConstructLink(
-          model, modelIdentity, _sdfModel, _sdfModel.LinkByIndex(i)->Name());
+    const std::string &linkName = sdfModel.LinkByIndex(i)->Name();
+    if (weldedLinks.find(linkName) == weldedLinks.end())
+      this->FindOrBuildLink(modelInfo, sdfModel, linkName, poses, entities);
   }
 
+  // The BodyNodes now exist, so weld the remaining links into them
+  for (std::size_t i=0; i < sdfModel.LinkCount(); ++i)
+  {
+    const ::sdf::Link *sdfLink = sdfModel.LinkByIndex(i);
+    const auto weldIt = weldedLinks.find(sdfLink->Name());
+    if (weldIt != weldedLinks.end())
+    {
+      this->BuildWeldedSdfLink(modelInfo, *sdfLink,
+            model->getBodyNode(weldIt->second), poses, entities);
+    }
+  }
 
   // Next, join all links that have joints
-  for (std::size_t i=0; i < _sdfModel.JointCount(); ++i)
+  for (std::size_t i=0; i < sdfModel.JointCount(); ++i)
   {
-    const ::sdf::Joint *sdfJoint = _sdfModel.JointByIndex(i);
+    const ::sdf::Joint *sdfJoint = sdfModel.JointByIndex(i);
     if (!sdfJoint)
     {
       ignerr << "The joint with index [" << i << "] in model ["
-             << _sdfModel.Name() << "] is a nullptr. It will be skipped.\n";
+             << sdfModel.Name() << "] is a nullptr. It will be skipped.\n";
       continue;
     }
 
-    dart::dynamics::BodyNode * const parent = this->FindOrConstructLink(
-          model, modelIdentity, _sdfModel, sdfJoint->ParentLinkName());
+    // A welded link only has the fixed joint that it was welded by
+    if (weldedLinks.find(sdfJoint->ChildLinkName()) != weldedLinks.end())
+      continue;
+
+    const auto parentWeldIt = weldedLinks.find(sdfJoint->ParentLinkName());
+    dart::dynamics::BodyNode * const parent = this->FindOrBuildLink(
+          modelInfo, sdfModel,
+          parentWeldIt == weldedLinks.end() ?
+            sdfJoint->ParentLinkName() : parentWeldIt->second,
+          poses, entities);
+
+    dart::dynamics::BodyNode * const child = this->FindOrBuildLink(
+          modelInfo, sdfModel, sdfJoint->ChildLinkName(), poses, entities);
+
+    this->BuildSdfJoint(modelInfo, *sdfJoint, parent, child,
+                        poses.joints.at(sdfJoint), entities);
+  }
+
+  return pending;
+}
+
+/////////////////////////////////////////////////
+Identity SDFFeatures::CommitSdfModel(
+    const Identity &_worldID,
+    const PendingModel &_pending)
+{
+  auto [modelID, modelInfo] = this->AddModel( // NOLINT
+      _pending.info, _worldID);
 
-    dart::dynamics::BodyNode * const child = this->FindOrConstructLink(
-          model, modelIdentity, _sdfModel, sdfJoint->ChildLinkName());
+  this->RegisterEntities(modelInfo, _pending.entities);
 
-    this->ConstructSdfJoint(modelInfo, *sdfJoint, parent, child);
+  if (this->selfCollisionSamples > 0 &&
+      modelInfo.model->getSelfCollisionCheck())
+  {
+    this->ApplySelfCollisionPruning(modelID, this->selfCollisionSamples);
   }
 
-  return modelIdentity;
+  return this->GenerateIdentity(modelID, this->models.at(modelID));
+}
+
+/////////////////////////////////////////////////
+std::vector<std::size_t> SDFFeatures::RegisterEntities(
+    ModelInfo &_modelInfo,
+    const std::vector<PendingEntity> &_entities)
+{
+  std::vector<std::size_t> ids;
+  ids.reserve(_entities.size());
+  for (const PendingEntity &entity : _entities)
+  {
+    if (entity.link && entity.link->weldFrame)
+    {
+      ids.push_back(this->AddWeldedLink(*entity.link, _modelInfo));
+    }
+    else if (entity.link)
+    {
+      ids.push_back(this->AddLink(entity.link->link.get()));
+    }
+    else if (entity.joint)
+    {
+      ids.push_back(this->AddJoint(entity.joint));
+    }
+    else if (entity.shape)
+    {
+      const std::size_t shapeID = this->AddShape(*entity.shape);
+      this->SetCollisionFilterMask(
+            this->GenerateIdentity(shapeID, this->shapes.at(shapeID)),
+            entity.collideBitmask);
+      ids.push_back(shapeID);
+    }
+  }
+
+  return ids;
 }
 
 /////////////////////////////////////////////////
@@ -410,7 +631,27 @@ Identity SDFFeatures::ConstructSdfLink(
     const Identity &_modelID,
     const ::sdf::Link &_sdfLink)
 {
-  const auto &modelInfo = *this->ReferenceInterface<ModelInfo>(_modelID);
+  auto &modelInfo = *this->ReferenceInterface<ModelInfo>(_modelID);
+
+  ResolvedSdfPoses poses;
+  ResolveSdfLinkPoses(_sdfLink, poses);
+
+  std::vector<PendingEntity> entities;
+  this->BuildSdfLink(modelInfo, _sdfLink, poses, entities);
+
+  // The link is always the first entity that BuildSdfLink produces
+  const std::size_t linkID =
+      this->RegisterEntities(modelInfo, entities).front();
+  return this->GenerateIdentity(linkID, this->links.at(linkID));
+}
+
+/////////////////////////////////////////////////
+dart::dynamics::BodyNode *SDFFeatures::BuildSdfLink(
+    const ModelInfo &_modelInfo,
+    const ::sdf::Link &_sdfLink,
+    const ResolvedSdfPoses &_poses,
+    std::vector<PendingEntity> &_entities) const
+{
   dart::dynamics::BodyNode::Properties bodyProperties;
   bodyProperties.mName = _sdfLink.Name();
 
@@ -442,30 +683,34 @@ Identity SDFFeatures::ConstructSdfLink(
   // Note: When constructing a link from this function, we always instantiate
   // it as a standalone free body within the model. If it should have any joint
   // constraints, those will be added later.
-  const auto result = modelInfo.model->createJointAndBodyNodePair<
+  const auto result = _modelInfo.model->createJointAndBodyNodePair<
       dart::dynamics::FreeJoint>(nullptr, jointProperties, bodyProperties);
 
   dart::dynamics::FreeJoint * const joint = result.first;
   const Eigen::Isometry3d tf =
-      GetParentModelFrame(modelInfo) * ResolveSdfPose(_sdfLink.SemanticPose());
+      GetParentModelFrame(_modelInfo) * _poses.links.at(&_sdfLink);
 
   joint->setTransform(tf);
 
   dart::dynamics::BodyNode * const bn = result.second;
 
-  const std::size_t linkID = this->AddLink(bn);
-  this->AddJoint(joint);
+  auto linkInfo = std::make_shared<LinkInfo>();
+  linkInfo->link = bn;
+  linkInfo->name = bn->getName();
+  _entities.push_back({linkInfo});
 
-  auto linkIdentity = this->GenerateIdentity(linkID, this->links.at(linkID));
+  PendingEntity jointEntity;
+  jointEntity.joint = joint;
+  _entities.push_back(jointEntity);
 
-  if (_sdfLink.Name() == modelInfo.canonicalLinkName ||
-      (modelInfo.canonicalLinkName.empty() &&
-       modelInfo.model->getNumBodyNodes() == 1))
+  if (_sdfLink.Name() == _modelInfo.canonicalLinkName ||
+      (_modelInfo.canonicalLinkName.empty() &&
+       _modelInfo.model->getNumBodyNodes() == 1))
   {
     // We just added the first link, so this is now the canonical link. We
     // should therefore move the "model frame" from the world onto this new
     // link, while preserving its location in the world frame.
-    const dart::dynamics::SimpleFramePtr &modelFrame = modelInfo.frame;
+    const dart::dynamics::SimpleFramePtr &modelFrame = _modelInfo.frame;
     const Eigen::Isometry3d tf_frame = modelFrame->getWorldTransform();
     modelFrame->setParentFrame(bn);
     modelFrame->setTransform(tf_frame);
@@ -475,19 +720,98 @@ Identity SDFFeatures::ConstructSdfLink(
   {
     const auto collision = _sdfLink.CollisionByIndex(i);
     if (collision)
-      this->ConstructSdfCollision(linkIdentity, *collision);
+    {
+      this->BuildSdfCollision(*linkInfo, *collision,
+                              _poses.collisions.at(collision), _entities);
+    }
   }
 
-  // ign-physics is currently ignoring visuals, so we won't parse them from the
-  // SDF
-//  for (std::size_t i = 0; i < _sdfLink.VisualCount(); ++i)
-//  {
-//    const auto visual = _sdfLink.VisualByIndex(i);
-//    if (visual)
-//      this->ConstructSdfVisual(linkID, *visual);
-//  }
+  // Visuals are not needed for simulation, so they are only built when
+  // ConstructSdfVisual is called for them
 
-  return linkIdentity;
+  return bn;
+}
+
+/////////////////////////////////////////////////
+void SDFFeatures::BuildWeldedSdfLink(
+    const ModelInfo &_modelInfo,
+    const ::sdf::Link &_sdfLink,
+    dart::dynamics::BodyNode * const _body,
+    const ResolvedSdfPoses &_poses,
+    std::vector<PendingEntity> &_entities) const
+{
+  const Eigen::Isometry3d T_link =
+      GetParentModelFrame(_modelInfo) * _poses.links.at(&_sdfLink);
+  const Eigen::Isometry3d body_T_link =
+      _body->getWorldTransform().inverse() * T_link;
+
+  // Fold the inertia of this link into the inertia of the body. Everything is
+  // expressed in the body frame, and the moments are taken about each center
+  // of mass before being shifted to the combined one.
+  const ignition::math::Inertiald &sdfInertia = _sdfLink.Inertial();
+  dart::dynamics::Inertia inertia = _body->getInertia();
+
+  const double bodyMass = inertia.getMass();
+  const double linkMass = sdfInertia.MassMatrix().Mass();
+  const double mass = bodyMass + linkMass;
+
+  if (mass > 0.0)
+  {
+    const Eigen::Vector3d bodyCom = inertia.getLocalCOM();
+    const Eigen::Vector3d linkCom =
+        body_T_link * math::eigen3::convert(sdfInertia.Pose().Pos());
+    const Eigen::Vector3d com = (bodyMass*bodyCom + linkMass*linkCom) / mass;
+
+    const Eigen::Matrix3d R_inertial =
+        body_T_link.linear()
+        * math::eigen3::convert(sdfInertia.Pose().Rot()).toRotationMatrix();
+
+    const auto parallelAxis = [&com](
+        const double _mass, const Eigen::Vector3d &_com) -> Eigen::Matrix3d
+    {
+      const Eigen::Vector3d d = _com - com;
+      return _mass * (d.squaredNorm() * Eigen::Matrix3d::Identity()
+                      - d * d.transpose());
+    };
+
+    const Eigen::Matrix3d moment =
+        inertia.getMoment() + parallelAxis(bodyMass, bodyCom)
+        + R_inertial * math::eigen3::convert(sdfInertia.Moi())
+          * R_inertial.transpose()
+        + parallelAxis(linkMass, linkCom);
+
+    inertia.setMass(mass);
+    inertia.setLocalCOM(com);
+    inertia.setMoment(moment);
+    _body->setInertia(inertia);
+  }
+
+  auto linkInfo = std::make_shared<LinkInfo>();
+  linkInfo->link = _body;
+  linkInfo->name = _sdfLink.Name();
+  linkInfo->weldFrame = dart::dynamics::SimpleFrame::createShared(
+      _body, _body->getName() + ":" + _sdfLink.Name(), body_T_link);
+  _entities.push_back({linkInfo});
+
+  if (_sdfLink.Name() == _modelInfo.canonicalLinkName)
+  {
+    // The model frame follows the canonical link, which now moves with the
+    // body that it was welded into.
+    const dart::dynamics::SimpleFramePtr &modelFrame = _modelInfo.frame;
+    const Eigen::Isometry3d tf_frame = modelFrame->getWorldTransform();
+    modelFrame->setParentFrame(_body);
+    modelFrame->setTransform(tf_frame);
+  }
+
+  for (std::size_t i = 0; i < _sdfLink.CollisionCount(); ++i)
+  {
+    const auto collision = _sdfLink.CollisionByIndex(i);
+    if (collision)
+    {
+      this->BuildSdfCollision(*linkInfo, *collision,
+                              _poses.collisions.at(collision), _entities);
+    }
+  }
 }
 
 /////////////////////////////////////////////////
@@ -495,26 +819,59 @@ Identity SDFFeatures::ConstructSdfJoint(
     const Identity &_modelID,
     const ::sdf::Joint &_sdfJoint)
 {
-  const auto &modelInfo = *this->ReferenceInterface<ModelInfo>(_modelID);
+  auto &modelInfo = *this->ReferenceInterface<ModelInfo>(_modelID);
   dart::dynamics::BodyNode * const parent =
       modelInfo.model->getBodyNode(_sdfJoint.ParentLinkName());
 
   dart::dynamics::BodyNode * const child =
       modelInfo.model->getBodyNode(_sdfJoint.ChildLinkName());
 
-  return ConstructSdfJoint(modelInfo, _sdfJoint, parent, child);
+  std::vector<PendingEntity> entities;
+  if (!this->BuildSdfJoint(modelInfo, _sdfJoint, parent, child,
+                           ResolveSdfPose(_sdfJoint.SemanticPose()), entities))
+  {
+    return this->GenerateInvalidId();
+  }
+
+  const std::size_t jointID =
+      this->RegisterEntities(modelInfo, entities).front();
+  return this->GenerateIdentity(jointID, this->joints.at(jointID));
 }
 
 /////////////////////////////////////////////////
 Identity SDFFeatures::ConstructSdfCollision(
     const Identity &_linkID,
     const ::sdf::Collision &_collision)
+{
+  const auto *linkInfo = this->ReferenceInterface<LinkInfo>(_linkID);
+
+  std::vector<PendingEntity> entities;
+  if (!this->BuildSdfCollision(*linkInfo, _collision,
+                               ResolveSdfPose(_collision.SemanticPose()),
+                               entities))
+  {
+    return this->GenerateInvalidId();
+  }
+
+  auto &modelInfo = *this->models.at(
+      this->models.IdentityOf(linkInfo->link->getSkeleton()));
+  const std::size_t shapeID =
+      this->RegisterEntities(modelInfo, entities).front();
+  return this->GenerateIdentity(shapeID, this->shapes.at(shapeID));
+}
+
+/////////////////////////////////////////////////
+bool SDFFeatures::BuildSdfCollision(
+    const LinkInfo &_linkInfo,
+    const ::sdf::Collision &_collision,
+    const Eigen::Isometry3d &_pose,
+    std::vector<PendingEntity> &_entities) const
 {
   if (!_collision.Geom())
   {
     ignerr << "The geometry element of collision [" << _collision.Name() << "] "
            << "was a nullptr\n";
-    return this->GenerateInvalidId();
+    return false;
   }
 
   const ShapeAndTransform st = ConstructGeometry(*_collision.Geom());
@@ -524,17 +881,19 @@ Identity SDFFeatures::ConstructSdfCollision(
   if (!shape)
   {
     // The geometry element was empty, or the shape type is not supported
-    return this->GenerateInvalidId();
+    return false;
   }
 
-  dart::dynamics::BodyNode *const bn =
-      this->ReferenceInterface<LinkInfo>(_linkID)->link.get();
+  dart::dynamics::BodyNode *const bn = _linkInfo.link.get();
+
+  // A welded link places its shapes relative to its own frame on the BodyNode
+  const Eigen::Isometry3d T_link = WeldOffset(_linkInfo.weldFrame.get());
 
   // NOTE(MXG): Gazebo requires unique collision shape names per Link, but
   // dartsim requires unique ShapeNode names per Skeleton, so we decorate the
   // Collision name for uniqueness sake.
   const std::string internalName =
-      bn->getName() + ":" + _collision.Name();
+      ShapeNodeName(_linkInfo, _collision.Name());
 
   dart::dynamics::ShapeNode * const node =
       bn->createShapeNodeWith<
@@ -589,15 +948,16 @@ Identity SDFFeatures::ConstructSdfCollision(
       collideBitmask = bitmaskElement->Get<int>("collide_bitmask");
   }
 
-  node->setRelativeTransform(ResolveSdfPose(_collision.SemanticPose()) *
-                             tf_shape);
+  node->setRelativeTransform(T_link * _pose * tf_shape);
 
-  const std::size_t shapeID =
-      this->AddShape({node, _collision.Name(), tf_shape});
-  auto identity = this->GenerateIdentity(shapeID, this->shapes.at(shapeID));
+  PendingEntity entity;
+  entity.shape = std::make_shared<ShapeInfo>(
+      ShapeInfo{node, _collision.Name(), tf_shape,
+                _linkInfo.weldFrame.get()});
+  entity.collideBitmask = collideBitmask;
+  _entities.push_back(entity);
 
-  this->SetCollisionFilterMask(identity, collideBitmask);
-  return identity;
+  return true;
 }
 
 /////////////////////////////////////////////////
@@ -605,6 +965,11 @@ Identity SDFFeatures::ConstructSdfVisual(
     const Identity &_linkID,
     const ::sdf::Visual &_visual)
 {
+  // Skip the geometry before it is loaded, which is the expensive part for
+  // mesh visuals
+  if (this->physicsOnlyLoad)
+    return this->GenerateInvalidId();
+
   if (!_visual.Geom())
   {
     ignerr << "The geometry element of visual [" << _visual.Name() << "] was a "
@@ -622,19 +987,21 @@ Identity SDFFeatures::ConstructSdfVisual(
     return this->GenerateInvalidId();
   }
 
-  dart::dynamics::BodyNode *const bn =
-      this->ReferenceInterface<LinkInfo>(_linkID)->link.get();
+  const auto *linkInfo = this->ReferenceInterface<LinkInfo>(_linkID);
+  dart::dynamics::BodyNode *const bn = linkInfo->link.get();
 
   // NOTE(MXG): Gazebo requires unique collision shape names per Link, but
   // dartsim requires unique ShapeNode names per Skeleton, so we decorate the
   // Collision name for uniqueness sake.
-  const std::string internalName = bn->getName() + ":visual:" + _visual.Name();
+  const std::string internalName =
+      ShapeNodeName(*linkInfo, "visual:" + _visual.Name());
 
   dart::dynamics::ShapeNode * const node =
       bn->createShapeNodeWith<dart::dynamics::VisualAspect>(
         shape, internalName);
 
-  node->setRelativeTransform(ResolveSdfPose(_visual.SemanticPose()) * tf_shape);
+  node->setRelativeTransform(WeldOffset(linkInfo->weldFrame.get()) *
+      ResolveSdfPose(_visual.SemanticPose()) * tf_shape);
 
   // TODO(MXG): Are there any other visual parameters that we can do anything
   // with? Do these visual parameters even matter, since dartsim is only
@@ -646,18 +1013,20 @@ Identity SDFFeatures::ConstructSdfVisual(
           Eigen::Vector4d(color.R(), color.G(), color.B(), color.A()));
   }
 
-  const std::size_t shapeID = this->AddShape({node, _visual.Name(), tf_shape});
+  const std::size_t shapeID = this->AddShape(
+      {node, _visual.Name(), tf_shape, linkInfo->weldFrame.get()});
   return this->GenerateIdentity(shapeID, this->shapes.at(shapeID));
 }
 
 /////////////////////////////////////////////////
-dart::dynamics::BodyNode *SDFFeatures::FindOrConstructLink(
-    const dart::dynamics::SkeletonPtr &_model,
-    const Identity &_modelID,
+dart::dynamics::BodyNode *SDFFeatures::FindOrBuildLink(
+    const ModelInfo &_modelInfo,
     const ::sdf::Model &_sdfModel,
-    const std::string &_linkName)
+    const std::string &_linkName,
+    const ResolvedSdfPoses &_poses,
+    std::vector<PendingEntity> &_entities) const
 {
-  dart::dynamics::BodyNode * link = _model->getBodyNode(_linkName);
+  dart::dynamics::BodyNode * link = _modelInfo.model->getBodyNode(_linkName);
   if (link)
     return link;
 
@@ -672,15 +1041,17 @@ dart::dynamics::BodyNode *SDFFeatures::FindOrConstructLink(
     return nullptr;
   }
 
-  return this->links.at(this->ConstructSdfLink(_modelID, *sdfLink))->link.get();
+  return this->BuildSdfLink(_modelInfo, *sdfLink, _poses, _entities);
 }
 
 /////////////////////////////////////////////////
-Identity SDFFeatures::ConstructSdfJoint(
+bool SDFFeatures::BuildSdfJoint(
     const ModelInfo &_modelInfo,
     const ::sdf::Joint &_sdfJoint,
     dart::dynamics::BodyNode * const _parent,
-    dart::dynamics::BodyNode * const _child)
+    dart::dynamics::BodyNode * const _child,
+    const Eigen::Isometry3d &_pose,
+    std::vector<PendingEntity> &_entities) const
 {
   // if a specified link is named "world" but cannot be found, we'll assume the
   // joint is connected to the world
@@ -693,7 +1064,7 @@ Identity SDFFeatures::ConstructSdfJoint(
            << "[" << _modelInfo.model->getName() << "]. This is currently not "
            << "supported\n";
 
-    return this->GenerateInvalidId();
+    return false;
   }
 
   // If either parent or child is null, it's only an error if the link is not
@@ -719,7 +1090,7 @@ Identity SDFFeatures::ConstructSdfJoint(
       msg << "could not be found in that model!\n";
       ignerr << msg.str();
 
-      return this->GenerateInvalidId();
+      return false;
     }
   }
 
@@ -732,7 +1103,7 @@ Identity SDFFeatures::ConstructSdfJoint(
              << _child->getName() << "] as child, but the child link already "
              << "has a parent joint of type [" << childsParentJoint->getType()
              << "].\n";
-      return this->GenerateInvalidId();
+      return false;
     }
     else if (_parent && _parent->descendsFrom(_child))
     {
@@ -740,8 +1111,19 @@ Identity SDFFeatures::ConstructSdfJoint(
       ignerr << "Asked to create a closed kinematic chain between links "
              << "[" << _parent->getName() << "] and [" << _child->getName()
              << "], but that is not supported by the dartsim wrapper yet.\n";
-      return this->GenerateInvalidId();
+      return false;
     }
+
+    // The new joint replaces the FreeJoint of the child, so that FreeJoint
+    // must not be registered. Its address may be reused by a joint that is
+    // built later, which would otherwise be mapped to the wrong entity.
+    const auto freeIt = std::find_if(_entities.begin(), _entities.end(),
+        [&](const PendingEntity &_entity)
+        {
+          return _entity.joint == childsParentJoint;
+        });
+    if (freeIt != _entities.end())
+      _entities.erase(freeIt);
   }
 
   // Save the current transforms of the links so we remember it later
@@ -750,7 +1132,7 @@ Identity SDFFeatures::ConstructSdfJoint(
   const Eigen::Isometry3d T_child = _child->getWorldTransform();
 
   const Eigen::Isometry3d T_joint =
-      _child->getWorldTransform() * ResolveSdfPose(_sdfJoint.SemanticPose());
+      _child->getWorldTransform() * _pose;
 
   const ::sdf::JointType type = _sdfJoint.Type();
   dart::dynamics::Joint *joint = nullptr;
@@ -844,9 +1226,11 @@ Identity SDFFeatures::ConstructSdfJoint(
 
   joint->setTransformFromParentBodyNode(parent_T_prejoint_final);
 
-  const std::size_t jointID = this->AddJoint(joint);
+  PendingEntity entity;
+  entity.joint = joint;
+  _entities.push_back(entity);
 
-  return this->GenerateIdentity(jointID, this->joints.at(jointID));
+  return true;
 }
 
 /////////////////////////////////////////////////
@@ -18,7 +18,10 @@
 #ifndef IGNITION_PHYSICS_DARTSIM_SRC_SDFFEATURES_HH_
 #define IGNITION_PHYSICS_DARTSIM_SRC_SDFFEATURES_HH_
 
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <ignition/physics/sdf/ConstructCollision.hh>
 #include <ignition/physics/sdf/ConstructJoint.hh>
@@ -31,11 +34,73 @@
 
 #include "Base.hh"
 #include "EntityManagementFeatures.hh"
+#include "WorldFeatures.hh"
 
 namespace ignition {
 namespace physics {
 namespace dartsim {
 
+/// \brief An entity that SDFFeatures has built but not registered yet.
+/// Exactly one of link, joint and shape is set.
+struct PendingEntity
+{
+  /// \brief A link. Links that were welded into the BodyNode of another link
+  /// have a weldFrame.
+  std::shared_ptr<LinkInfo> link;
+
+  /// \brief A joint
+  dart::dynamics::Joint *joint = nullptr;
+
+  /// \brief A collision shape
+  std::shared_ptr<ShapeInfo> shape;
+
+  /// \brief The collision filter mask of the shape
+  uint16_t collideBitmask = 0xFF;
+};
+
+/// \brief Poses of the links, joints and collisions of an SDF model, resolved
+/// through the frame graph of the SDF.
+struct ResolvedSdfPoses
+{
+  /// \brief Pose of each link relative to its model
+  std::unordered_map<const ::sdf::Link *, Eigen::Isometry3d> links;
+
+  /// \brief Pose of each joint relative to its child link
+  std::unordered_map<const ::sdf::Joint *, Eigen::Isometry3d> joints;
+
+  /// \brief Pose of each collision relative to its link
+  std::unordered_map<const ::sdf::Collision *, Eigen::Isometry3d> collisions;
+};
+
+/// \brief What SDFFeatures reads from the SDF of a model before it creates
+/// any DART object for it.
+struct PreparedSdfModel
+{
+  /// \brief The SDF of the model
+  const ::sdf::Model *sdfModel = nullptr;
+
+  /// \brief Pose of the model relative to the world
+  Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+
+  /// \brief Poses of the links, joints and collisions of the model
+  ResolvedSdfPoses poses;
+
+  /// \brief Links that are welded into the BodyNode of another link, mapped
+  /// to the name of that link
+  std::unordered_map<std::string, std::string> weldedLinks;
+};
+
+/// \brief A model that SDFFeatures has built from SDF, but not added to a
+/// world yet. Registering the model and its entities assigns their IDs.
+struct PendingModel
+{
+  /// \brief The model, which does not belong to a world yet
+  ModelInfo info;
+
+  /// \brief Entities of the model, in the order that they were built
+  std::vector<PendingEntity> entities;
+};
+
 struct SDFFeatureList : FeatureList<
   sdf::ConstructSdfWorld,
   sdf::ConstructSdfModel,
@@ -47,6 +112,7 @@ struct SDFFeatureList : FeatureList<
 
 class SDFFeatures :
     public virtual EntityManagementFeatures,
+    public virtual WorldFeatures,
     public virtual Implements3d<SDFFeatureList>
 {
   public: Identity ConstructSdfWorld(
@@ -73,23 +139,97 @@ class SDFFeatures :
       const Identity &_linkID,
       const ::sdf::Visual &_visual) override;
 
-  private: dart::dynamics::BodyNode *FindOrConstructLink(
-      const dart::dynamics::SkeletonPtr &_model,
-      const Identity &_modelID,
+  /// \brief Build the skeleton of a model, with all of its links, joints and
+  /// collisions, without registering anything.
+  /// \param[in] _prepared The model, as read from its SDF
+  /// \return The model and the entities that need to be registered
+  private: PendingModel BuildSdfModel(const PreparedSdfModel &_prepared) const;
+
+  /// \brief Add a model that was built by BuildSdfModel to a world and
+  /// register its entities.
+  /// \param[in] _worldID The world to add the model to
+  /// \param[in] _pending The model to add
+  /// \return The identity of the model
+  private: Identity CommitSdfModel(
+      const Identity &_worldID,
+      const PendingModel &_pending);
+
+  /// \brief Register entities that were built for a model which is already
+  /// in a world.
+  /// \param[in] _modelInfo The model that contains the entities
+  /// \param[in] _entities The entities, in the order they were built
+  /// \return The IDs of the entities, in the same order
+  private: std::vector<std::size_t> RegisterEntities(
+      ModelInfo &_modelInfo,
+      const std::vector<PendingEntity> &_entities);
+
+  private: dart::dynamics::BodyNode *FindOrBuildLink(
+      const ModelInfo &_modelInfo,
       const ::sdf::Model &_sdfModel,
-      const std::string &_linkName);
-
-  /// \brief Construct a joint between two input links.
+      const std::string &_linkName,
+      const ResolvedSdfPoses &_poses,
+      std::vector<PendingEntity> &_entities) const;
+
+  /// \brief Build a link as a free body of its model, along with its
+  /// collisions.
+  /// \param[in] _modelInfo The model that contains the link
+  /// \param[in] _sdfLink Contains link parameters
+  /// \param[in] _poses Resolved poses of the link and its collisions
+  /// \param[out] _entities The link, its joint and its collisions are
+  /// appended to this
+  /// \return The BodyNode of the new link
+  private: dart::dynamics::BodyNode *BuildSdfLink(
+      const ModelInfo &_modelInfo,
+      const ::sdf::Link &_sdfLink,
+      const ResolvedSdfPoses &_poses,
+      std::vector<PendingEntity> &_entities) const;
+
+  /// \brief Build a link that is welded into the BodyNode of another link of
+  /// the same model. The inertia and collisions of the link are added to that
+  /// BodyNode, and the link itself is represented by a frame that is rigidly
+  /// attached to it.
+  /// \param[in] _modelInfo The model that contains the link
+  /// \param[in] _sdfLink Contains link parameters
+  /// \param[in] _body The BodyNode to weld the link into
+  /// \param[in] _poses Resolved poses of the link and its collisions
+  /// \param[out] _entities The link and its collisions are appended to this
+  private: void BuildWeldedSdfLink(
+      const ModelInfo &_modelInfo,
+      const ::sdf::Link &_sdfLink,
+      dart::dynamics::BodyNode * const _body,
+      const ResolvedSdfPoses &_poses,
+      std::vector<PendingEntity> &_entities) const;
+
+  /// \brief Build a collision shape on a link.
+  /// \param[in] _linkInfo The link to attach the shape to
+  /// \param[in] _collision Contains collision parameters
+  /// \param[in] _pose Resolved pose of the collision relative to its link
+  /// \param[out] _entities The shape is appended to this, unless it could
+  /// not be built
+  /// \return True if the shape was built
+  private: bool BuildSdfCollision(
+      const LinkInfo &_linkInfo,
+      const ::sdf::Collision &_collision,
+      const Eigen::Isometry3d &_pose,
+      std::vector<PendingEntity> &_entities) const;
+
+  /// \brief Build a joint between two input links.
   /// \param[in] _modelInfo Contains the joint's parent model
   /// \param[in] _sdfJoint Contains joint parameters
   /// \param[in] _parent Pointer to parent link. If nullptr, the parent is
   /// assumed to be world
   /// \param[in] _child Pointer to child link. If nullptr, the child is assumed
   /// to be world
-  private: Identity ConstructSdfJoint(const ModelInfo &_modelInfo,
+  /// \param[in] _pose Resolved pose of the joint relative to its child link
+  /// \param[out] _entities The joint is appended to this, unless it could not
+  /// be built
+  /// \return True if the joint was built
+  private: bool BuildSdfJoint(const ModelInfo &_modelInfo,
       const ::sdf::Joint &_sdfJoint,
       dart::dynamics::BodyNode * const _parent,
-      dart::dynamics::BodyNode * const _child);
+      dart::dynamics::BodyNode * const _child,
+      const Eigen::Isometry3d &_pose,
+      std::vector<PendingEntity> &_entities) const;
 
   private: Eigen::Isometry3d ResolveSdfLinkReferenceFrame(
       const std::string &_frame,
@@ -20,26 +20,39 @@
 #include <dart/dynamics/FreeJoint.hpp>
 #include <dart/dynamics/RevoluteJoint.hpp>
 #include <dart/dynamics/ScrewJoint.hpp>
+#include <dart/dynamics/ShapeNode.hpp>
 #include <dart/dynamics/WeldJoint.hpp>
 
 #include <gtest/gtest.h>
 
+#include <string>
 #include <tuple>
+#include <vector>
 
+#include <ignition/common/Filesystem.hh>
 #include <ignition/plugin/Loader.hh>
 
+#include <ignition/physics/FrameSemantics.hh>
 #include <ignition/physics/GetEntities.hh>
 #include <ignition/physics/Joint.hh>
+#include <ignition/physics/LinkFrameData.hh>
 #include <ignition/physics/RequestEngine.hh>
 
 #include <ignition/physics/sdf/ConstructJoint.hh>
 #include <ignition/physics/sdf/ConstructLink.hh>
 #include <ignition/physics/sdf/ConstructModel.hh>
+#include <ignition/physics/sdf/ConstructVisual.hh>
 #include <ignition/physics/sdf/ConstructWorld.hh>
 
+#include <ignition/physics/dartsim/PhysicsOnlyLoad.hh>
+#include <ignition/physics/dartsim/SelfCollisionPruning.hh>
+#include <ignition/physics/dartsim/WeldFixedJoints.hh>
 #include <ignition/physics/dartsim/World.hh>
 
+#include <sdf/Box.hh>
+#include <sdf/Geometry.hh>
 #include <sdf/Root.hh>
+#include <sdf/Visual.hh>
 #include <sdf/World.hh>
 
 #include <test/Utils.hh>
@@ -58,6 +71,7 @@ struct TestFeatureList : ignition::physics::FeatureList<
 using World = ignition::physics::World3d<TestFeatureList>;
 using WorldPtr = ignition::physics::World3dPtr<TestFeatureList>;
 
+template <typename FeatureList = TestFeatureList>
 auto LoadEngine()
 {
   ignition::plugin::Loader loader;
@@ -67,7 +81,7 @@ auto LoadEngine()
       loader.Instantiate("ignition::physics::dartsim::Plugin");
 
   auto engine =
-      ignition::physics::RequestEngine3d<TestFeatureList>::From(dartsim);
+      ignition::physics::RequestEngine3d<FeatureList>::From(dartsim);
   return engine;
 }
 
@@ -503,6 +517,241 @@ TEST(SDFFeatures_FrameSemantics, ExplicitWorldFrames)
       expPose, link1->getWorldTransform(), 1e-5));
 }
 
+/////////////////////////////////////////////////
+struct WeldFeatureList : ignition::physics::FeatureList<
+    TestFeatureList,
+    ignition::physics::LinkFrameSemantics,
+    ignition::physics::GetLinkFrameDataFeature,
+    ignition::physics::dartsim::WeldFixedJointsFeature
+> { };
+
+// Test that links connected by fixed joints are merged into one BodyNode when
+// welding is turned on, and that the merged links can still be located.
+TEST(SDFFeatures_TEST, WeldFixedJoints)
+{
+  auto engine = LoadEngine<WeldFeatureList>();
+  ASSERT_NE(nullptr, engine);
+  EXPECT_FALSE(engine->GetWeldFixedJoints());
+
+  sdf::Root root;
+  ASSERT_TRUE(root.Load(TEST_WORLD_DIR"/fixed_joint_chain.sdf").empty());
+  const sdf::World *sdfWorld = root.WorldByIndex(0);
+  ASSERT_NE(nullptr, sdfWorld);
+
+  // Without welding, every link gets its own BodyNode
+  {
+    auto world = engine->ConstructWorld(*sdfWorld);
+    const dart::dynamics::SkeletonPtr skeleton =
+        world->GetDartsimWorld()->getSkeleton("robot");
+    ASSERT_NE(nullptr, skeleton);
+    EXPECT_EQ(4u, skeleton->getNumBodyNodes());
+    // The root link also has the FreeJoint that attaches it to the world
+    EXPECT_EQ(4u, world->GetModel("robot")->GetJointCount());
+  }
+
+  engine->SetWeldFixedJoints(true);
+  EXPECT_TRUE(engine->GetWeldFixedJoints());
+
+  auto world = engine->ConstructWorld(*sdfWorld);
+  const dart::dynamics::SkeletonPtr skeleton =
+      world->GetDartsimWorld()->getSkeleton("robot");
+  ASSERT_NE(nullptr, skeleton);
+
+  // mount and sensor are welded into base, arm stays on its revolute joint
+  ASSERT_EQ(2u, skeleton->getNumBodyNodes());
+  dart::dynamics::BodyNode *base = skeleton->getBodyNode("base");
+  ASSERT_NE(nullptr, base);
+  EXPECT_EQ(nullptr, skeleton->getBodyNode("mount"));
+  EXPECT_EQ(nullptr, skeleton->getBodyNode("sensor"));
+  EXPECT_EQ(base, skeleton->getBodyNode("arm")->getParentBodyNode());
+
+  EXPECT_DOUBLE_EQ(4.0, base->getMass());
+  EXPECT_DOUBLE_EQ(5.0, skeleton->getMass());
+  EXPECT_EQ(3u, base->getNumShapeNodes());
+
+  auto model = world->GetModel("robot");
+  EXPECT_EQ(2u, model->GetJointCount());
+  EXPECT_EQ(nullptr, model->GetJoint("mount_joint"));
+  ASSERT_NE(nullptr, model->GetJoint("arm_joint"));
+
+  auto sensor = model->GetLink("sensor");
+  ASSERT_NE(nullptr, sensor);
+  EXPECT_EQ("sensor", sensor->GetName());
+
+  // Welded links are indexed after the links that own a BodyNode
+  const std::vector<std::string> linkNames = {"base", "arm", "mount", "sensor"};
+  ASSERT_EQ(linkNames.size(), model->GetLinkCount());
+  for (std::size_t i = 0; i < linkNames.size(); ++i)
+  {
+    auto link = model->GetLink(i);
+    ASSERT_NE(nullptr, link);
+    EXPECT_EQ(linkNames[i], link->GetName());
+    EXPECT_EQ(i, link->GetIndex());
+  }
+  EXPECT_EQ(nullptr, model->GetLink(linkNames.size()));
+
+  // Each link only has its own shapes, although they share a BodyNode
+  auto baseLink = model->GetLink("base");
+  ASSERT_EQ(1u, baseLink->GetShapeCount());
+  EXPECT_EQ("box", baseLink->GetShape(0)->GetName());
+
+  ASSERT_EQ(1u, sensor->GetShapeCount());
+  auto sensorShape = sensor->GetShape(0);
+  ASSERT_NE(nullptr, sensorShape);
+  EXPECT_EQ("sphere", sensorShape->GetName());
+  EXPECT_EQ(0u, sensorShape->GetIndex());
+  EXPECT_EQ(sensorShape->EntityID(), sensor->GetShape("sphere")->EntityID());
+  EXPECT_EQ(sensor->EntityID(), sensorShape->GetLink()->EntityID());
+
+  Eigen::Isometry3d expPose = Eigen::Isometry3d::Identity();
+  expPose.translate(Eigen::Vector3d(0.5, 0.5, 1.0));
+  expPose.rotate(Eigen::AngleAxisd(IGN_PI_2, Eigen::Vector3d::UnitZ()));
+  EXPECT_TRUE(ignition::physics::test::Equal(
+      expPose, sensor->FrameDataRelativeToWorld().pose, 1e-6));
+
+  // The welded link follows the body that it was welded into
+  auto *freeJoint =
+      dynamic_cast<dart::dynamics::FreeJoint*>(base->getParentJoint());
+  ASSERT_NE(nullptr, freeJoint);
+  Eigen::Isometry3d tf = base->getWorldTransform();
+  tf.translation() += Eigen::Vector3d(1.0, 0.0, 0.0);
+  freeJoint->setTransform(tf);
+
+  expPose.pretranslate(Eigen::Vector3d(1.0, 0.0, 0.0));
+  EXPECT_TRUE(ignition::physics::test::Equal(
+      expPose, sensor->FrameDataRelativeToWorld().pose, 1e-6));
+
+  // The frame data of all links includes the welded links, in the order of
+  // GetLink(index)
+  std::vector<ignition::physics::FrameData3d> data;
+  model->GetLinkFrameData(data);
+  ASSERT_EQ(model->GetLinkCount(), data.size());
+  for (std::size_t i = 0; i < data.size(); ++i)
+  {
+    EXPECT_TRUE(ignition::physics::test::Equal(
+        model->GetLink(i)->FrameDataRelativeToWorld(), data[i], 1e-12));
+  }
+
+  world->GetLinkFrameData(data);
+  ASSERT_EQ(model->GetLinkCount(), data.size());
+  EXPECT_TRUE(ignition::physics::test::Equal(
+      expPose, data[3].pose, 1e-6));
+}
+
+/////////////////////////////////////////////////
+struct PhysicsOnlyFeatureList : ignition::physics::FeatureList<
+    TestFeatureList,
+    ignition::physics::sdf::ConstructSdfVisual,
+    ignition::physics::dartsim::PhysicsOnlyLoadFeature
+> { };
+
+// Test that visuals are skipped in physics-only mode while the simulated
+// parts of the link are left untouched
+TEST(SDFFeatures_TEST, PhysicsOnlyLoad)
+{
+  auto engine = LoadEngine<PhysicsOnlyFeatureList>();
+  ASSERT_NE(nullptr, engine);
+  EXPECT_FALSE(engine->GetPhysicsOnlyLoad());
+
+  sdf::Root root;
+  ASSERT_TRUE(root.Load(TEST_WORLD_DIR"/fixed_joint_chain.sdf").empty());
+  const sdf::World *sdfWorld = root.WorldByIndex(0);
+  ASSERT_NE(nullptr, sdfWorld);
+
+  sdf::Geometry geometry;
+  geometry.SetType(sdf::GeometryType::BOX);
+  geometry.SetBoxShape(sdf::Box());
+  sdf::Visual visual;
+  visual.SetName("box_visual");
+  visual.SetGeom(geometry);
+
+  auto world = engine->ConstructWorld(*sdfWorld);
+  dart::dynamics::BodyNode *base =
+      world->GetDartsimWorld()->getSkeleton("robot")->getBodyNode("base");
+  ASSERT_NE(nullptr, base);
+  const std::size_t shapeCount = base->getNumShapeNodes();
+
+  auto link = world->GetModel("robot")->GetLink("base");
+  EXPECT_TRUE(link->ConstructVisual(visual));
+  EXPECT_EQ(shapeCount + 1, base->getNumShapeNodes());
+
+  engine->SetPhysicsOnlyLoad(true);
+  EXPECT_TRUE(engine->GetPhysicsOnlyLoad());
+
+  auto physicsWorld = engine->ConstructWorld(*sdfWorld);
+  dart::dynamics::BodyNode *physicsBase =
+      physicsWorld->GetDartsimWorld()->getSkeleton("robot")
+      ->getBodyNode("base");
+  ASSERT_NE(nullptr, physicsBase);
+
+  auto physicsLink = physicsWorld->GetModel("robot")->GetLink("base");
+  EXPECT_FALSE(physicsLink->ConstructVisual(visual));
+  EXPECT_EQ(shapeCount, physicsBase->getNumShapeNodes());
+
+  // The collisions and inertia are the same as in a regular load
+  EXPECT_EQ(base->getMass(), physicsBase->getMass());
+  EXPECT_EQ(base->getInertia().getSpatialTensor(),
+            physicsBase->getInertia().getSpatialTensor());
+  EXPECT_EQ(base->getNumShapeNodesWith<dart::dynamics::CollisionAspect>(),
+            physicsBase->getNumShapeNodesWith<
+              dart::dynamics::CollisionAspect>());
+}
+
+/////////////////////////////////////////////////
+struct PruningFeatureList : ignition::physics::FeatureList<
+    TestFeatureList,
+    ignition::physics::dartsim::SelfCollisionPruningFeature
+> { };
+
+// Test that link pairs of a self-colliding model that can never touch are
+// found at load time, and that the result is cached.
+TEST(SDFFeatures_TEST, SelfCollisionPruning)
+{
+  auto engine = LoadEngine<PruningFeatureList>();
+  ASSERT_NE(nullptr, engine);
+
+  const std::string cacheDir = ignition::common::joinPaths(
+      ignition::common::cwd(), "self_collision_cache");
+  ignition::common::removeAll(cacheDir);
+
+  sdf::Root root;
+  ASSERT_TRUE(root.Load(TEST_WORLD_DIR"/self_collide_arm.sdf").empty());
+  const sdf::World *sdfWorld = root.WorldByIndex(0);
+  ASSERT_NE(nullptr, sdfWorld);
+
+  engine->SetSelfCollisionPruning(50, cacheDir);
+  auto world = engine->ConstructWorld(*sdfWorld);
+  ASSERT_NE(nullptr, world);
+
+  // The result of the load-time pass was written to the cache
+  EXPECT_TRUE(ignition::common::isDirectory(cacheDir));
+  std::size_t cacheFiles = 0;
+  for (ignition::common::DirIter file(cacheDir);
+       file != ignition::common::DirIter(); ++file)
+  {
+    ++cacheFiles;
+  }
+  EXPECT_EQ(1u, cacheFiles);
+
+  // Each link overlaps its neighbors, but the joint limits keep the lower arm
+  // away from the base, so exactly one pair can be skipped.
+  auto model = world->GetModel("arm");
+  ASSERT_NE(nullptr, model);
+  EXPECT_EQ(1u, model->PruneSelfCollisions(50));
+
+  // A different number of samples is a different cache entry
+  EXPECT_EQ(1u, model->PruneSelfCollisions(10));
+  cacheFiles = 0;
+  for (ignition::common::DirIter file(cacheDir);
+       file != ignition::common::DirIter(); ++file)
+  {
+    ++cacheFiles;
+  }
+  EXPECT_EQ(2u, cacheFiles);
+
+  ignition::common::removeAll(cacheDir);
+}
+
 int main(int argc, char *argv[])
 {
   ::testing::InitGoogleTest(&argc, argv);
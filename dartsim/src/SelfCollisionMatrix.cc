@@ -0,0 +1,338 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include "SelfCollisionMatrix.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <dart/collision/CollisionGroup.hpp>
+#include <dart/collision/CollisionObject.hpp>
+#include <dart/collision/CollisionOption.hpp>
+#include <dart/collision/CollisionResult.hpp>
+#include <dart/collision/ode/OdeCollisionDetector.hpp>
+#include <dart/dynamics/BodyNode.hpp>
+#include <dart/dynamics/DegreeOfFreedom.hpp>
+#include <dart/dynamics/Joint.hpp>
+#include <dart/dynamics/ShapeNode.hpp>
+
+#include <ignition/math/Helpers.hh>
+
+namespace ignition {
+namespace physics {
+namespace dartsim {
+
+namespace {
+/////////////////////////////////////////////////
+/// \brief 64-bit FNV-1a hash. Unlike std::hash, its result does not depend on
+/// the standard library implementation, so it is safe to store on disk.
+class StableHash
+{
+  public: void Add(const void *_data, const std::size_t _size)
+  {
+    const unsigned char *bytes = static_cast<const unsigned char*>(_data);
+    for (std::size_t i = 0; i < _size; ++i)
+    {
+      this->value ^= bytes[i];
+      this->value *= 1099511628211ull;
+    }
+  }
+
+  public: template <typename T>
+  void Add(const T &_value)
+  {
+    this->Add(&_value, sizeof(T));
+  }
+
+  public: void Add(const std::string &_value)
+  {
+    this->Add(_value.size());
+    this->Add(_value.data(), _value.size());
+  }
+
+  public: void Add(const Eigen::Isometry3d &_tf)
+  {
+    this->Add(_tf.matrix().data(), 16 * sizeof(double));
+  }
+
+  public: uint64_t value = 14695981039346656037ull;
+};
+
+/// \brief Identifies the files written by SelfCollisionMatrix::Save
+const char kFileMagic[4] = {'I', 'S', 'C', 'M'};
+const uint32_t kFileVersion = 1;
+
+/////////////////////////////////////////////////
+std::size_t WordCount(const std::size_t _bodyCount)
+{
+  const std::size_t pairs =
+      _bodyCount < 2 ? 0 : _bodyCount * (_bodyCount - 1) / 2;
+  return (pairs + 63) / 64;
+}
+}
+
+/////////////////////////////////////////////////
+SelfCollisionMatrix SelfCollisionMatrix::Compute(
+    const dart::dynamics::SkeletonPtr &_skeleton,
+    const std::size_t _samples)
+{
+  SelfCollisionMatrix matrix;
+  matrix.bodyCount = _skeleton->getNumBodyNodes();
+  matrix.bits.assign(WordCount(matrix.bodyCount), 0u);
+
+  // Start by assuming that every pair within a tree can be skipped, then clear
+  // each pair that is seen colliding.
+  for (std::size_t j = 1; j < matrix.bodyCount; ++j)
+  {
+    for (std::size_t i = 0; i < j; ++i)
+    {
+      if (_skeleton->getBodyNode(i)->getTreeIndex() ==
+          _skeleton->getBodyNode(j)->getTreeIndex())
+      {
+        matrix.SetIgnored(i, j);
+      }
+    }
+  }
+
+  const Eigen::VectorXd initial = _skeleton->getPositions();
+
+  // Each DOF is sampled within its position limits, clamped to within pi of
+  // its current position so that unlimited joints still get a useful range.
+  struct SampledDof
+  {
+    std::size_t index;
+    std::uniform_real_distribution<double> distribution;
+  };
+  std::vector<SampledDof> sampledDofs;
+  for (std::size_t i = 0; i < _skeleton->getNumDofs(); ++i)
+  {
+    const dart::dynamics::DegreeOfFreedom *dof = _skeleton->getDof(i);
+    if (!dof->getJoint()->getParentBodyNode())
+      continue;
+
+    const double lower =
+        std::max(dof->getPositionLowerLimit(), initial[i] - IGN_PI);
+    const double upper =
+        std::min(dof->getPositionUpperLimit(), initial[i] + IGN_PI);
+    if (lower < upper)
+      sampledDofs.push_back({i, std::uniform_real_distribution<double>(
+          lower, upper)});
+  }
+
+  auto detector = dart::collision::OdeCollisionDetector::create();
+  auto group = detector->createCollisionGroup(_skeleton.get());
+  const dart::collision::CollisionOption option(true, 100000u);
+
+  // Use a fixed seed so that a given skeleton always produces the same matrix
+  std::mt19937 generator(0u);
+  Eigen::VectorXd q = initial;
+  for (std::size_t s = 0; s < _samples; ++s)
+  {
+    if (s > 0)
+    {
+      for (auto &sampled : sampledDofs)
+        q[sampled.index] = sampled.distribution(generator);
+    }
+    _skeleton->setPositions(q);
+
+    dart::collision::CollisionResult result;
+    group->collide(option, &result);
+
+    for (const auto &contact : result.getContacts())
+    {
+      const auto *node1 =
+          contact.collisionObject1->getShapeFrame()->asShapeNode();
+      const auto *node2 =
+          contact.collisionObject2->getShapeFrame()->asShapeNode();
+      if (!node1 || !node2)
+        continue;
+
+      const std::size_t index1 = node1->getBodyNodePtr()->getIndexInSkeleton();
+      const std::size_t index2 = node2->getBodyNodePtr()->getIndexInSkeleton();
+      if (index1 != index2)
+      {
+        const std::size_t bit = BitIndex(index1, index2);
+        matrix.bits[bit / 64] &= ~(uint64_t(1) << (bit % 64));
+      }
+    }
+  }
+
+  _skeleton->setPositions(initial);
+
+  return matrix;
+}
+
+/////////////////////////////////////////////////
+uint64_t SelfCollisionMatrix::Hash(
+    const dart::dynamics::Skeleton &_skeleton,
+    const std::size_t _samples)
+{
+  StableHash hash;
+  hash.Add(kFileVersion);
+  hash.Add(_samples);
+  hash.Add(_skeleton.getNumBodyNodes());
+
+  for (std::size_t i = 0; i < _skeleton.getNumBodyNodes(); ++i)
+  {
+    const dart::dynamics::BodyNode *bn = _skeleton.getBodyNode(i);
+    hash.Add(bn->getName());
+    hash.Add(bn->getTreeIndex());
+
+    const dart::dynamics::BodyNode *parent = bn->getParentBodyNode();
+    hash.Add(parent ? parent->getIndexInSkeleton() : i);
+
+    const dart::dynamics::Joint *joint = bn->getParentJoint();
+    hash.Add(joint->getType());
+    hash.Add(joint->getTransformFromParentBodyNode());
+    hash.Add(joint->getTransformFromChildBodyNode());
+    for (std::size_t d = 0; d < joint->getNumDofs(); ++d)
+    {
+      hash.Add(joint->getPositionLowerLimit(d));
+      hash.Add(joint->getPositionUpperLimit(d));
+      hash.Add(joint->getPosition(d));
+    }
+
+    for (std::size_t s = 0; s < bn->getNumShapeNodes(); ++s)
+    {
+      const dart::dynamics::ShapeNode *sn = bn->getShapeNode(s);
+      if (!sn->has<dart::dynamics::CollisionAspect>())
+        continue;
+
+      const auto &shape = sn->getShape();
+      hash.Add(shape->getType());
+      hash.Add(sn->getRelativeTransform());
+
+      const auto &box = shape->getBoundingBox();
+      hash.Add(box.getMin().data(), 3 * sizeof(double));
+      hash.Add(box.getMax().data(), 3 * sizeof(double));
+    }
+  }
+
+  return hash.value;
+}
+
+/////////////////////////////////////////////////
+bool SelfCollisionMatrix::Ignores(
+    const std::size_t _index1, const std::size_t _index2) const
+{
+  if (_index1 == _index2 ||
+      _index1 >= this->bodyCount || _index2 >= this->bodyCount)
+  {
+    return false;
+  }
+
+  const std::size_t bit = BitIndex(_index1, _index2);
+  return (this->bits[bit / 64] >> (bit % 64)) & 1u;
+}
+
+/////////////////////////////////////////////////
+std::size_t SelfCollisionMatrix::BodyCount() const
+{
+  return this->bodyCount;
+}
+
+/////////////////////////////////////////////////
+std::size_t SelfCollisionMatrix::PrunedPairCount() const
+{
+  std::size_t count = 0;
+  for (uint64_t word : this->bits)
+  {
+    for (; word; word &= word - 1)
+      ++count;
+  }
+  return count;
+}
+
+/////////////////////////////////////////////////
+bool SelfCollisionMatrix::Save(
+    const std::string &_path, const uint64_t _hash) const
+{
+  std::ofstream file(_path, std::ios::binary | std::ios::trunc);
+  if (!file)
+    return false;
+
+  const uint64_t bodies = this->bodyCount;
+  file.write(kFileMagic, sizeof(kFileMagic));
+  file.write(reinterpret_cast<const char*>(&kFileVersion),
+             sizeof(kFileVersion));
+  file.write(reinterpret_cast<const char*>(&_hash), sizeof(_hash));
+  file.write(reinterpret_cast<const char*>(&bodies), sizeof(bodies));
+  file.write(reinterpret_cast<const char*>(this->bits.data()),
+             static_cast<std::streamsize>(
+               this->bits.size() * sizeof(uint64_t)));
+
+  return static_cast<bool>(file);
+}
+
+/////////////////////////////////////////////////
+bool SelfCollisionMatrix::Load(const std::string &_path, const uint64_t _hash)
+{
+  std::ifstream file(_path, std::ios::binary);
+  if (!file)
+    return false;
+
+  char magic[sizeof(kFileMagic)];
+  uint32_t version = 0;
+  uint64_t hash = 0;
+  uint64_t bodies = 0;
+  file.read(magic, sizeof(magic));
+  file.read(reinterpret_cast<char*>(&version), sizeof(version));
+  file.read(reinterpret_cast<char*>(&hash), sizeof(hash));
+  file.read(reinterpret_cast<char*>(&bodies), sizeof(bodies));
+
+  if (!file || std::memcmp(magic, kFileMagic, sizeof(magic)) != 0 ||
+      version != kFileVersion || hash != _hash)
+  {
+    return false;
+  }
+
+  std::vector<uint64_t> loaded(WordCount(bodies));
+  file.read(reinterpret_cast<char*>(loaded.data()),
+            static_cast<std::streamsize>(loaded.size() * sizeof(uint64_t)));
+  if (!file)
+    return false;
+
+  this->bodyCount = bodies;
+  this->bits = std::move(loaded);
+  return true;
+}
+
+/////////////////////////////////////////////////
+void SelfCollisionMatrix::SetIgnored(
+    const std::size_t _index1, const std::size_t _index2)
+{
+  const std::size_t bit = BitIndex(_index1, _index2);
+  this->bits[bit / 64] |= uint64_t(1) << (bit % 64);
+}
+
+/////////////////////////////////////////////////
+std::size_t SelfCollisionMatrix::BitIndex(
+    const std::size_t _index1, const std::size_t _index2)
+{
+  const std::size_t i = std::min(_index1, _index2);
+  const std::size_t j = std::max(_index1, _index2);
+  return j * (j - 1) / 2 + i;
+}
+
+}
+}
+}
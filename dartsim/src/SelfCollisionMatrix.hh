@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_DARTSIM_SRC_SELFCOLLISIONMATRIX_HH_
+#define IGNITION_PHYSICS_DARTSIM_SRC_SELFCOLLISIONMATRIX_HH_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <dart/dynamics/Skeleton.hpp>
+
+namespace ignition {
+namespace physics {
+namespace dartsim {
+
+/// \brief Records which pairs of BodyNodes of a skeleton never collide with
+/// each other, so that self-collision checking can skip them. The pairs are
+/// found by sampling the joint space of the skeleton and are stored as one
+/// bit per unordered pair.
+///
+/// Only pairs within the same kinematic tree can be pruned. The relative pose
+/// of bodies in different trees of a skeleton is unconstrained, so those
+/// pairs are always checked.
+class SelfCollisionMatrix
+{
+  /// \brief Sample the joint space of a skeleton and record every pair of
+  /// BodyNodes that did not collide in any of the samples. The first sample
+  /// is the current configuration of the skeleton, which is restored
+  /// afterwards. The root joints of the skeleton are not moved, since moving
+  /// a whole tree does not change which of its bodies touch.
+  /// \param[in] _skeleton The skeleton to sample
+  /// \param[in] _samples The number of configurations to test. A pair that
+  /// only collides in configurations that were not sampled is recorded as
+  /// never colliding, so fewer samples risk more missed collisions.
+  /// \return The pairs that never collided
+  public: static SelfCollisionMatrix Compute(
+      const dart::dynamics::SkeletonPtr &_skeleton,
+      std::size_t _samples);
+
+  /// \brief Compute a hash of everything that affects the result of
+  /// Compute(): the tree structure, joint types, joint limits and collision
+  /// geometry of the skeleton, and the number of samples. The hash is stable
+  /// across runs so it can be used to key an on-disk cache.
+  /// \param[in] _skeleton The skeleton to hash
+  /// \param[in] _samples The number of samples that Compute() will take
+  /// \return The hash
+  public: static uint64_t Hash(
+      const dart::dynamics::Skeleton &_skeleton,
+      std::size_t _samples);
+
+  /// \brief Whether collisions between two BodyNodes can be skipped.
+  /// \param[in] _index1 Index of the first BodyNode in its skeleton
+  /// \param[in] _index2 Index of the second BodyNode in its skeleton
+  /// \return True if the two bodies never collided while sampling
+  public: bool Ignores(std::size_t _index1, std::size_t _index2) const;
+
+  /// \brief Number of BodyNodes that this matrix was computed for. The
+  /// matrix no longer applies once the skeleton has a different number of
+  /// BodyNodes.
+  public: std::size_t BodyCount() const;
+
+  /// \brief Number of pairs that can be skipped.
+  public: std::size_t PrunedPairCount() const;
+
+  /// \brief Write the matrix to a file.
+  /// \param[in] _path Path of the file
+  /// \param[in] _hash Hash of the skeleton, from Hash()
+  /// \return True if the file was written
+  public: bool Save(const std::string &_path, uint64_t _hash) const;
+
+  /// \brief Read a matrix from a file written by Save().
+  /// \param[in] _path Path of the file
+  /// \param[in] _hash Expected hash of the skeleton. Loading fails if the file
+  /// was written for a different hash.
+  /// \return True if the matrix was loaded
+  public: bool Load(const std::string &_path, uint64_t _hash);
+
+  /// \brief Mark a pair of bodies as never colliding.
+  private: void SetIgnored(std::size_t _index1, std::size_t _index2);
+
+  /// \brief Position of the bit for a pair of bodies.
+  private: static std::size_t BitIndex(std::size_t _index1,
+                                       std::size_t _index2);
+
+  /// \brief Number of BodyNodes
+  private: std::size_t bodyCount = 0;
+
+  /// \brief One bit for each unordered pair of distinct bodies
+  private: std::vector<uint64_t> bits;
+};
+
+}
+}
+}
+
+#endif  // IGNITION_PHYSICS_DARTSIM_SRC_SELFCOLLISIONMATRIX_HH_
@@ -37,7 +37,8 @@ Pose3d ShapeFeatures::GetShapeRelativeTransform(
     const Identity &_shapeID) const
 {
   const auto *shapeInfo = this->ReferenceInterface<ShapeInfo>(_shapeID);
-  return shapeInfo->node->getRelativeTransform() *
+  return WeldOffset(shapeInfo->weldFrame).inverse() *
+         shapeInfo->node->getRelativeTransform() *
          shapeInfo->tf_offset.inverse();
 }
 
@@ -46,7 +47,9 @@ void ShapeFeatures::SetShapeRelativeTransform(
     const Identity &_shapeID, const Pose3d &_pose)
 {
   const auto *shapeInfo = this->ReferenceInterface<ShapeInfo>(_shapeID);
-  shapeInfo->node->setRelativeTransform(_pose * shapeInfo->tf_offset);
+  shapeInfo->node->setRelativeTransform(
+      WeldOffset(shapeInfo->weldFrame) * _pose * shapeInfo->tf_offset);
+  this->InvalidateFrameDataCache();
 }
 
 /////////////////////////////////////////////////
@@ -82,14 +85,16 @@ Identity ShapeFeatures::AttachBoxShape(
 {
   auto box = std::make_shared<dart::dynamics::BoxShape>(_size);
 
-  DartBodyNode *bn = this->ReferenceInterface<LinkInfo>(_linkID)->link.get();
+  const auto *linkInfo = this->ReferenceInterface<LinkInfo>(_linkID);
+  DartBodyNode *bn = linkInfo->link.get();
   dart::dynamics::ShapeNode *sn =
       bn->createShapeNodeWith<dart::dynamics::CollisionAspect,
                               dart::dynamics::DynamicsAspect>(
-          box, bn->getName() + ":" + _name);
+          box, ShapeNodeName(*linkInfo, _name));
 
-  sn->setRelativeTransform(_pose);
-  const std::size_t shapeID = this->AddShape({sn, _name});
+  sn->setRelativeTransform(WeldOffset(linkInfo->weldFrame.get()) * _pose);
+  const std::size_t shapeID = this->AddShape(
+      {sn, _name, Eigen::Isometry3d::Identity(), linkInfo->weldFrame.get()});
   return this->GenerateIdentity(shapeID, this->shapes.at(shapeID));
 }
 
@@ -142,15 +147,17 @@ Identity ShapeFeatures::AttachCylinderShape(
   auto cylinder = std::make_shared<dart::dynamics::CylinderShape>(
         _radius, _height);
 
-  auto bn = this->ReferenceInterface<LinkInfo>(_linkID)->link;
+  const auto *linkInfo = this->ReferenceInterface<LinkInfo>(_linkID);
+  auto bn = linkInfo->link;
   dart::dynamics::ShapeNode *sn =
       bn->createShapeNodeWith<dart::dynamics::CollisionAspect,
                               dart::dynamics::DynamicsAspect>(
-          cylinder, bn->getName() + ":" + _name);
+          cylinder, ShapeNodeName(*linkInfo, _name));
 
-  sn->setRelativeTransform(_pose);
+  sn->setRelativeTransform(WeldOffset(linkInfo->weldFrame.get()) * _pose);
 
-  const std::size_t shapeID = this->AddShape({sn, _name});
+  const std::size_t shapeID = this->AddShape(
+      {sn, _name, Eigen::Isometry3d::Identity(), linkInfo->weldFrame.get()});
   return this->GenerateIdentity(shapeID, this->shapes.at(shapeID));
 }
 
@@ -190,14 +197,16 @@ Identity ShapeFeatures::AttachSphereShape(
 {
   auto sphere = std::make_shared<dart::dynamics::SphereShape>(_radius);
 
-  DartBodyNode *bn = this->ReferenceInterface<LinkInfo>(_linkID)->link.get();
+  const auto *linkInfo = this->ReferenceInterface<LinkInfo>(_linkID);
+  DartBodyNode *bn = linkInfo->link.get();
   dart::dynamics::ShapeNode *sn =
       bn->createShapeNodeWith<dart::dynamics::CollisionAspect,
                               dart::dynamics::DynamicsAspect>(
-          sphere, bn->getName() + ":" + _name);
+          sphere, ShapeNodeName(*linkInfo, _name));
 
-  sn->setRelativeTransform(_pose);
-  const std::size_t shapeID = this->AddShape({sn, _name});
+  sn->setRelativeTransform(WeldOffset(linkInfo->weldFrame.get()) * _pose);
+  const std::size_t shapeID = this->AddShape(
+      {sn, _name, Eigen::Isometry3d::Identity(), linkInfo->weldFrame.get()});
   return this->GenerateIdentity(shapeID, this->shapes.at(shapeID));
 }
 
@@ -250,16 +259,18 @@ Identity ShapeFeatures::AttachMeshShape(
     const Pose3d &_pose,
     const LinearVector3d &_scale)
 {
-  auto mesh = std::make_shared<CustomMeshShape>(_mesh, _scale);
+  auto mesh = this->meshCache.Get(_mesh, _scale);
 
-  DartBodyNode *bn = this->ReferenceInterface<LinkInfo>(_linkID)->link.get();
+  const auto *linkInfo = this->ReferenceInterface<LinkInfo>(_linkID);
+  DartBodyNode *bn = linkInfo->link.get();
   dart::dynamics::ShapeNode *sn =
       bn->createShapeNodeWith<dart::dynamics::CollisionAspect,
                               dart::dynamics::DynamicsAspect>(
-          mesh, bn->getName() + ":" + _name);
+          mesh, ShapeNodeName(*linkInfo, _name));
 
-  sn->setRelativeTransform(_pose);
-  const std::size_t shapeID = this->AddShape({sn, _name});
+  sn->setRelativeTransform(WeldOffset(linkInfo->weldFrame.get()) * _pose);
+  const std::size_t shapeID = this->AddShape(
+      {sn, _name, Eigen::Isometry3d::Identity(), linkInfo->weldFrame.get()});
   return this->GenerateIdentity(shapeID, this->shapes.at(shapeID));
 }
 
@@ -312,13 +323,15 @@ Identity ShapeFeatures::AttachPlaneShape(
 {
   auto plane = std::make_shared<dart::dynamics::PlaneShape>(_normal, _point);
 
-  DartBodyNode *bn = this->ReferenceInterface<LinkInfo>(_linkID)->link.get();
+  const auto *linkInfo = this->ReferenceInterface<LinkInfo>(_linkID);
+  DartBodyNode *bn = linkInfo->link.get();
   dart::dynamics::ShapeNode *sn =
       bn->createShapeNodeWith<dart::dynamics::CollisionAspect,
                               dart::dynamics::DynamicsAspect>(
-          plane, bn->getName() + ":" + _name);
+          plane, ShapeNodeName(*linkInfo, _name));
 
-  const std::size_t shapeID = this->AddShape({sn, _name});
+  const std::size_t shapeID = this->AddShape(
+      {sn, _name, Eigen::Isometry3d::Identity(), linkInfo->weldFrame.get()});
   return this->GenerateIdentity(shapeID, this->shapes.at(shapeID));
 }
 
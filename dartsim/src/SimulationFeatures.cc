@@ -15,11 +15,18 @@
  *
 */
 
+#include <cmath>
+#include <vector>
+
 #include <dart/collision/CollisionObject.hpp>
 #include <dart/collision/CollisionResult.hpp>
+#include <dart/dynamics/ShapeNode.hpp>
 
+#include "ContactReduction.hh"
 #include "SimulationFeatures.hh"
 
+#include <ignition/math/eigen3/Conversions.hh>
+
 #include "ignition/common/Profiler.hh"
 #include "ignition/physics/GetContacts.hh"
 
@@ -27,9 +34,46 @@ namespace ignition {
 namespace physics {
 namespace dartsim {
 
+namespace {
+/////////////////////////////////////////////////
+/// \brief Check whether a pose moved beyond the tolerances of a tracker.
+bool PoseChanged(
+    const Eigen::Isometry3d &_from, const Eigen::Isometry3d &_to,
+    const WorldPoseTracker &_tracker)
+{
+  if ((_to.translation() - _from.translation()).norm() >
+      _tracker.linearTolerance)
+  {
+    return true;
+  }
+
+  return Eigen::AngleAxisd(_from.linear().transpose() * _to.linear()).angle()
+      > _tracker.angularTolerance;
+}
+
+/////////////////////////////////////////////////
+/// \brief Check whether every body of a skeleton is moving slower than the
+/// sleep thresholds of its world.
+bool IsResting(
+    const dart::dynamics::Skeleton &_skel, const WorldSleepState &_state)
+{
+  for (std::size_t i = 0; i < _skel.getNumBodyNodes(); ++i)
+  {
+    const dart::dynamics::BodyNode *bn = _skel.getBodyNode(i);
+    if (bn->getLinearVelocity().norm() > _state.linearThreshold ||
+        bn->getAngularVelocity().norm() > _state.angularThreshold)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+/////////////////////////////////////////////////
 void SimulationFeatures::WorldForwardStep(
     const Identity &_worldID,
-    ForwardStep::Output & /*_h*/,
+    ForwardStep::Output &_h,
     ForwardStep::State & /*_x*/,
     const ForwardStep::Input & _u)
 {
@@ -50,19 +94,349 @@ void SimulationFeatures::WorldForwardStep(
     }
   }
 
-  // TODO(MXG): Parse input
+  if (const auto *forceTorques = _u.Query<ApplyExternalForceTorques>())
+    this->ApplyForceTorqueInputs(_worldID, *forceTorques);
+
+  if (const auto *forces = _u.Query<ApplyGeneralizedForces>())
+  {
+    this->ApplyGeneralizedInputs(
+        _worldID, forces->forces, dart::dynamics::Joint::FORCE);
+  }
+
+  if (const auto *commands = _u.Query<VelocityControlCommands>())
+  {
+    this->ApplyGeneralizedInputs(
+        _worldID, commands->commands, dart::dynamics::Joint::SERVO);
+  }
+
+  // TODO(MXG): Parse ServoControlCommands
+
+  // dartsim does not integrate immobile skeletons, so move kinematic models by
+  // their prescribed velocities here. Doing it before the step lets the
+  // collision detection of this step see their new poses.
+  for (const std::size_t modelID : this->models.indexInContainerToID[_worldID])
+  {
+    const ModelInfo &info = *this->models.at(modelID);
+    if (info.kinematic)
+      info.model->integratePositions(world->getTimeStep());
+  }
+
   world->step();
-  // TODO(MXG): Fill in output and state
+
+  auto sleepIt = this->worldSleepStates.find(_worldID);
+  if (sleepIt != this->worldSleepStates.end())
+  {
+    WorldSleepState &sleepState = sleepIt->second;
+    this->UpdateSleepingModels(_worldID, sleepState);
+
+    std::size_t asleep = 0;
+    for (const std::size_t modelID :
+         this->models.indexInContainerToID[_worldID])
+    {
+      if (this->models.at(modelID)->asleep)
+        ++asleep;
+    }
+
+    _h.Get<SleepStatistics>() =
+        {sleepState.fellAsleep, sleepState.wokeUp, asleep};
+    sleepState.fellAsleep = 0;
+    sleepState.wokeUp = 0;
+  }
+
+  // The step, and any models that were just put to sleep, changed the state
+  // that was cached
+  this->InvalidateFrameDataCache();
+
+  auto trackerIt = this->worldPoseTrackers.find(_worldID);
+  if (trackerIt != this->worldPoseTrackers.end())
+    this->UpdatePoseChanges(_worldID, trackerIt->second);
+
+  this->WriteStepOutput(_worldID, _h);
+  // TODO(MXG): Fill in state
 }
 
+/////////////////////////////////////////////////
+void SimulationFeatures::UpdateSleepingModels(
+    const std::size_t _worldID, WorldSleepState &_state)
+{
+  IGN_PROFILE("SimulationFeatures::UpdateSleepingModels");
+  auto *world = this->ReferenceInterface<DartWorld>(_worldID);
+
+  // A model that is moving wakes up every sleeping model that it touches.
+  // Contacts with models that are resting do not, so that a pile of objects
+  // can settle and stay asleep.
+  for (const auto &contact : world->getLastCollisionResult().getContacts())
+  {
+    const auto *node1 =
+        contact.collisionObject1->getShapeFrame()->asShapeNode();
+    const auto *node2 =
+        contact.collisionObject2->getShapeFrame()->asShapeNode();
+    if (!node1 || !node2)
+      continue;
+
+    const DartConstSkeletonPtr skel1 = node1->getSkeleton();
+    const DartConstSkeletonPtr skel2 = node2->getSkeleton();
+    if (!this->models.HasEntity(skel1) || !this->models.HasEntity(skel2))
+      continue;
+
+    const ModelInfo &info1 = *this->models.at(skel1);
+    const ModelInfo &info2 = *this->models.at(skel2);
+    if (info1.asleep && !info2.asleep &&
+        (skel2->isMobile() || info2.kinematic) && !IsResting(*skel2, _state))
+    {
+      this->WakeModel(skel1);
+    }
+    else if (info2.asleep && !info1.asleep &&
+             (skel1->isMobile() || info1.kinematic) &&
+             !IsResting(*skel1, _state))
+    {
+      this->WakeModel(skel2);
+    }
+  }
+
+  for (const std::size_t modelID : this->models.indexInContainerToID[_worldID])
+  {
+    ModelInfo &info = *this->models.at(modelID);
+    if (info.asleep || !info.model->isMobile())
+      continue;
+
+    if (!IsResting(*info.model, _state))
+    {
+      info.restingSteps = 0;
+      continue;
+    }
+
+    if (++info.restingSteps < _state.steps)
+      continue;
+
+    // Stop any residual drift so that the model wakes up from rest
+    info.model->resetVelocities();
+    info.model->resetAccelerations();
+    info.model->setMobile(false);
+    info.asleep = true;
+    ++_state.fellAsleep;
+  }
+}
+
+/////////////////////////////////////////////////
+void SimulationFeatures::ApplyForceTorqueInputs(
+    const Identity &_worldID,
+    const ApplyExternalForceTorques &_forceTorques)
+{
+  IGN_PROFILE("SimulationFeatures::ApplyForceTorqueInputs");
+  const std::size_t worldFrame = FrameID::World().ID();
+
+  ExternalWrenches3d wrenches;
+  wrenches.links.reserve(_forceTorques.entries.size());
+  wrenches.forces.reserve(_forceTorques.entries.size());
+  wrenches.torques.reserve(_forceTorques.entries.size());
+  wrenches.positions.reserve(_forceTorques.entries.size());
+
+  for (const ForceTorque &entry : _forceTorques.entries)
+  {
+    const auto frameIt = this->frames.find(entry.body);
+    if (frameIt == this->frames.end() ||
+        !this->links.HasEntity(entry.body))
+    {
+      ignwarn << "Ignoring external force-torque [" << entry.annotation
+              << "] on entity [" << entry.body << "], which is not a link\n";
+      continue;
+    }
+    const Eigen::Isometry3d &tf = frameIt->second->getWorldTransform();
+
+    // Express a vector in world coordinates
+    const auto inWorld = [&](const ignition::math::Vector3d &_vec,
+                             const std::size_t _frame,
+                             Eigen::Vector3d &_result)
+    {
+      _result = math::eigen3::convert(_vec);
+      if (_frame == entry.body)
+        _result = tf.linear() * _result;
+      return _frame == worldFrame || _frame == entry.body;
+    };
+
+    Eigen::Vector3d force;
+    Eigen::Vector3d torque;
+    Eigen::Vector3d position;
+    if (!inWorld(entry.force.vec, entry.force.inCoordinatesOf, force) ||
+        !inWorld(entry.torque.vec, entry.torque.inCoordinatesOf, torque) ||
+        !inWorld(entry.location.point, entry.location.inCoordinatesOf,
+                 position) ||
+        (entry.location.relativeTo != worldFrame &&
+         entry.location.relativeTo != entry.body))
+    {
+      ignwarn << "Ignoring external force-torque [" << entry.annotation
+              << "] on link [" << entry.body << "], which is expressed in "
+              << "a frame other than the world or the link\n";
+      continue;
+    }
+
+    if (entry.location.relativeTo == entry.body)
+      position += tf.translation();
+
+    wrenches.links.push_back(entry.body);
+    wrenches.forces.push_back(force);
+    wrenches.torques.push_back(torque);
+    wrenches.positions.push_back(position);
+  }
+
+  this->AddWorldExternalWrenches(_worldID, wrenches);
+}
+
+/////////////////////////////////////////////////
+void SimulationFeatures::ApplyGeneralizedInputs(
+    const Identity &_worldID,
+    const std::vector<GeneralizedParameters> &_params,
+    const dart::dynamics::Joint::ActuatorType _actuatorType)
+{
+  IGN_PROFILE("SimulationFeatures::ApplyGeneralizedInputs");
+  for (const GeneralizedParameters &params : _params)
+  {
+    if (params.dofs.size() != params.forces.size())
+    {
+      ignerr << "Generalized input [" << params.annotation << "] has ["
+             << params.dofs.size() << "] DOFs but [" << params.forces.size()
+             << "] values. The input will be ignored\n";
+      continue;
+    }
+
+    DartJoint *joint = nullptr;
+    std::size_t dof = 0;
+    for (std::size_t i = 0; i < params.dofs.size(); ++i)
+    {
+      // Consecutive entries for the same joint address its successive DOFs
+      if (i > 0 && params.dofs[i] == params.dofs[i-1])
+      {
+        ++dof;
+      }
+      else
+      {
+        dof = 0;
+        joint = nullptr;
+        const auto jointIt = this->joints.idToObject.find(params.dofs[i]);
+        if (jointIt == this->joints.idToObject.end())
+          continue;
+
+        DartJoint *candidate = jointIt->second->joint.get();
+        const auto modelIt =
+            this->models.objectToID.find(candidate->getSkeleton());
+        if (modelIt == this->models.objectToID.end() ||
+            this->models.idToContainerID.at(modelIt->second) != _worldID.id)
+        {
+          continue;
+        }
+
+        joint = candidate;
+        this->WakeModel(joint->getSkeleton());
+        if (joint->getActuatorType() != _actuatorType)
+          joint->setActuatorType(_actuatorType);
+      }
+
+      if (!joint || dof >= joint->getNumDofs())
+        continue;
+
+      // Take extra care that the value is finite. A nan can cause the DART
+      // constraint solver to fail, which will in turn either cause a crash or
+      // collisions to fail
+      const double value = params.forces[i];
+      if (!std::isfinite(value))
+      {
+        ignerr << "Invalid generalized input value [" << value
+               << "] set on joint [" << joint->getName() << " DOF " << dof
+               << "]. The value will be ignored\n";
+        continue;
+      }
+
+      joint->setCommand(dof, value);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+void SimulationFeatures::WriteStepOutput(
+    const Identity &_worldID, ForwardStep::Output &_h) const
+{
+  IGN_PROFILE("SimulationFeatures::WriteStepOutput");
+  const auto modelsIt = this->models.indexInContainerToID.find(_worldID);
+
+  WorldPoses &poses = _h.Get<WorldPoses>();
+  poses.entries.clear();
+
+  JointPositions *positions = _h.Query<JointPositions>();
+  if (positions)
+  {
+    positions->dofs.clear();
+    positions->positions.clear();
+  }
+
+  if (modelsIt != this->models.indexInContainerToID.end())
+  {
+    for (const std::size_t modelID : modelsIt->second)
+    {
+      const ModelInfo &info = *this->models.at(modelID);
+      const DartSkeletonPtr &skeleton = info.model;
+
+      for (std::size_t i = 0; i < skeleton->getNumBodyNodes(); ++i)
+      {
+        const DartBodyNode *bn = skeleton->getBodyNode(i);
+        const auto linkIt = this->links.objectToID.find(bn);
+        if (linkIt == this->links.objectToID.end())
+          continue;
+
+        poses.entries.push_back(
+            {math::eigen3::convert(bn->getWorldTransform()), linkIt->second});
+      }
+
+      for (const std::size_t linkID : info.weldedLinks)
+      {
+        poses.entries.push_back(
+            {math::eigen3::convert(
+                this->frames.at(linkID)->getWorldTransform()), linkID});
+      }
+
+      if (!positions)
+        continue;
+
+      for (std::size_t i = 0; i < skeleton->getNumJoints(); ++i)
+      {
+        const DartJoint *joint = skeleton->getJoint(i);
+        const auto jointIt = this->joints.objectToID.find(joint);
+        if (jointIt == this->joints.objectToID.end())
+          continue;
+
+        for (std::size_t dof = 0; dof < joint->getNumDofs(); ++dof)
+        {
+          positions->dofs.push_back(jointIt->second);
+          positions->positions.push_back(joint->getPosition(dof));
+        }
+      }
+    }
+  }
+
+  if (Contacts *contacts = _h.Query<Contacts>())
+  {
+    contacts->entries.clear();
+    for (const auto &contact : this->GetContactsFromLastStep(_worldID))
+    {
+      const auto *extra = contact.extraData.Query<ExtraContactData>();
+      contacts->entries.push_back(
+          {contact.collision1.id, contact.collision2.id,
+           math::eigen3::convert(contact.point),
+           math::eigen3::convert(extra->force),
+           math::eigen3::convert(extra->normal),
+           extra->depth});
+    }
+  }
+}
+
+/////////////////////////////////////////////////
 std::vector<SimulationFeatures::ContactInternal>
 SimulationFeatures::GetContactsFromLastStep(const Identity &_worldID) const
 {
   std::vector<SimulationFeatures::ContactInternal> outContacts;
-  auto *const world = this->ReferenceInterface<DartWorld>(_worldID);
-  const auto colResult = world->getLastCollisionResult();
 
-  for (const auto &dtContact : colResult.getContacts())
+  std::vector<dart::collision::Contact> reduced;
+  for (const auto &dtContact : this->LastStepContacts(_worldID, reduced))
   {
     dart::collision::CollisionObject *dtCollObj1 = dtContact.collisionObject1;
     dart::collision::CollisionObject *dtCollObj2 = dtContact.collisionObject2;
@@ -99,6 +473,213 @@ SimulationFeatures::GetContactsFromLastStep(const Identity &_worldID) const
   }
   return outContacts;
 }
+
+/////////////////////////////////////////////////
+void SimulationFeatures::SetWorldMaxContactsPerShapePair(
+    const Identity &_worldID, std::size_t _maxContacts)
+{
+  if (_maxContacts == 0)
+    this->worldMaxContactsPerPair.erase(_worldID);
+  else
+    this->worldMaxContactsPerPair[_worldID] = _maxContacts;
+}
+
+/////////////////////////////////////////////////
+std::size_t SimulationFeatures::GetWorldMaxContactsPerShapePair(
+    const Identity &_worldID) const
+{
+  const auto maxIt = this->worldMaxContactsPerPair.find(_worldID);
+  return maxIt == this->worldMaxContactsPerPair.end() ? 0u : maxIt->second;
+}
+
+/////////////////////////////////////////////////
+double SimulationFeatures::GetWorldContactReductionFactor(
+    const Identity &_worldID) const
+{
+  const auto *world = this->ReferenceInterface<DartWorld>(_worldID);
+  const auto &contacts = world->getLastCollisionResult().getContacts();
+  const std::size_t reported = CountReducedContacts(
+      contacts, this->GetWorldMaxContactsPerShapePair(_worldID));
+  if (reported == 0)
+    return 1.0;
+
+  return static_cast<double>(contacts.size()) /
+      static_cast<double>(reported);
+}
+
+/////////////////////////////////////////////////
+const std::vector<dart::collision::Contact> &
+SimulationFeatures::LastStepContacts(
+    const Identity &_worldID,
+    std::vector<dart::collision::Contact> &_reduced) const
+{
+  IGN_PROFILE("SimulationFeatures::LastStepContacts");
+  const auto *world = this->ReferenceInterface<DartWorld>(_worldID);
+  const auto &contacts = world->getLastCollisionResult().getContacts();
+  const std::size_t maxPerPair =
+      this->GetWorldMaxContactsPerShapePair(_worldID);
+  if (maxPerPair == 0)
+    return contacts;
+
+  ReduceContacts(contacts, maxPerPair, _reduced);
+  return _reduced;
+}
+
+/////////////////////////////////////////////////
+void SimulationFeatures::CaptureWorldResetState(const Identity &_worldID)
+{
+  this->SaveWorldResetState(_worldID);
+}
+
+/////////////////////////////////////////////////
+void SimulationFeatures::ResetWorld(const Identity &_worldID)
+{
+  IGN_PROFILE("SimulationFeatures::ResetWorld");
+  auto *world = this->ReferenceInterface<DartWorld>(_worldID);
+
+  auto statesIt = this->worldResetStates.find(_worldID);
+  if (statesIt == this->worldResetStates.end())
+  {
+    ignwarn << "Asked to reset world [" << world->getName() << "], but no "
+            << "reset state has been captured for it. The world will not be "
+            << "reset.\n";
+    return;
+  }
+
+  for (const SkeletonResetState &state : statesIt->second)
+  {
+    const DartSkeletonPtr skel = state.model.lock();
+
+    // The model has been removed since the state was captured
+    if (!skel || !this->models.HasEntity(skel))
+      continue;
+
+    if (skel->getNumDofs() != static_cast<std::size_t>(state.positions.size())
+        || skel->getNumJoints() != state.actuatorTypes.size())
+    {
+      ignwarn << "The joint structure of model [" << skel->getName() << "] "
+              << "has changed since its reset state was captured. It will "
+              << "not be reset.\n";
+      continue;
+    }
+
+    // Write the whole state back at once so that each skeleton only
+    // invalidates its kinematics a single time per vector.
+    skel->setPositions(state.positions);
+    skel->setVelocities(state.velocities);
+    skel->setAccelerations(state.accelerations);
+    skel->setForces(state.forces);
+
+    for (std::size_t i = 0; i < skel->getNumJoints(); ++i)
+    {
+      DartJoint *joint = skel->getJoint(i);
+      if (joint->getActuatorType() != state.actuatorTypes[i])
+        joint->setActuatorType(state.actuatorTypes[i]);
+    }
+    skel->setCommands(state.commands);
+
+    skel->clearExternalForces();
+    skel->clearConstraintImpulses();
+
+    this->WakeModel(skel);
+  }
+
+  this->InvalidateFrameDataCache();
+
+  // This rewinds the simulation time and clears the last collision result
+  world->reset();
+}
+
+/////////////////////////////////////////////////
+WorldPoseChanges SimulationFeatures::GetChangedWorldPoses(
+    const Identity &_worldID)
+{
+  auto trackerIt = this->worldPoseTrackers.find(_worldID);
+  if (trackerIt == this->worldPoseTrackers.end())
+  {
+    // Start tracking this world. Nothing has been reported yet, so every
+    // entity counts as changed.
+    trackerIt = this->worldPoseTrackers.emplace(
+        _worldID, WorldPoseTracker()).first;
+    this->UpdatePoseChanges(_worldID, trackerIt->second);
+  }
+
+  return trackerIt->second.changes;
+}
+
+/////////////////////////////////////////////////
+void SimulationFeatures::SetPoseChangeTolerance(
+    const Identity &_worldID, const double _linear, const double _angular)
+{
+  WorldPoseTracker &tracker = this->worldPoseTrackers[_worldID];
+  tracker.linearTolerance = _linear;
+  tracker.angularTolerance = _angular;
+}
+
+/////////////////////////////////////////////////
+void SimulationFeatures::UpdatePoseChanges(
+    const std::size_t _worldID, WorldPoseTracker &_tracker)
+{
+  IGN_PROFILE("SimulationFeatures::UpdatePoseChanges");
+  _tracker.changes.links.clear();
+  _tracker.changes.models.clear();
+
+  // Record a pose if it is new or moved beyond the tolerance
+  const auto track = [&_tracker](
+      const std::size_t _id, const Eigen::Isometry3d &_pose,
+      std::vector<WorldPose> &_changes)
+  {
+    auto reportedIt = _tracker.reported.find(_id);
+    if (reportedIt == _tracker.reported.end())
+    {
+      _tracker.reported.emplace(_id, _pose);
+    }
+    else if (PoseChanged(reportedIt->second, _pose, _tracker))
+    {
+      reportedIt->second = _pose;
+    }
+    else
+    {
+      return;
+    }
+
+    _changes.push_back({math::eigen3::convert(_pose), _id});
+  };
+
+  const auto modelsIt = this->models.indexInContainerToID.find(_worldID);
+  if (modelsIt == this->models.indexInContainerToID.end())
+    return;
+
+  for (const std::size_t modelID : modelsIt->second)
+  {
+    const ModelInfo &info = *this->models.at(modelID);
+
+    // A sleeping model cannot move until something wakes it up, but it still
+    // needs to be reported once if it has not been yet
+    if (info.asleep && _tracker.reported.count(modelID))
+      continue;
+
+    track(modelID, info.frame->getWorldTransform(), _tracker.changes.models);
+
+    for (std::size_t i = 0; i < info.model->getNumBodyNodes(); ++i)
+    {
+      const DartBodyNode *bn = info.model->getBodyNode(i);
+      const auto linkIt = this->links.objectToID.find(bn);
+      if (linkIt != this->links.objectToID.end())
+      {
+        track(linkIt->second, bn->getWorldTransform(),
+              _tracker.changes.links);
+      }
+    }
+
+    for (const std::size_t linkID : info.weldedLinks)
+    {
+      track(linkID, this->frames.at(linkID)->getWorldTransform(),
+            _tracker.changes.links);
+    }
+  }
+}
+
 }
 }
 }
@@ -19,10 +19,16 @@
 #define IGNITION_PHYSICS_DARTSIM_SRC_SIMULATIONFEATURES_HH_
 
 #include <vector>
+
+#include <dart/collision/Contact.hpp>
+
+#include <ignition/physics/ChangedWorldPoses.hh>
 #include <ignition/physics/ForwardStep.hh>
 #include <ignition/physics/GetContacts.hh>
+#include <ignition/physics/ResetWorld.hh>
 
 #include "Base.hh"
+#include "LinkFeatures.hh"
 
 namespace ignition {
 namespace physics {
@@ -30,11 +36,15 @@ namespace dartsim {
 
 struct SimulationFeatureList : FeatureList<
   ForwardStep,
-  GetContactsFromLastStepFeature
+  GetChangedWorldPosesFeature,
+  GetContactsFromLastStepFeature,
+  ReduceContactsFeature,
+  ResetWorldFeature
 > { };
 
 class SimulationFeatures :
     public virtual Base,
+    public virtual LinkFeatures,
     public virtual Implements3d<SimulationFeatureList>
 {
   public: void WorldForwardStep(
@@ -45,6 +55,81 @@ class SimulationFeatures :
 
   public: std::vector<ContactInternal> GetContactsFromLastStep(
       const Identity &_worldID) const override;
+
+  public: void SetWorldMaxContactsPerShapePair(
+      const Identity &_worldID, std::size_t _maxContacts) override;
+
+  public: std::size_t GetWorldMaxContactsPerShapePair(
+      const Identity &_worldID) const override;
+
+  public: double GetWorldContactReductionFactor(
+      const Identity &_worldID) const override;
+
+  public: void CaptureWorldResetState(const Identity &_worldID) override;
+
+  public: void ResetWorld(const Identity &_worldID) override;
+
+  public: WorldPoseChanges GetChangedWorldPoses(
+      const Identity &_worldID) override;
+
+  public: void SetPoseChangeTolerance(
+      const Identity &_worldID, double _linear, double _angular) override;
+
+  /// \brief Get the contacts of the last step of a world, reduced to the
+  /// largest number of contacts per pair of shapes set for the world. When
+  /// no limit is set, the contacts of the collision result are returned
+  /// directly, without being copied.
+  /// \param[in] _worldID ID of the world
+  /// \param[out] _reduced Storage for the reduced contacts. It is only
+  /// written to when a limit is set.
+  /// \return Either the contacts of the last collision result or _reduced
+  private: const std::vector<dart::collision::Contact> &LastStepContacts(
+      const Identity &_worldID,
+      std::vector<dart::collision::Contact> &_reduced) const;
+
+  /// \brief Find the links and models of a world whose pose moved beyond the
+  /// tolerance since it was last reported, and record their new poses.
+  /// \param[in] _worldID ID of the world
+  /// \param[in] _tracker Poses last reported for the world
+  private: void UpdatePoseChanges(
+      std::size_t _worldID, WorldPoseTracker &_tracker);
+
+  /// \brief Wake sleeping models that were touched by a moving model during
+  /// the last step, then put models that have been resting long enough to
+  /// sleep.
+  /// \param[in] _worldID ID of the world that was stepped
+  /// \param[in] _state Sleep settings and counters of the world
+  private: void UpdateSleepingModels(
+      const std::size_t _worldID, WorldSleepState &_state);
+
+  /// \brief Apply the external force-torques of a ForwardStep input. Forces,
+  /// torques and locations may be expressed in the world frame or in the
+  /// frame of the link they act on. Entries that use any other frame are
+  /// skipped with a warning.
+  /// \param[in] _worldID ID of the world that is about to be stepped
+  /// \param[in] _forceTorques The force-torques to apply
+  private: void ApplyForceTorqueInputs(
+      const Identity &_worldID,
+      const ApplyExternalForceTorques &_forceTorques);
+
+  /// \brief Apply the generalized forces or velocity commands of a
+  /// ForwardStep input, the same way as SetJointForce or
+  /// SetJointVelocityCommand would.
+  /// \param[in] _worldID ID of the world that is about to be stepped
+  /// \param[in] _params The commands to apply
+  /// \param[in] _actuatorType FORCE for generalized forces, or SERVO for
+  /// velocity commands
+  private: void ApplyGeneralizedInputs(
+      const Identity &_worldID,
+      const std::vector<GeneralizedParameters> &_params,
+      dart::dynamics::Joint::ActuatorType _actuatorType);
+
+  /// \brief Fill in the Output of a ForwardStep after the world has been
+  /// stepped.
+  /// \param[in] _worldID ID of the world that was stepped
+  /// \param[out] _h The Output to fill in
+  private: void WriteStepOutput(
+      const Identity &_worldID, ForwardStep::Output &_h) const;
 };
 
 }
@@ -28,13 +28,23 @@
 #include <ignition/physics/RequestEngine.hh>
 
 // Features
+#include <ignition/physics/ChangedWorldPoses.hh>
 #include <ignition/physics/ForwardStep.hh>
 #include <ignition/physics/FrameSemantics.hh>
+#include <ignition/physics/FreeGroup.hh>
 #include <ignition/physics/GetContacts.hh>
 #include <ignition/physics/GetEntities.hh>
+#include <ignition/physics/Link.hh>
+#include <ignition/physics/LinkFrameData.hh>
+#include <ignition/physics/ResetWorld.hh>
 #include <ignition/physics/Shape.hh>
+#include <ignition/physics/World.hh>
 #include <ignition/physics/sdf/ConstructWorld.hh>
 
+#include <ignition/physics/dartsim/FrameDataCache.hh>
+#include <ignition/physics/dartsim/Kinematic.hh>
+#include <ignition/physics/dartsim/Sleep.hh>
+
 #include <sdf/Root.hh>
 #include <sdf/World.hh>
 
@@ -57,7 +67,35 @@ using ContactPoint = ignition::physics::World3d<TestFeatureList>::ContactPoint;
 using ExtraContactData =
     ignition::physics::World3d<TestFeatureList>::ExtraContactData;
 
-std::unordered_set<TestWorldPtr> LoadWorlds(
+/////////////////////////////////////////////////
+/// \brief Construct _world in a new engine of _plugin
+template <typename FeatureList = TestFeatureList>
+ignition::physics::World3dPtr<FeatureList> LoadWorld(
+    const ignition::plugin::PluginPtr &_plugin,
+    const std::string &_world)
+{
+  auto engine =
+      ignition::physics::RequestEngine3d<FeatureList>::From(_plugin);
+  EXPECT_NE(nullptr, engine);
+  if (!engine)
+    return nullptr;
+
+  sdf::Root root;
+  const sdf::Errors &errors = root.Load(_world);
+  EXPECT_EQ(0u, errors.size());
+  const sdf::World *sdfWorld = root.WorldByIndex(0);
+  EXPECT_NE(nullptr, sdfWorld);
+  if (!sdfWorld)
+    return nullptr;
+
+  return engine->ConstructWorld(*sdfWorld);
+}
+
+/////////////////////////////////////////////////
+/// \brief Construct _world in every plugin of _library that provides
+/// FeatureList
+template <typename FeatureList = TestFeatureList>
+std::unordered_set<ignition::physics::World3dPtr<FeatureList>> LoadWorlds(
     const std::string &_library,
     const std::string &_world)
 {
@@ -65,34 +103,40 @@ std::unordered_set<TestWorldPtr> LoadWorlds(
   loader.LoadLib(_library);
 
   const std::set<std::string> pluginNames =
-      ignition::physics::FindFeatures3d<TestFeatureList>::From(loader);
+      ignition::physics::FindFeatures3d<FeatureList>::From(loader);
 
   EXPECT_LT(0u, pluginNames.size());
 
-  std::unordered_set<TestWorldPtr> worlds;
+  std::unordered_set<ignition::physics::World3dPtr<FeatureList>> worlds;
   for (const std::string &name : pluginNames)
   {
     ignition::plugin::PluginPtr plugin = loader.Instantiate(name);
 
     std::cout << " -- Plugin name: " << name << std::endl;
 
-    auto engine =
-        ignition::physics::RequestEngine3d<TestFeatureList>::From(plugin);
-    EXPECT_NE(nullptr, engine);
-
-    sdf::Root root;
-    const sdf::Errors &errors = root.Load(_world);
-    EXPECT_EQ(0u, errors.size());
-    const sdf::World *sdfWorld = root.WorldByIndex(0);
-    auto world = engine->ConstructWorld(*sdfWorld);
-
-    worlds.insert(world);
+    worlds.insert(LoadWorld<FeatureList>(plugin, _world));
   }
 
   return worlds;
 }
 
-void StepWorld(const TestWorldPtr &_world, const std::size_t _num_steps = 1)
+/////////////////////////////////////////////////
+/// \brief Construct _world in the dartsim plugin
+template <typename FeatureList = TestFeatureList>
+ignition::physics::World3dPtr<FeatureList> LoadDartsimWorld(
+    const std::string &_world)
+{
+  auto worlds = LoadWorlds<FeatureList>(dartsim_plugin_LIB, _world);
+  EXPECT_EQ(1u, worlds.size());
+  return worlds.empty() ? nullptr : *worlds.begin();
+}
+
+/////////////////////////////////////////////////
+/// \brief Step _world _num_steps times and return the output of the last
+/// step
+template <typename WorldPtrT>
+ignition::physics::ForwardStep::Output StepWorld(
+    const WorldPtrT &_world, const std::size_t _num_steps = 1)
 {
   ignition::physics::ForwardStep::Input input;
   ignition::physics::ForwardStep::State state;
@@ -102,6 +146,8 @@ void StepWorld(const TestWorldPtr &_world, const std::size_t _num_steps = 1)
   {
     _world->Step(output, state, input);
   }
+
+  return output;
 }
 
 class SimulationFeatures_TEST
@@ -230,7 +276,6 @@ TEST_P(SimulationFeatures_TEST, RetrieveContacts)
 
   auto worlds = LoadWorlds(library, TEST_WORLD_DIR "/contact.sdf");
 
-
   for (const auto &world : worlds)
   {
     auto sphere = world->GetModel("sphere");
@@ -317,7 +362,613 @@ TEST_P(SimulationFeatures_TEST, RetrieveContacts)
       EXPECT_NEAR(extraContactData->force[2],
                   forceExpectations.at(testCollision), 1e-3);
     }
+
+    // The Contacts output of a step holds the same contacts
+    ignition::physics::ForwardStep::Input input;
+    ignition::physics::ForwardStep::State state;
+    ignition::physics::ForwardStep::Output output;
+    output.Get<ignition::physics::Contacts>();
+    world->Step(output, state, input);
+
+    contacts = world->GetContactsFromLastStep();
+    const auto &entries = output.Get<ignition::physics::Contacts>().entries;
+    ASSERT_EQ(contacts.size(), entries.size());
+    for (std::size_t i = 0; i < entries.size(); ++i)
+    {
+      const auto &contactPoint = contacts[i].Get<ContactPoint>();
+      const auto &extraContactData = contacts[i].Get<ExtraContactData>();
+      EXPECT_EQ(contactPoint.collision1->EntityID(), entries[i].collision1);
+      EXPECT_EQ(contactPoint.collision2->EntityID(), entries[i].collision2);
+      EXPECT_EQ(ignition::math::eigen3::convert(contactPoint.point),
+                entries[i].point);
+      EXPECT_EQ(ignition::math::eigen3::convert(extraContactData.force),
+                entries[i].force);
+      EXPECT_EQ(ignition::math::eigen3::convert(extraContactData.normal),
+                entries[i].normal);
+      EXPECT_DOUBLE_EQ(extraContactData.depth, entries[i].depth);
+    }
+  }
+}
+
+struct ResetFeatureList : ignition::physics::FeatureList<
+    TestFeatureList,
+    ignition::physics::ResetWorldFeature
+> { };
+
+// Test that resetting a world returns its models to their loaded state
+TEST(DartsimSimulationFeatures, ResetWorld)
+{
+  auto world = LoadDartsimWorld<ResetFeatureList>(
+      TEST_WORLD_DIR "/falling.world");
+  ASSERT_NE(nullptr, world);
+
+  auto link = world->GetModel("sphere")->GetLink(0);
+  const Eigen::Isometry3d initialPose = link->FrameDataRelativeToWorld().pose;
+
+  StepWorld(world, 100);
+
+  auto frameData = link->FrameDataRelativeToWorld();
+  EXPECT_GT(initialPose.translation().z() - frameData.pose.translation().z(),
+            1e-2);
+  EXPECT_GT(frameData.linearVelocity.norm(), 1e-2);
+
+  world->Reset();
+
+  frameData = link->FrameDataRelativeToWorld();
+  EXPECT_TRUE(ignition::physics::test::Equal(
+      initialPose, frameData.pose, 1e-9));
+  EXPECT_NEAR(0.0, frameData.linearVelocity.norm(), 1e-9);
+  EXPECT_NEAR(0.0, frameData.angularVelocity.norm(), 1e-9);
+
+  // The reset point can be moved to the current state
+  StepWorld(world, 10);
+
+  const Eigen::Isometry3d capturedPose = link->FrameDataRelativeToWorld().pose;
+  world->CaptureResetState();
+
+  StepWorld(world, 10);
+
+  world->Reset();
+  EXPECT_TRUE(ignition::physics::test::Equal(
+      capturedPose, link->FrameDataRelativeToWorld().pose, 1e-9));
+}
+
+struct SleepFeatureList : ignition::physics::FeatureList<
+    TestFeatureList,
+    ignition::physics::AddLinkExternalForceTorque,
+    ignition::physics::dartsim::SleepFeature
+> { };
+
+// Test that a model that comes to rest is put to sleep, and that it wakes up
+// when a force is applied to it
+TEST(DartsimSimulationFeatures, Sleep)
+{
+  auto world = LoadDartsimWorld<SleepFeatureList>(
+      TEST_WORLD_DIR "/falling.world");
+  ASSERT_NE(nullptr, world);
+
+  world->EnableSleeping(1e-2, 1e-2, 50);
+
+  auto sphere = world->GetModel("sphere");
+  auto box = world->GetModel("box");
+  auto link = sphere->GetLink(0);
+
+  std::size_t fellAsleep = 0;
+  std::size_t steps = 0;
+  for (; steps < 5000 && !sphere->IsAsleep(); ++steps)
+  {
+    const auto output = StepWorld(world);
+
+    const auto *stats =
+        output.Query<ignition::physics::SleepStatistics>();
+    ASSERT_NE(nullptr, stats);
+    fellAsleep += stats->fellAsleep;
+    EXPECT_EQ(0u, stats->wokeUp);
+  }
+
+  // The sphere falls for a while before it can come to rest, and the static
+  // box is never put to sleep
+  EXPECT_GT(steps, 50u);
+  EXPECT_TRUE(sphere->IsAsleep());
+  EXPECT_FALSE(box->IsAsleep());
+  EXPECT_EQ(1u, fellAsleep);
+
+  // A sleeping model does not move
+  const Eigen::Isometry3d restingPose = link->FrameDataRelativeToWorld().pose;
+  const auto restingOutput = StepWorld(world, 10);
+
+  EXPECT_TRUE(ignition::physics::test::Equal(
+      restingPose, link->FrameDataRelativeToWorld().pose, 1e-12));
+  EXPECT_EQ(1u,
+      restingOutput.Get<ignition::physics::SleepStatistics>().asleep);
+
+  // Pushing the sphere wakes it up
+  link->AddExternalForce(Eigen::Vector3d(100.0, 0.0, 0.0));
+  EXPECT_FALSE(sphere->IsAsleep());
+
+  const auto output = StepWorld(world);
+  const auto &stats = output.Get<ignition::physics::SleepStatistics>();
+  EXPECT_EQ(1u, stats.wokeUp);
+  EXPECT_EQ(0u, stats.asleep);
+  EXPECT_GT(link->FrameDataRelativeToWorld().linearVelocity.x(), 0.0);
+
+  // Disabling sleep keeps the model awake
+  world->DisableSleeping();
+  StepWorld(world, 2000);
+  EXPECT_FALSE(sphere->IsAsleep());
+}
+
+struct KinematicFeatureList : ignition::physics::FeatureList<
+    TestFeatureList,
+    ignition::physics::FindFreeGroupFeature,
+    ignition::physics::SetFreeGroupWorldVelocity,
+    ignition::physics::dartsim::KinematicModelFeature
+> { };
+
+// Test that a kinematic model ignores gravity and contacts but follows the
+// velocity that is set on it, that it falls again once it is dynamic, and
+// that a static model is still static after leaving kinematic mode
+TEST(DartsimSimulationFeatures, KinematicModel)
+{
+  auto world = LoadDartsimWorld<KinematicFeatureList>(
+      TEST_WORLD_DIR "/falling.world");
+  ASSERT_NE(nullptr, world);
+
+  auto sphere = world->GetModel("sphere");
+  auto link = sphere->GetLink(0);
+  EXPECT_FALSE(sphere->IsKinematic());
+
+  sphere->SetKinematic(true);
+  EXPECT_TRUE(sphere->IsKinematic());
+
+  // A kinematic model does not fall
+  const Eigen::Isometry3d initialPose = link->FrameDataRelativeToWorld().pose;
+  StepWorld(world, 100);
+
+  EXPECT_TRUE(ignition::physics::test::Equal(
+      initialPose, link->FrameDataRelativeToWorld().pose, 1e-12));
+
+  // It moves with the velocity that is set on it, without slowing down
+  auto freeGroup = sphere->FindFreeGroup();
+  ASSERT_NE(nullptr, freeGroup);
+  freeGroup->SetWorldLinearVelocity(Eigen::Vector3d(1.0, 0.0, 0.0));
+  StepWorld(world, 1000);
+
+  const Eigen::Vector3d moved =
+      link->FrameDataRelativeToWorld().pose.translation();
+  EXPECT_NEAR(initialPose.translation().x() + 1.0, moved.x(), 1e-6);
+  EXPECT_NEAR(initialPose.translation().z(), moved.z(), 1e-9);
+
+  // Once it is dynamic again, it falls
+  freeGroup->SetWorldLinearVelocity(Eigen::Vector3d::Zero());
+  sphere->SetKinematic(false);
+  EXPECT_FALSE(sphere->IsKinematic());
+  StepWorld(world, 100);
+
+  EXPECT_LT(link->FrameDataRelativeToWorld().pose.translation().z(),
+            moved.z());
+
+  // A static model stays static after a round trip through kinematic mode
+  auto box = world->GetModel("box");
+  auto boxLink = box->GetLink(0);
+  const Eigen::Isometry3d boxPose = boxLink->FrameDataRelativeToWorld().pose;
+  box->SetKinematic(true);
+  EXPECT_TRUE(box->IsKinematic());
+  box->SetKinematic(false);
+  EXPECT_FALSE(box->IsKinematic());
+  StepWorld(world, 100);
+
+  EXPECT_TRUE(ignition::physics::test::Equal(
+      boxPose, boxLink->FrameDataRelativeToWorld().pose, 1e-12));
+}
+
+struct FrameDataCacheFeatureList : ignition::physics::FeatureList<
+    TestFeatureList,
+    ignition::physics::FindFreeGroupFeature,
+    ignition::physics::SetFreeGroupWorldPose,
+    ignition::physics::dartsim::FrameDataCacheFeature
+> { };
+
+// Test that frame data is only computed once until the state of the engine
+// changes, and that the cached data is never stale
+TEST(DartsimSimulationFeatures, FrameDataCache)
+{
+  auto world = LoadDartsimWorld<FrameDataCacheFeatureList>(
+      TEST_WORLD_DIR "/falling.world");
+  ASSERT_NE(nullptr, world);
+
+  auto sphere = world->GetModel("sphere");
+  auto link = sphere->GetLink(0);
+  auto boxLink = world->GetModel("box")->GetLink(0);
+  auto engine = world->GetEngine();
+
+  // Nothing is cached by default
+  EXPECT_FALSE(engine->FrameDataCacheEnabled());
+  const Eigen::Isometry3d initialPose = link->FrameDataRelativeToWorld().pose;
+  link->FrameDataRelativeToWorld();
+  auto stats = engine->GetFrameDataCacheStatistics();
+  EXPECT_EQ(0u, stats.hits);
+  EXPECT_EQ(0u, stats.misses);
+
+  engine->EnableFrameDataCache(true);
+  EXPECT_TRUE(engine->FrameDataCacheEnabled());
+
+  // Resolving against another link computes the data of each link once
+  const Eigen::Isometry3d relativePose =
+      link->FrameDataRelativeTo(*boxLink).pose;
+  EXPECT_TRUE(ignition::physics::test::Equal(
+      relativePose, link->FrameDataRelativeTo(*boxLink).pose, 1e-12));
+  EXPECT_TRUE(ignition::physics::test::Equal(
+      initialPose, link->FrameDataRelativeToWorld().pose, 1e-12));
+  stats = engine->GetFrameDataCacheStatistics();
+  EXPECT_EQ(3u, stats.hits);
+  EXPECT_EQ(2u, stats.misses);
+
+  engine->ResetFrameDataCacheStatistics();
+  stats = engine->GetFrameDataCacheStatistics();
+  EXPECT_EQ(0u, stats.hits);
+  EXPECT_EQ(0u, stats.misses);
+
+  // A step empties the cache
+  StepWorld(world);
+
+  const Eigen::Isometry3d fallenPose = link->FrameDataRelativeToWorld().pose;
+  EXPECT_LT(fallenPose.translation().z(), initialPose.translation().z());
+  stats = engine->GetFrameDataCacheStatistics();
+  EXPECT_EQ(0u, stats.hits);
+  EXPECT_EQ(1u, stats.misses);
+
+  // So does writing a pose
+  auto freeGroup = sphere->FindFreeGroup();
+  ASSERT_NE(nullptr, freeGroup);
+  freeGroup->SetWorldPose(initialPose);
+  EXPECT_TRUE(ignition::physics::test::Equal(
+      initialPose, link->FrameDataRelativeToWorld().pose, 1e-12));
+  stats = engine->GetFrameDataCacheStatistics();
+  EXPECT_EQ(0u, stats.hits);
+  EXPECT_EQ(2u, stats.misses);
+
+  // Turning the cache off stops counting
+  engine->EnableFrameDataCache(false);
+  link->FrameDataRelativeToWorld();
+  stats = engine->GetFrameDataCacheStatistics();
+  EXPECT_EQ(0u, stats.hits);
+  EXPECT_EQ(2u, stats.misses);
+}
+
+struct LinkFrameDataFeatureList : ignition::physics::FeatureList<
+    TestFeatureList,
+    ignition::physics::GetLinkFrameDataFeature
+> { };
+
+// Test that the frame data of all links of a world or a model matches the
+// data of each link, in the documented order
+TEST(DartsimSimulationFeatures, LinkFrameData)
+{
+  auto world = LoadDartsimWorld<LinkFrameDataFeatureList>(
+      TEST_WORLD_DIR "/shapes.world");
+  ASSERT_NE(nullptr, world);
+
+  // Step so that the velocities and accelerations are not all zero
+  StepWorld(world, 10);
+
+  std::vector<ignition::physics::FrameData3d> data;
+  world->GetLinkFrameData(data);
+
+  std::size_t entry = 0;
+  for (std::size_t i = 0; i < world->GetModelCount(); ++i)
+  {
+    auto model = world->GetModel(i);
+
+    std::vector<ignition::physics::FrameData3d> modelData;
+    model->GetLinkFrameData(modelData);
+    ASSERT_EQ(model->GetLinkCount(), modelData.size());
+
+    for (std::size_t j = 0; j < model->GetLinkCount(); ++j, ++entry)
+    {
+      const auto expected = model->GetLink(j)->FrameDataRelativeToWorld();
+      ASSERT_LT(entry, data.size());
+      EXPECT_TRUE(ignition::physics::test::Equal(
+          expected, data[entry], 1e-12));
+      EXPECT_TRUE(ignition::physics::test::Equal(
+          expected, modelData[j], 1e-12));
+    }
+  }
+  EXPECT_EQ(entry, data.size());
+
+  // Only the requested fields are filled in
+  const auto link = world->GetModel(0)->GetLink(0)->FrameDataRelativeToWorld();
+  world->GetLinkFrameData(data, ignition::physics::FRAME_DATA_POSE);
+  ASSERT_FALSE(data.empty());
+  EXPECT_TRUE(ignition::physics::test::Equal(
+      link.pose, data[0].pose, 1e-12));
+  for (const auto &frameData : data)
+  {
+    EXPECT_EQ(Eigen::Vector3d::Zero(), frameData.linearVelocity);
+    EXPECT_EQ(Eigen::Vector3d::Zero(), frameData.angularVelocity);
+    EXPECT_EQ(Eigen::Vector3d::Zero(), frameData.linearAcceleration);
+    EXPECT_EQ(Eigen::Vector3d::Zero(), frameData.angularAcceleration);
+  }
+}
+
+// Test that only the requested fields of frame data are computed, and that
+// resolving poses, which only asks for the poses of the frames, gives the
+// same result as resolving complete frame data
+TEST(DartsimSimulationFeatures, SelectedFrameData)
+{
+  // The implementation is queried directly, so keep the plugin at hand
+  ignition::plugin::Loader loader;
+  loader.LoadLib(dartsim_plugin_LIB);
+  ignition::plugin::PluginPtr dartsim =
+      loader.Instantiate("ignition::physics::dartsim::Plugin");
+
+  auto world = LoadWorld<FrameDataCacheFeatureList>(
+      dartsim, TEST_WORLD_DIR "/falling.world");
+  ASSERT_NE(nullptr, world);
+  auto engine = world->GetEngine();
+
+  // Step so that the velocities and accelerations are not all zero
+  StepWorld(world, 10);
+
+  auto link = world->GetModel("sphere")->GetLink(0);
+  auto boxLink = world->GetModel("box")->GetLink(0);
+
+  using FrameSemanticsImpl =
+      ignition::physics::FrameSemantics::Implementation<
+        ignition::physics::FeaturePolicy3d>;
+  auto *impl = dartsim->QueryInterface<FrameSemanticsImpl>();
+  ASSERT_NE(nullptr, impl);
+
+  const ignition::physics::FrameData3d full =
+      link->FrameDataRelativeToWorld();
+  EXPECT_NE(Eigen::Vector3d::Zero(), full.linearVelocity);
+
+  ignition::physics::FrameData3d selected =
+      impl->SelectedFrameDataRelativeToWorld(
+        link->GetFrameID(), ignition::physics::FRAME_DATA_POSE);
+  EXPECT_TRUE(ignition::physics::test::Equal(full.pose, selected.pose, 1e-12));
+  EXPECT_EQ(Eigen::Vector3d::Zero(), selected.linearVelocity);
+  EXPECT_EQ(Eigen::Vector3d::Zero(), selected.angularVelocity);
+  EXPECT_EQ(Eigen::Vector3d::Zero(), selected.linearAcceleration);
+  EXPECT_EQ(Eigen::Vector3d::Zero(), selected.angularAcceleration);
+
+  selected = impl->SelectedFrameDataRelativeToWorld(
+        link->GetFrameID(), ignition::physics::FRAME_DATA_ALL);
+  EXPECT_TRUE(ignition::physics::test::Equal(full, selected, 1e-12));
+
+  // Resolving a pose against another link only needs the poses
+  const ignition::physics::RelativePose3d offset(
+        link->GetFrameID(), Eigen::Isometry3d::Identity());
+  EXPECT_TRUE(ignition::physics::test::Equal(
+      link->FrameDataRelativeTo(*boxLink).pose,
+      engine->Resolve(offset, boxLink->GetFrameID()), 1e-12));
+
+  // The cache always holds complete frame data
+  engine->EnableFrameDataCache(true);
+  impl->SelectedFrameDataRelativeToWorld(
+        link->GetFrameID(), ignition::physics::FRAME_DATA_POSE);
+  EXPECT_TRUE(ignition::physics::test::Equal(
+      full, link->FrameDataRelativeToWorld(), 1e-12));
+  const auto stats = engine->GetFrameDataCacheStatistics();
+  EXPECT_EQ(1u, stats.hits);
+  EXPECT_EQ(1u, stats.misses);
+}
+
+struct CollisionDetectorFeatureList : ignition::physics::FeatureList<
+    TestFeatureList,
+    ignition::physics::CollisionDetector
+> { };
+
+// Test that the collision detector can be changed at runtime and from SDF,
+// and that collide bitmasks keep working after the change
+TEST(DartsimSimulationFeatures, CollisionDetector)
+{
+  auto world = LoadDartsimWorld<CollisionDetectorFeatureList>(
+      TEST_WORLD_DIR "/shapes_bitmask.sdf");
+  ASSERT_NE(nullptr, world);
+  EXPECT_EQ("ode", world->GetCollisionDetector());
+
+  world->SetCollisionDetector("dart");
+  EXPECT_EQ("dart", world->GetCollisionDetector());
+
+  // Unknown detectors are rejected
+  world->SetCollisionDetector("not_a_detector");
+  EXPECT_EQ("dart", world->GetCollisionDetector());
+
+  // Only box_colliding touches the base box
+  StepWorld(world);
+  EXPECT_FALSE(world->GetContactsFromLastStep().empty());
+
+  auto collidingShape =
+      world->GetModel("box_colliding")->GetLink(0)->GetShape(0);
+  collidingShape->SetCollisionFilterMask(0xF0);
+  StepWorld(world);
+  EXPECT_TRUE(world->GetContactsFromLastStep().empty());
+
+  // The collision detector can also be chosen in the physics profile
+  const std::string worldStr =
+      "<?xml version='1.0'?><sdf version='1.7'><world name='detector'>"
+      "<physics name='default' type='dart'><dart>"
+      "<collision_detector>fcl</collision_detector>"
+      "</dart></physics></world></sdf>";
+  sdf::Root fclRoot;
+  ASSERT_TRUE(fclRoot.LoadSdfString(worldStr).empty());
+  auto fclWorld = world->GetEngine()->ConstructWorld(*fclRoot.WorldByIndex(0));
+  ASSERT_NE(nullptr, fclWorld);
+  EXPECT_EQ("fcl", fclWorld->GetCollisionDetector());
+}
+
+struct SolverFeatureList : ignition::physics::FeatureList<
+    TestFeatureList,
+    ignition::physics::Solver
+> { };
+
+// Test that the constraint solver and its iteration limit can be changed at
+// runtime and from SDF
+TEST(DartsimSimulationFeatures, Solver)
+{
+  auto world = LoadDartsimWorld<SolverFeatureList>(
+      TEST_WORLD_DIR "/falling.world");
+  ASSERT_NE(nullptr, world);
+  EXPECT_EQ("dantzig", world->GetSolver());
+
+  // Only the pgs solver has an iteration limit
+  EXPECT_EQ(0u, world->GetSolverIterations());
+  world->SetSolverIterations(5u);
+  EXPECT_EQ(0u, world->GetSolverIterations());
+  world->SetSolver("pgs");
+  EXPECT_EQ("pgs", world->GetSolver());
+  world->SetSolverIterations(5u);
+  EXPECT_EQ(5u, world->GetSolverIterations());
+
+  // The iteration limit is kept when the solver changes
+  world->SetSolver("dantzig");
+  EXPECT_EQ(0u, world->GetSolverIterations());
+  world->SetSolver("pgs");
+  EXPECT_EQ(5u, world->GetSolverIterations());
+
+  // Invalid requests are rejected
+  world->SetSolver("not_a_solver");
+  EXPECT_EQ("pgs", world->GetSolver());
+  world->SetSolverIterations(0u);
+  EXPECT_EQ(5u, world->GetSolverIterations());
+
+  // The sphere still comes to rest on the box
+  StepWorld(world, 2000);
+
+  const auto link = world->GetModel("sphere")->GetLink(0);
+  EXPECT_NEAR(0.0, link->FrameDataRelativeToWorld().linearVelocity.z(), 1e-2);
+  EXPECT_GT(link->FrameDataRelativeToWorld().pose.translation().z(), 0.0);
+
+  // The solver can also be chosen in the physics profile
+  const std::string worldStr =
+      "<?xml version='1.0'?><sdf version='1.7'><world name='solver'>"
+      "<physics name='default' type='dart'><dart><solver>"
+      "<solver_type>pgs</solver_type>"
+      "</solver></dart></physics></world></sdf>";
+  sdf::Root pgsRoot;
+  ASSERT_TRUE(pgsRoot.LoadSdfString(worldStr).empty());
+  auto pgsWorld = world->GetEngine()->ConstructWorld(*pgsRoot.WorldByIndex(0));
+  ASSERT_NE(nullptr, pgsWorld);
+  EXPECT_EQ("pgs", pgsWorld->GetSolver());
+}
+
+struct ReduceContactsFeatureList : ignition::physics::FeatureList<
+    TestFeatureList,
+    ignition::physics::ReduceContactsFeature
+> { };
+
+// Test that contacts are reduced per pair of shapes and that the forces of
+// the dropped contacts and their moments are kept
+TEST(DartsimSimulationFeatures, ReduceContacts)
+{
+  auto world = LoadDartsimWorld<ReduceContactsFeatureList>(
+      TEST_WORLD_DIR "/shapes_bitmask.sdf");
+  ASSERT_NE(nullptr, world);
+  EXPECT_EQ(0u, world->GetMaxContactsPerShapePair());
+
+  StepWorld(world);
+
+  // Every contact is reported by default
+  const auto sumForces = [](const auto &_contacts)
+  {
+    Eigen::Vector3d sum = Eigen::Vector3d::Zero();
+    for (const auto &contact : _contacts)
+      sum += contact.template Get<ExtraContactData>().force;
+    return sum;
+  };
+
+  const auto sumMoments = [](const auto &_contacts)
+  {
+    Eigen::Vector3d sum = Eigen::Vector3d::Zero();
+    for (const auto &contact : _contacts)
+    {
+      sum += contact.template Get<ContactPoint>().point.cross(
+          contact.template Get<ExtraContactData>().force);
+    }
+    return sum;
+  };
+
+  const auto allContacts = world->GetContactsFromLastStep();
+  ASSERT_EQ(4u, allContacts.size());
+  EXPECT_DOUBLE_EQ(1.0, world->GetContactReductionFactor());
+
+  // The contacts lie on the face of a box, so three of them span the plane
+  // and keep the moment as well
+  world->SetMaxContactsPerShapePair(3u);
+  auto contacts = world->GetContactsFromLastStep();
+  ASSERT_EQ(3u, contacts.size());
+  EXPECT_TRUE(ignition::physics::test::Equal(
+      sumForces(allContacts), sumForces(contacts), 1e-9));
+  EXPECT_TRUE(ignition::physics::test::Equal(
+      sumMoments(allContacts), sumMoments(contacts), 1e-3));
+
+  // Only one pair of shapes touches, so its contacts are merged into two
+  world->SetMaxContactsPerShapePair(2u);
+  EXPECT_EQ(2u, world->GetMaxContactsPerShapePair());
+  contacts = world->GetContactsFromLastStep();
+  ASSERT_EQ(2u, contacts.size());
+  EXPECT_DOUBLE_EQ(2.0, world->GetContactReductionFactor());
+  EXPECT_TRUE(ignition::physics::test::Equal(
+      sumForces(allContacts), sumForces(contacts), 1e-9));
+
+  world->SetMaxContactsPerShapePair(1u);
+  contacts = world->GetContactsFromLastStep();
+  ASSERT_EQ(1u, contacts.size());
+  EXPECT_DOUBLE_EQ(4.0, world->GetContactReductionFactor());
+  EXPECT_TRUE(ignition::physics::test::Equal(
+      sumForces(allContacts), sumForces(contacts), 1e-9));
+
+  // Removing the limit reports every contact again
+  world->SetMaxContactsPerShapePair(0u);
+  EXPECT_EQ(4u, world->GetContactsFromLastStep().size());
+}
+
+struct ChangedWorldPosesFeatureList : ignition::physics::FeatureList<
+    TestFeatureList,
+    ignition::physics::GetChangedWorldPosesFeature
+> { };
+
+// Test that only the entities that moved during a step are reported
+TEST(DartsimSimulationFeatures, ChangedWorldPoses)
+{
+  auto world = LoadDartsimWorld<ChangedWorldPosesFeatureList>(
+      TEST_WORLD_DIR "/falling.world");
+  ASSERT_NE(nullptr, world);
+
+  auto sphere = world->GetModel("sphere");
+  auto sphereLink = sphere->GetLink(0);
+
+  // The first request reports every entity
+  auto changes = world->GetChangedWorldPoses();
+  EXPECT_EQ(2u, changes.models.size());
+  EXPECT_EQ(2u, changes.links.size());
+
+  // Only the falling sphere moves, the static box does not
+  StepWorld(world);
+  changes = world->GetChangedWorldPoses();
+  ASSERT_EQ(1u, changes.models.size());
+  EXPECT_EQ(sphere->EntityID(), changes.models[0].body);
+  ASSERT_EQ(1u, changes.links.size());
+  EXPECT_EQ(sphereLink->EntityID(), changes.links[0].body);
+  EXPECT_EQ(ignition::math::eigen3::convert(
+      sphereLink->FrameDataRelativeToWorld().pose), changes.links[0].pose);
+
+  // Movements below the tolerance are not reported until they add up
+  world->SetPoseChangeTolerance(0.1, 0.1);
+  StepWorld(world);
+  changes = world->GetChangedWorldPoses();
+  EXPECT_TRUE(changes.models.empty());
+  EXPECT_TRUE(changes.links.empty());
+
+  std::size_t steps = 1;
+  for (; steps < 10000 && changes.links.empty(); ++steps)
+  {
+    StepWorld(world);
+    changes = world->GetChangedWorldPoses();
   }
+  EXPECT_GT(steps, 1u);
+  EXPECT_EQ(1u, changes.links.size());
 }
 
 INSTANTIATE_TEST_CASE_P(PhysicsPlugins, SimulationFeatures_TEST,
@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2018 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include "WorldFeatures.hh"
+
+#include <memory>
+#include <string>
+
+#include <dart/collision/CollisionDetector.hpp>
+#include <dart/collision/dart/DARTCollisionDetector.hpp>
+#include <dart/collision/fcl/FCLCollisionDetector.hpp>
+#include <dart/collision/ode/OdeCollisionDetector.hpp>
+#include <dart/constraint/BoxedLcpConstraintSolver.hpp>
+#include <dart/constraint/ConstraintSolver.hpp>
+#include <dart/constraint/DantzigBoxedLcpSolver.hpp>
+#include <dart/constraint/PgsBoxedLcpSolver.hpp>
+
+#ifdef IGNITION_PHYSICS_DARTSIM_HAVE_BULLET
+#include <dart/collision/bullet/BulletCollisionDetector.hpp>
+#endif
+
+#include <ignition/common/Console.hh>
+
+namespace ignition {
+namespace physics {
+namespace dartsim {
+
+namespace {
+/////////////////////////////////////////////////
+/// \brief Create the collision detector with the given name, or return
+/// nullptr if it is unknown or dartsim was not built with it.
+std::shared_ptr<dart::collision::CollisionDetector> CreateCollisionDetector(
+    const std::string &_name)
+{
+  if (_name == dart::collision::FCLCollisionDetector::getStaticType())
+    return dart::collision::FCLCollisionDetector::create();
+
+  if (_name == dart::collision::DARTCollisionDetector::getStaticType())
+    return dart::collision::DARTCollisionDetector::create();
+
+  if (_name == dart::collision::OdeCollisionDetector::getStaticType())
+    return dart::collision::OdeCollisionDetector::create();
+
+#ifdef IGNITION_PHYSICS_DARTSIM_HAVE_BULLET
+  if (_name == dart::collision::BulletCollisionDetector::getStaticType())
+    return dart::collision::BulletCollisionDetector::create();
+#endif
+
+  return nullptr;
+}
+
+/// \brief Names of the solvers accepted by WorldFeatures::SetWorldSolver
+const std::string kDantzigSolver = "dantzig";
+const std::string kPgsSolver = "pgs";
+
+/////////////////////////////////////////////////
+/// \brief Get the projected Gauss-Seidel solver of a constraint solver. The
+/// solvers that WorldFeatures configures always have one, either as their
+/// primary solver or as the fallback of the Dantzig solver.
+std::shared_ptr<const dart::constraint::PgsBoxedLcpSolver> GetPgsSolver(
+    const dart::constraint::BoxedLcpConstraintSolver &_solver)
+{
+  auto pgs =
+      std::dynamic_pointer_cast<const dart::constraint::PgsBoxedLcpSolver>(
+        _solver.getBoxedLcpSolver());
+  if (!pgs)
+  {
+    pgs =
+        std::dynamic_pointer_cast<const dart::constraint::PgsBoxedLcpSolver>(
+          _solver.getSecondaryBoxedLcpSolver());
+  }
+  return pgs;
+}
+}
+
+/////////////////////////////////////////////////
+void WorldFeatures::SetWorldCollisionDetector(
+    const Identity &_worldID, const std::string &_collisionDetector)
+{
+  auto *world = this->ReferenceInterface<DartWorld>(_worldID);
+  auto *solver = world->getConstraintSolver();
+  if (solver->getCollisionDetector()->getType() == _collisionDetector)
+    return;
+
+  auto detector = CreateCollisionDetector(_collisionDetector);
+  if (!detector)
+  {
+    ignerr << "Collision detector [" << _collisionDetector << "] is not "
+           << "supported by this build of dartsim. World ["
+           << world->getName() << "] keeps using ["
+           << solver->getCollisionDetector()->getType() << "].\n";
+    return;
+  }
+
+  // The solver rebuilds its collision group with the shapes of every
+  // skeleton of the world. The collision option, which holds the contact
+  // filter, belongs to the solver and is left untouched.
+  solver->setCollisionDetector(detector);
+}
+
+/////////////////////////////////////////////////
+std::string WorldFeatures::GetWorldCollisionDetector(
+    const Identity &_worldID) const
+{
+  const auto *world = this->ReferenceInterface<DartWorld>(_worldID);
+  return world->getConstraintSolver()->getCollisionDetector()->getType();
+}
+
+/////////////////////////////////////////////////
+void WorldFeatures::SetWorldSolver(
+    const Identity &_worldID, const std::string &_solver)
+{
+  auto *world = this->ReferenceInterface<DartWorld>(_worldID);
+  auto *solver = dynamic_cast<dart::constraint::BoxedLcpConstraintSolver*>(
+      world->getConstraintSolver());
+  if (!solver)
+  {
+    ignerr << "World [" << world->getName() << "] does not use a boxed LCP "
+           << "constraint solver, so its solver cannot be changed.\n";
+    return;
+  }
+
+  if (_solver != kDantzigSolver && _solver != kPgsSolver)
+  {
+    ignerr << "Solver [" << _solver << "] is not supported. World ["
+           << world->getName() << "] keeps using ["
+           << this->GetWorldSolver(_worldID) << "].\n";
+    return;
+  }
+
+  // Carry the iteration limit over to the new projected Gauss-Seidel solver
+  auto pgs = std::make_shared<dart::constraint::PgsBoxedLcpSolver>();
+  if (const auto oldPgs = GetPgsSolver(*solver))
+    pgs->setOption(oldPgs->getOption());
+
+  if (_solver == kDantzigSolver)
+  {
+    solver->setBoxedLcpSolver(
+        std::make_shared<dart::constraint::DantzigBoxedLcpSolver>());
+    solver->setSecondaryBoxedLcpSolver(pgs);
+  }
+  else
+  {
+    solver->setBoxedLcpSolver(pgs);
+    solver->setSecondaryBoxedLcpSolver(nullptr);
+  }
+}
+
+/////////////////////////////////////////////////
+std::string WorldFeatures::GetWorldSolver(const Identity &_worldID) const
+{
+  const auto *world = this->ReferenceInterface<DartWorld>(_worldID);
+  const auto *solver =
+      dynamic_cast<const dart::constraint::BoxedLcpConstraintSolver*>(
+        world->getConstraintSolver());
+  if (!solver)
+    return "";
+
+  if (std::dynamic_pointer_cast<const dart::constraint::PgsBoxedLcpSolver>(
+        solver->getBoxedLcpSolver()))
+  {
+    return kPgsSolver;
+  }
+  return kDantzigSolver;
+}
+
+/////////////////////////////////////////////////
+void WorldFeatures::SetWorldSolverIterations(
+    const Identity &_worldID, std::size_t _iterations)
+{
+  auto *world = this->ReferenceInterface<DartWorld>(_worldID);
+  if (_iterations == 0)
+  {
+    ignerr << "The solver of world [" << world->getName() << "] needs at "
+           << "least one iteration.\n";
+    return;
+  }
+
+  // The dantzig solver is not iterative. Changing the limit of its projected
+  // Gauss-Seidel fallback would only affect the steps where it fails.
+  const std::string currentSolver = this->GetWorldSolver(_worldID);
+  if (currentSolver != kPgsSolver)
+  {
+    ignerr << "Only the [" << kPgsSolver << "] solver has an iteration "
+           << "limit. World [" << world->getName() << "] uses ["
+           << currentSolver << "].\n";
+    return;
+  }
+
+  auto *solver = static_cast<dart::constraint::BoxedLcpConstraintSolver*>(
+      world->getConstraintSolver());
+
+  // dartsim only hands out const solvers, so replace the projected
+  // Gauss-Seidel solver with one that has the new limit
+  auto pgs = std::make_shared<dart::constraint::PgsBoxedLcpSolver>();
+  auto option = GetPgsSolver(*solver)->getOption();
+  option.mMaxIteration = static_cast<int>(_iterations);
+  pgs->setOption(option);
+  solver->setBoxedLcpSolver(pgs);
+}
+
+/////////////////////////////////////////////////
+std::size_t WorldFeatures::GetWorldSolverIterations(
+    const Identity &_worldID) const
+{
+  if (this->GetWorldSolver(_worldID) != kPgsSolver)
+    return 0u;
+
+  const auto *world = this->ReferenceInterface<DartWorld>(_worldID);
+  const auto *solver =
+      static_cast<const dart::constraint::BoxedLcpConstraintSolver*>(
+        world->getConstraintSolver());
+  return static_cast<std::size_t>(
+      GetPgsSolver(*solver)->getOption().mMaxIteration);
+}
+
+}
+}
+}
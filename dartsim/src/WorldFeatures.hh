@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2018 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_DARTSIM_SRC_WORLDFEATURES_HH_
+#define IGNITION_PHYSICS_DARTSIM_SRC_WORLDFEATURES_HH_
+
+#include <string>
+
+#include <ignition/physics/World.hh>
+
+#include "Base.hh"
+
+namespace ignition {
+namespace physics {
+namespace dartsim {
+
+struct WorldFeatureList : FeatureList<
+  CollisionDetector,
+  Solver
+> { };
+
+class WorldFeatures :
+    public virtual Base,
+    public virtual Implements3d<WorldFeatureList>
+{
+  // Documentation inherited
+  public: void SetWorldCollisionDetector(
+      const Identity &_worldID, const std::string &_collisionDetector)
+      override;
+
+  // Documentation inherited
+  public: std::string GetWorldCollisionDetector(const Identity &_worldID)
+      const override;
+
+  // Documentation inherited
+  public: void SetWorldSolver(
+      const Identity &_worldID, const std::string &_solver) override;
+
+  // Documentation inherited
+  public: std::string GetWorldSolver(const Identity &_worldID) const override;
+
+  // Documentation inherited
+  public: void SetWorldSolverIterations(
+      const Identity &_worldID, std::size_t _iterations) override;
+
+  // Documentation inherited
+  public: std::size_t GetWorldSolverIterations(const Identity &_worldID)
+      const override;
+};
+
+}
+}
+}
+
+#endif
@@ -25,6 +25,7 @@
 #include "SDFFeatures.hh"
 #include "ShapeFeatures.hh"
 #include "SimulationFeatures.hh"
+#include "WorldFeatures.hh"
 #include "EntityManagementFeatures.hh"
 #include "FreeGroupFeatures.hh"
 
@@ -41,7 +42,8 @@ struct DartsimFeatures : FeatureList<
   LinkFeatureList,
   SDFFeatureList,
   ShapeFeatureList,
-  SimulationFeatureList
+  SimulationFeatureList,
+  WorldFeatureList
   // TODO(MXG): Implement more features
 > { };
 
@@ -55,7 +57,8 @@ class Plugin :
     public virtual LinkFeatures,
     public virtual SDFFeatures,
     public virtual ShapeFeatures,
-    public virtual SimulationFeatures { };
+    public virtual SimulationFeatures,
+    public virtual WorldFeatures { };
 
 IGN_PHYSICS_ADD_PLUGIN(Plugin, FeaturePolicy3d, DartsimFeatures)
 
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_CHANGEDWORLDPOSES_HH_
+#define IGNITION_PHYSICS_CHANGEDWORLDPOSES_HH_
+
+#include <vector>
+
+#include <ignition/physics/FeatureList.hh>
+#include <ignition/physics/ForwardStep.hh>
+
+namespace ignition
+{
+  namespace physics
+  {
+    /////////////////////////////////////////////////
+    /// \brief The links and models whose world pose changed, with their new
+    /// world poses. The body field of each entry is the entity ID of the link
+    /// or model.
+    struct WorldPoseChanges
+    {
+      std::vector<WorldPose> links;
+      std::vector<WorldPose> models;
+    };
+
+    /////////////////////////////////////////////////
+    /// \brief This feature reports only the links and models of a world that
+    /// moved during the last step, so that callers which republish poses do
+    /// not need to query and compare every entity after each step.
+    ///
+    /// An entity is reported when its world pose differs from the pose that
+    /// was last reported for it by more than the tolerance, so slow drift is
+    /// reported once it adds up. Engines start tracking a world the first time
+    /// its changes are requested, and that first request reports every entity
+    /// of the world.
+    class IGNITION_PHYSICS_VISIBLE GetChangedWorldPosesFeature
+      : public virtual Feature
+    {
+      public: template <typename PolicyT, typename FeaturesT>
+      class World : public virtual Feature::World<PolicyT, FeaturesT>
+      {
+        /// \brief Get the links and models whose world pose changed during
+        /// the last step.
+        public: WorldPoseChanges GetChangedWorldPoses()
+        {
+          return this->template Interface<GetChangedWorldPosesFeature>()
+              ->GetChangedWorldPoses(this->identity);
+        }
+
+        /// \brief Set how far an entity must move before it is reported as
+        /// changed. Both tolerances default to 1e-6.
+        /// \param[in] _linear Distance that the origin of the entity must
+        /// move
+        /// \param[in] _angular Angle that the entity must turn, in radians
+        public: void SetPoseChangeTolerance(double _linear, double _angular)
+        {
+          this->template Interface<GetChangedWorldPosesFeature>()
+              ->SetPoseChangeTolerance(this->identity, _linear, _angular);
+        }
+      };
+
+      public: template <typename PolicyT>
+      class Implementation : public virtual Feature::Implementation<PolicyT>
+      {
+        public: virtual WorldPoseChanges GetChangedWorldPoses(
+            const Identity &_worldID) = 0;
+
+        public: virtual void SetPoseChangeTolerance(
+            const Identity &_worldID, double _linear, double _angular) = 0;
+      };
+    };
+  }
+}
+
+#endif
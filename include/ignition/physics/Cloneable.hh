@@ -18,6 +18,7 @@
 #ifndef IGNITION_PHYSICS_CLONEABLE_HH_
 #define IGNITION_PHYSICS_CLONEABLE_HH_
 
+#include <cstddef>
 #include <memory>
 
 namespace ignition
@@ -60,6 +61,61 @@ namespace ignition
       /// type of other is the same as the fully-derived type of this object.
       /// \param[in] _other Instance to move into this object.
       public: virtual void Copy(Cloneable &&_other) = 0;
+
+      /// \brief Override this function to allow your Cloneable type to be
+      /// cloned into storage that is owned by the caller. The caller must run
+      /// the destructor of the clone, but must not delete it.
+      ///
+      /// The default implementation returns nullptr, so callers fall back to
+      /// Clone(), which allocates the clone on the heap.
+      /// \param[in] _buffer
+      ///   Storage aligned to alignof(std::max_align_t)
+      /// \param[in] _size
+      ///   Number of bytes available in _buffer
+      /// \return A pointer to the clone, or nullptr if the fully-derived type
+      /// of this object does not fit in _buffer. Nothing is constructed in
+      /// that case.
+      public: virtual Cloneable *CloneInto(
+          void * /*_buffer*/, std::size_t /*_size*/) const
+      {
+        return nullptr;
+      }
+
+      /// \brief Same as CloneInto(~), except that the new object consumes the
+      /// value of this object instead of copying it. The default
+      /// implementation returns nullptr.
+      /// \param[in] _buffer
+      ///   Storage aligned to alignof(std::max_align_t)
+      /// \param[in] _size
+      ///   Number of bytes available in _buffer
+      /// \return A pointer to the new object, or nullptr if it does not fit
+      public: virtual Cloneable *MoveInto(
+          void * /*_buffer*/, std::size_t /*_size*/)
+      {
+        return nullptr;
+      }
+    };
+
+    /// \brief Deleter for a Cloneable object that may have been constructed
+    /// in storage owned by someone else using Cloneable::CloneInto(~) or
+    /// Cloneable::MoveInto(~). Only the destructor of such an object is run.
+    /// \private
+    struct CloneableDeleter
+    {
+      /// \brief True if the object lives in storage that it does not own
+      public: bool inlined = false;
+
+      /// \brief Destroy the object, and free it if it was allocated on the
+      /// heap
+      /// \param[in] _ptr
+      ///   The object to destroy
+      public: void operator()(Cloneable *_ptr) const
+      {
+        if (this->inlined)
+          _ptr->~Cloneable();
+        else
+          delete _ptr;
+      }
     };
 
     /// \brief Assuming the type T follows the Rule of Five or the Rule of Zero
@@ -114,6 +170,13 @@ namespace ignition
 
       // Documentation inherited
       public: void Copy(Cloneable &&_other) final;
+
+      // Documentation inherited
+      public: Cloneable *CloneInto(
+          void *_buffer, std::size_t _size) const final;
+
+      // Documentation inherited
+      public: Cloneable *MoveInto(void *_buffer, std::size_t _size) final;
     };
   }
 }
@@ -18,13 +18,18 @@
 #ifndef IGNITION_PHYSICS_COMPOSITEDATA_HH_
 #define IGNITION_PHYSICS_COMPOSITEDATA_HH_
 
-#include <string>
-#include <map>
+#include <cstddef>
+#include <deque>
+#include <memory>
 #include <set>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <ignition/utilities/SuppressWarning.hh>
 
 #include "ignition/physics/Cloneable.hh"
+#include "ignition/physics/CompositeDataArena.hh"
 #include "ignition/physics/Export.hh"
 
 namespace ignition
@@ -43,6 +48,9 @@ namespace ignition
     class IGNITION_PHYSICS_VISIBLE CompositeData
     {
       /// \brief Default constructor. Creates an empty CompositeData object.
+      /// Its entries are allocated from the CompositeDataArena that is
+      /// current on this thread, or from the heap if there is none. See
+      /// CompositeDataArena::Scope.
       public: CompositeData();
 
       /// \brief Virtual destructor
@@ -954,19 +962,134 @@ namespace ignition
       /// \brief Move operator. Same as Copy(_other).
       public: CompositeData &operator=(CompositeData &&_other);
 
+      /// \brief Process-unique integer that identifies a data type.
+      public: using TypeId = std::size_t;
+
+      /// \brief Get the TypeId of a data type. IDs are handed out the first
+      /// time that each type is used, so they are only meaningful within one
+      /// process.
+      ///
+      /// \tparam Data
+      ///   The type of data whose ID is wanted
+      ///
+      /// \return the ID of the Data type
+      public: template <typename Data>
+      static TypeId TypeIdOf();
+
+      /// \brief Get the TypeId for the label of a data type, and register the
+      /// label if it has not been seen before. IDs are assigned in one place so
+      /// that every shared library gets the same ID for the same type. Use
+      /// TypeIdOf<Data>() rather than calling this directly.
+      ///
+      /// \param[in] _label
+      ///   The label of the type, which is typeid(Data).name()
+      ///
+      /// \return the ID of the type
+      public: static TypeId RegisterDataType(const std::string &_label);
+
       /// \brief Struct which contains information about a data type within the
-      /// CompositeData. See ignition/physics/detail/CompositeData.hh for the
-      /// definition. This class is public so that helper functions can use it
-      /// without being friends of the class.
+      /// CompositeData. This struct is public so that helper functions can use
+      /// it without being friends of the class.
       /// \private
-      public: struct DataEntry;
+      public: struct IGNITION_PHYSICS_VISIBLE DataEntry
+      {
+        /// \brief Owning pointer to the data of an entry. The data may live
+        /// in the buffer of the entry, in which case the deleter only runs
+        /// its destructor.
+        public: using DataPtr = std::unique_ptr<Cloneable, CloneableDeleter>;
+
+        /// \brief Number of bytes of data that an entry can hold without a
+        /// heap allocation. This includes the vtable pointer of the
+        /// MakeCloneable that wraps the data.
+        public: static constexpr std::size_t InlineDataSize = 64;
+
+        /// \brief Default constructor
+        public: DataEntry();
+
+        /// \brief The data of an entry may point into the entry itself, so
+        /// entries cannot be copied. Use CloneFrom(~) instead.
+        public: DataEntry(const DataEntry &) = delete;
+
+        /// \brief The data of an entry may point into the entry itself, so
+        /// entries cannot be copied. Use CloneFrom(~) instead.
+        public: DataEntry &operator=(const DataEntry &) = delete;
+
+        /// \brief Construct the data of this entry, which must be empty. The
+        /// data is stored inline if it fits in InlineDataSize bytes.
+        /// \param[in] _args
+        ///   Arguments that are forwarded to the constructor of Data
+        /// \return a reference to the new data
+        public: template <typename Data, typename... Args>
+        MakeCloneable<Data> &Emplace(Args &&..._args);
+
+        /// \brief Fill this entry, which must be empty, with a clone of
+        /// _other. The clone is stored inline if it fits.
+        /// \param[in] _other
+        ///   The data to clone
+        public: void CloneFrom(const Cloneable &_other);
+
+        /// \brief Move the data of _other into this entry, which must be
+        /// empty. _other is left empty. Heap-allocated data changes owner
+        /// without being moved.
+        /// \param[in] _other
+        ///   The entry to take the data from
+        public: void MoveFrom(DataEntry &_other);
+
+        /// \brief Storage for data that fits in InlineDataSize bytes. This is
+        /// declared before data so that it outlives the object in it.
+        private: alignas(std::max_align_t) unsigned char buffer[InlineDataSize];
+
+        IGN_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+        /// \brief Data that is being held at this entry. nullptr means the
+        /// CompositeData does not have data for this entry
+        public: DataPtr data;
+        IGN_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+
+        /// \brief Flag for whether the type of data at this entry is
+        /// considered to be required. This can be made true during the
+        /// lifetime of the CompositeData, but it must never be changed from
+        /// true to false.
+        public: bool required;
+
+        /// \brief Flag for whether this data entry has been queried since
+        /// either (1) it was created using Copy(~), =, or the CompositeData
+        /// constructor, or (2) the last time ResetQueries() was called,
+        /// whichever was more recent. Functions that can mark an entry as
+        /// queried include Get(), InsertOrAssign(), Insert(), Query(), and
+        /// Has().
+        public: mutable bool queried;
+      };
 
       // We make this typedef public so that helper functions can use it without
       // being friends of the class.
-      public: using MapOfData = std::map<std::string, DataEntry>;
+      /// \brief Flat map from the TypeId of a data type to its entry, sorted
+      /// by TypeId. The entries themselves live in dataEntries.
+      public: using MapOfData = std::vector<
+          std::pair<TypeId, DataEntry*>,
+          CompositeDataArena::Allocator<std::pair<TypeId, DataEntry*>>>;
+
+      /// \brief Find the entry for a data type.
+      /// \param[in] _id The TypeId of the data type
+      /// \return the entry, or nullptr if this CompositeData has never had an
+      /// entry for the type
+      protected: DataEntry *FindEntry(TypeId _id) const;
+
+      /// \brief Find the entry for a data type, and create an empty one if
+      /// this CompositeData does not have one yet.
+      /// \param[in] _id The TypeId of the data type
+      /// \return the entry for the data type
+      protected: DataEntry &FindOrCreateEntry(TypeId _id);
 
       IGN_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
-      /// \brief Map from the label of a data object type to its entry
+      /// \brief Storage for the data entries. Entries are never removed, and
+      /// a deque does not move its elements when it grows, so pointers to the
+      /// entries stay valid for the lifetime of this CompositeData. The
+      /// entries and dataMap allocate from the CompositeDataArena that was
+      /// current when this CompositeData was constructed.
+      protected: std::deque<DataEntry, CompositeDataArena::Allocator<DataEntry>>
+          dataEntries;
+
+      /// \brief Map from the ID of a data object type to its entry
       protected: MapOfData dataMap;
       IGN_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
 
@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_COMPOSITEDATAARENA_HH_
+#define IGNITION_PHYSICS_COMPOSITEDATAARENA_HH_
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+#include <ignition/utilities/SuppressWarning.hh>
+
+#include "ignition/physics/Export.hh"
+
+namespace ignition
+{
+  namespace physics
+  {
+    /// \brief An arena that CompositeData objects can allocate their entries
+    /// from, so that the CompositeData objects which are built and discarded
+    /// during a simulation step do not need to call malloc and free.
+    ///
+    /// Using an arena is opt-in. A CompositeData allocates from the arena of
+    /// a Scope that is active on its thread when it is constructed, and from
+    /// the heap otherwise. Memory from the arena is only released when the
+    /// arena is Reset() or destroyed, so an arena should be reset at the
+    /// boundary of each step:
+    ///
+    /// \code
+    ///     ignition::physics::CompositeDataArena arena;
+    ///     while (running)
+    ///     {
+    ///       {
+    ///         ignition::physics::CompositeDataArena::Scope scope(arena);
+    ///         ForwardStep::Output output;
+    ///         ForwardStep::State state;
+    ///         world->Step(output, state, input);
+    ///         // ... use the output ...
+    ///       }
+    ///       arena.Reset();
+    ///     }
+    /// \endcode
+    ///
+    /// Data that does not fit in the inline storage of a CompositeData entry
+    /// is still allocated on the heap.
+    ///
+    /// \warning An arena must only be used by one thread at a time.
+    class IGNITION_PHYSICS_VISIBLE CompositeDataArena
+    {
+      /// \brief Constructor
+      /// \param[in] _initialSize
+      ///   Number of bytes to reserve for the first block of the arena. The
+      ///   arena grows by itself if more memory is needed.
+      public: explicit CompositeDataArena(std::size_t _initialSize = 16384);
+
+      /// \brief Destructor. Every CompositeData that allocated from this arena
+      /// must have been destroyed.
+      public: ~CompositeDataArena();
+
+      /// \brief An arena cannot be copied.
+      public: CompositeDataArena(const CompositeDataArena &) = delete;
+
+      /// \brief An arena cannot be copied.
+      public: CompositeDataArena &operator=(
+          const CompositeDataArena &) = delete;
+
+      /// \brief Release all of the memory of this arena in one shot, so it can
+      /// be reused for the next step.
+      /// \return false if a CompositeData that allocated from this arena still
+      /// exists. Nothing is released in that case.
+      public: bool Reset();
+
+      /// \brief Get the number of allocations from this arena that have not
+      /// been returned yet. This is 0 once every CompositeData that allocated
+      /// from this arena has been destroyed.
+      /// \return the number of outstanding allocations
+      public: std::size_t OutstandingAllocations() const;
+
+      /// \brief Get the arena that a CompositeData which is constructed on
+      /// this thread right now will allocate from.
+      /// \return the arena of the innermost active Scope on this thread, or
+      /// nullptr if there is none, in which case the heap is used
+      public: static CompositeDataArena *Current();
+
+      /// \brief Allocate memory from this arena. This is used by Allocator.
+      /// \param[in] _bytes
+      ///   Number of bytes to allocate
+      /// \param[in] _alignment
+      ///   Alignment of the memory, which must be a power of two
+      /// \return the memory
+      public: void *Allocate(std::size_t _bytes, std::size_t _alignment);
+
+      /// \brief Return memory that was allocated from this arena. The memory
+      /// is only reused once the arena is Reset().
+      /// \param[in] _memory
+      ///   The memory, which was returned by Allocate(~)
+      public: void Deallocate(void *_memory);
+
+      /// \brief Allocator for the containers of a CompositeData. It allocates
+      /// from the arena that it was given, or from the heap if that is
+      /// nullptr. The arena is only known through a pointer, so the standard
+      /// <memory_resource> header is not needed.
+      public: template <typename T>
+      class Allocator
+      {
+        /// \brief Type of the objects that are allocated
+        public: using value_type = T;
+
+        /// \brief Constructor
+        /// \param[in] _arena
+        ///   The arena to allocate from, or nullptr to use the heap
+        public: explicit Allocator(CompositeDataArena *_arena = nullptr)
+          : arena(_arena)
+        {
+          // Do nothing
+        }
+
+        /// \brief Allocators of other types that use the same arena are
+        /// needed by the containers.
+        /// \param[in] _other
+        ///   The allocator whose arena is used
+        public: template <typename U>
+        Allocator(const Allocator<U> &_other)
+          : arena(_other.arena)
+        {
+          // Do nothing
+        }
+
+        /// \brief Allocate memory for _n objects
+        /// \param[in] _n
+        ///   Number of objects
+        /// \return the memory
+        public: T *allocate(const std::size_t _n)
+        {
+          if (this->arena)
+          {
+            return static_cast<T*>(
+                this->arena->Allocate(_n * sizeof(T), alignof(T)));
+          }
+
+          return static_cast<T*>(::operator new(_n * sizeof(T)));
+        }
+
+        /// \brief Return memory that was allocated by allocate(~)
+        /// \param[in] _memory
+        ///   The memory
+        public: void deallocate(T *_memory, std::size_t /*_n*/)
+        {
+          if (this->arena)
+            this->arena->Deallocate(_memory);
+          else
+            ::operator delete(_memory);
+        }
+
+        /// \brief Allocators are equal if they allocate from the same place
+        public: template <typename U>
+        bool operator==(const Allocator<U> &_other) const
+        {
+          return this->arena == _other.arena;
+        }
+
+        /// \brief Allocators are equal if they allocate from the same place
+        public: template <typename U>
+        bool operator!=(const Allocator<U> &_other) const
+        {
+          return this->arena != _other.arena;
+        }
+
+        /// \brief The arena to allocate from, or nullptr for the heap
+        private: CompositeDataArena *arena;
+
+        template <typename> friend class Allocator;
+      };
+
+      /// \brief While an object of this class exists, CompositeData objects
+      /// that are constructed on its thread allocate from its arena. Scopes
+      /// can be nested; the innermost one wins.
+      public: class IGNITION_PHYSICS_VISIBLE Scope
+      {
+        /// \brief Constructor
+        /// \param[in] _arena
+        ///   The arena to allocate from. It must outlive this Scope.
+        public: explicit Scope(CompositeDataArena &_arena);
+
+        /// \brief Destructor. Restores the previous arena of this thread.
+        public: ~Scope();
+
+        /// \brief A scope cannot be copied.
+        public: Scope(const Scope &) = delete;
+
+        /// \brief A scope cannot be copied.
+        public: Scope &operator=(const Scope &) = delete;
+
+        /// \brief The arena that was current before this Scope
+        private: CompositeDataArena *previous;
+      };
+
+      /// \brief The blocks of memory of this arena, and the count of the
+      /// allocations which have not been returned yet
+      private: class Resource;
+
+      IGN_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      /// \brief The memory of this arena
+      private: std::unique_ptr<Resource> resource;
+      IGN_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+    };
+  }
+}
+
+#endif
@@ -21,6 +21,7 @@
 #include <optional>
 #include <limits>
 #include <memory>
+#include <string>
 
 #include <ignition/physics/Export.hh>
 #include <ignition/physics/detail/Identity.hh>
@@ -282,6 +283,36 @@ namespace ignition
       protected: template <typename F>
       const typename F::template Implementation<Policy> *Interface() const;
 
+      /// \brief Get the identity of the entity called _name that belongs to
+      /// this entity. The engine of this entity remembers the identities that
+      /// it has found, so repeated lookups do not ask the engine again. See
+      /// detail::EntityHandleCache.
+      /// \param[in] _impl
+      ///   The implementation of the feature that performs the lookup
+      /// \param[in] _kind
+      ///   The kind of entity to look up
+      /// \param[in] _name
+      ///   The name of the entity to look up
+      /// \param[in] _lookup
+      ///   A callable that asks the engine for the identity. It is only called
+      ///   if the identity is not known yet.
+      /// \return The identity of the entity, or an invalid identity if the
+      /// engine could not find it.
+      protected: template <typename LookupT>
+      Identity IdentityByName(
+          const detail::Implementation &_impl,
+          detail::EntityHandleCache::Kind _kind,
+          const std::string &_name,
+          const LookupT &_lookup) const;
+
+      /// \brief Forget the identities that were found by IdentityByName.
+      /// Features must call this after changing the structure of an engine in
+      /// a way that could remove entities or change what a name refers to.
+      /// \param[in] _impl
+      ///   The implementation of the feature that made the change
+      protected: static void ClearIdentitiesByName(
+          const detail::Implementation &_impl);
+
       /// \brief This is a pointer to the physics engine implementation, and it
       /// can be used by the object features to find the interfaces that they
       /// need in order to function.
@@ -40,6 +40,7 @@ namespace ignition
     {
       ignition::math::Pose3d pose;
 
+      /// \brief Entity ID of the link, as returned by Link::EntityID()
       std::size_t body;
     };
 
@@ -66,17 +67,60 @@ namespace ignition
 
     struct JointPositions
     {
+      /// \brief Entity ID of the joint that each position belongs to. A
+      /// joint with several degrees of freedom appears in consecutive entries,
+      /// one for each of its DOFs, in DOF order.
       std::vector<std::size_t> dofs;
       std::vector<double> positions;
       std::string annotation;
     };
 
+    struct Contact
+    {
+      /// \brief Entity ID of the collision shape of the first body
+      std::size_t collision1;
+
+      /// \brief Entity ID of the collision shape of the second body
+      std::size_t collision2;
+
+      /// \brief The point of contact expressed in the world frame
+      ignition::math::Vector3d point;
+
+      /// \brief The contact force acting on the first body expressed in the
+      /// world frame
+      ignition::math::Vector3d force;
+
+      /// \brief The normal of the force acting on the first body expressed in
+      /// the world frame
+      ignition::math::Vector3d normal;
+
+      /// \brief The penetration depth
+      double depth;
+    };
+
+    /// \brief The contacts of the step, with the same content as
+    /// GetContactsFromLastStep. Engines that do not compute the force, normal
+    /// or depth of a contact leave them at zero.
     struct Contacts
     {
-      std::vector<Point> entries;
+      std::vector<Contact> entries;
       std::string annotation;
     };
 
+    /// \brief Written by engines that put resting models to sleep, while
+    /// sleeping is enabled
+    struct SleepStatistics
+    {
+      /// \brief Number of models that were put to sleep during the step
+      std::size_t fellAsleep;
+
+      /// \brief Number of models that woke up since the previous step
+      std::size_t wokeUp;
+
+      /// \brief Number of models that are asleep after the step
+      std::size_t asleep;
+    };
+
     // ---------------- Input Data Structures -----------------
     // Same note as for Output Data Structures. Eventually, these should be
     // defined in some kind of meta files.
@@ -99,6 +143,9 @@ namespace ignition
 
     struct GeneralizedParameters
     {
+      /// \brief Entity ID of the joint that each value applies to. Consecutive
+      /// entries with the same joint apply to DOF 0, 1, 2... of that joint, as
+      /// in JointPositions.
       std::vector<std::size_t> dofs;
       std::vector<double> forces;
       std::string annotation;
@@ -140,6 +187,15 @@ namespace ignition
     /////////////////////////////////////////////////
     /// \brief ForwardStep is a feature that allows a simulation of a world to
     /// take one step forward in time.
+    ///
+    /// The Input carries commands that are applied in bulk before the step,
+    /// so that a single call can replace one feature call per entity. After
+    /// the step, the WorldPoses of the Output lists the pose of every link of
+    /// the world. The Contacts and JointPositions of the Output are only
+    /// filled in when the caller has created them, e.g. with
+    /// _h.Get<JointPositions>(), since collecting them has a cost. Entries of
+    /// the Output are overwritten on every step, so the same Output can be
+    /// reused without reallocating.
     class ForwardStep : public virtual Feature
     {
       public: using Input = ExpectData<
@@ -150,7 +206,7 @@ namespace ignition
 
       public: using Output = SpecifyData<
           RequireData<WorldPoses>,
-          ExpectData<Contacts, JointPositions> >;
+          ExpectData<Contacts, JointPositions, SleepStatistics> >;
 
       public: using State = CompositeData;
 
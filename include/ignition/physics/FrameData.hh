@@ -24,6 +24,24 @@ namespace ignition
 {
   namespace physics
   {
+    /// \brief Bit flags that select the fields of a FrameData that an engine
+    /// should compute. Combine them with the | operator. Fields that are not
+    /// selected are left at zero.
+    enum FrameDataFields : unsigned int
+    {
+      /// \brief The pose of the frame
+      FRAME_DATA_POSE = 1u << 0,
+
+      /// \brief The linear and angular velocities of the frame
+      FRAME_DATA_VELOCITIES = 1u << 1,
+
+      /// \brief The linear and angular accelerations of the frame
+      FRAME_DATA_ACCELERATIONS = 1u << 2,
+
+      /// \brief Every field of the frame
+      FRAME_DATA_ALL =
+          FRAME_DATA_POSE | FRAME_DATA_VELOCITIES | FRAME_DATA_ACCELERATIONS
+    };
 
     /// \brief The FrameData struct fully describes the kinematic state of a
     /// Frame with "Dim" dimensions and "Scalar" precision. Dim is allowed to be
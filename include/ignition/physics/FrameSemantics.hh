@@ -18,6 +18,7 @@
 #ifndef IGNITION_PHYSICS_FRAMESEMANTICS_HH_
 #define IGNITION_PHYSICS_FRAMESEMANTICS_HH_
 
+#include <cstddef>
 #include <memory>
 
 #include <ignition/physics/Feature.hh>
@@ -91,6 +92,48 @@ namespace ignition
         RQ Reframe(const RQ &_quantity,
                    const FrameID &_withRespectTo = FrameID::World()) const;
 
+        /// \brief Resolve an array of quantities. This gives the same results
+        /// as calling Resolve(~) on each quantity, but the data of the frames
+        /// is only retrieved from the engine once for each run of consecutive
+        /// quantities that have the same parent frame. Use this to resolve
+        /// large numbers of quantities, such as point clouds or contact
+        /// forces, that were expressed in a handful of frames.
+        /// \param[in] _quantities Pointer to the first of the quantities
+        /// \param[in] _count Number of quantities to resolve
+        /// \param[out] _resolved Pointer to an array with room for _count
+        /// values, which receives the resolved quantities in the same order
+        /// \param[in] _relativeTo Frame that the quantities are compared
+        /// against
+        /// \param[in] _inCoordinatesOf Frame whose coordinates the values are
+        /// expressed in
+        public: template <typename RQ>
+        void Resolve(
+          const RQ *_quantities,
+          std::size_t _count,
+          typename RQ::Quantity *_resolved,
+          const FrameID &_relativeTo,
+          const FrameID &_inCoordinatesOf) const;
+
+        /// \brief Resolve an array of quantities relative to a frame, and in
+        /// the coordinates of that frame. The World Frame is used by default.
+        public: template <typename RQ>
+        void Resolve(
+          const RQ *_quantities,
+          std::size_t _count,
+          typename RQ::Quantity *_resolved,
+          const FrameID &_relativeTo = FrameID::World()) const;
+
+        /// \brief Reframe an array of quantities. This gives the same results
+        /// as calling Reframe(~) on each quantity, with the data of the frames
+        /// retrieved as described for the array overload of Resolve(~).
+        /// _reframed may be the same array as _quantities to reframe them in
+        /// place.
+        public: template <typename RQ>
+        void Reframe(const RQ *_quantities,
+                     std::size_t _count,
+                     RQ *_reframed,
+                     const FrameID &_withRespectTo = FrameID::World()) const;
+
         template <typename, typename> friend class FrameSemantics::Frame;
       };
 
@@ -144,6 +187,23 @@ namespace ignition
         public: virtual FrameData FrameDataRelativeToWorld(
           const FrameID &_id) const = 0;
 
+        /// \brief Get only some fields of the FrameData of the specified frame
+        /// with respect to the WorldFrame. Resolve uses this to ask for the
+        /// pose alone when a quantity does not depend on the velocities or
+        /// accelerations of its frames.
+        ///
+        /// The default implementation calls FrameDataRelativeToWorld(), so
+        /// engines only need to override it if some fields are expensive to
+        /// compute. Fields that were not selected may be left at zero.
+        ///
+        /// \param[in] _id
+        ///   The frame whose data should be computed.
+        /// \param[in] _fields
+        ///   FrameDataFields that should be filled in.
+        /// \return The data of the frame relative to the world.
+        public: virtual FrameData SelectedFrameDataRelativeToWorld(
+          const FrameID &_id, unsigned int _fields) const;
+
         /// \brief Physics engines can use this function to generate a FrameID
         /// using an existing Identity.
         ///
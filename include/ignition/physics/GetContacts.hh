@@ -100,6 +100,52 @@ class IGNITION_PHYSICS_VISIBLE GetContactsFromLastStepFeature
         const Identity &_worldID) const = 0;
   };
 };
+
+/// \brief ReduceContactsFeature limits the number of contacts that are
+/// reported for each pair of touching shapes. Box-on-plane and mesh contacts
+/// can produce dozens of points per pair. The engine replaces them with a
+/// few representative points that span the same support polygon, and spreads
+/// the forces of the other points over them. The net force of each pair is
+/// kept. Its moment is kept too when the contacts of the pair lie in one
+/// plane and the representatives are not all on one line; otherwise it is
+/// only approximated.
+///
+/// The reduction applies to GetContactsFromLastStep and to the Contacts
+/// output of ForwardStep. It does not change how the world is simulated.
+class IGNITION_PHYSICS_VISIBLE ReduceContactsFeature
+    : public virtual FeatureWithRequirements<GetContactsFromLastStepFeature>
+{
+  public: template <typename PolicyT, typename FeaturesT>
+  class World : public virtual Feature::World<PolicyT, FeaturesT>
+  {
+    /// \brief Set the largest number of contacts to report for each pair of
+    /// shapes of this world.
+    /// \param[in] _maxContacts Contacts per pair of shapes. Zero, which is
+    /// the default, reports every contact.
+    public: void SetMaxContactsPerShapePair(std::size_t _maxContacts);
+
+    /// \brief Get the largest number of contacts that are reported for each
+    /// pair of shapes of this world. Zero means there is no limit.
+    public: std::size_t GetMaxContactsPerShapePair() const;
+
+    /// \brief Get how many contacts the last step found for each contact
+    /// that is reported, which is at least 1.
+    public: double GetContactReductionFactor() const;
+  };
+
+  public: template <typename PolicyT>
+  class Implementation : public virtual Feature::Implementation<PolicyT>
+  {
+    public: virtual void SetWorldMaxContactsPerShapePair(
+        const Identity &_worldID, std::size_t _maxContacts) = 0;
+
+    public: virtual std::size_t GetWorldMaxContactsPerShapePair(
+        const Identity &_worldID) const = 0;
+
+    public: virtual double GetWorldContactReductionFactor(
+        const Identity &_worldID) const = 0;
+  };
+};
 }
 }
 
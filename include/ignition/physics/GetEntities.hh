@@ -79,6 +79,8 @@ namespace ignition
         public: ConstWorldPtrType GetWorld(std::size_t _index) const;
 
         /// \brief Get a world that is being managed by this engine.
+        /// The identity that a name refers to is remembered until a model is
+        /// removed, so repeated lookups of a name do not search again.
         /// \param[in] _name
         ///   Name of the world
         /// \return A world reference. If a world named _name does not exist in
@@ -159,6 +161,8 @@ namespace ignition
         public: ConstModelPtrType GetModel(std::size_t _index) const;
 
         /// \brief Get a Model that exists within this World.
+        /// The identity that a name refers to is remembered until a model is
+        /// removed, so repeated lookups of a name do not search again.
         /// \param[in] _name
         ///   Name of the model within this world.
         /// \return A model reference. If a model named _name does not exist in
@@ -239,6 +243,8 @@ namespace ignition
         public: ConstLinkPtrType GetLink(std::size_t _index) const;
 
         /// \brief Get a Link that exists within this Model.
+        /// The identity that a name refers to is remembered until a model is
+        /// removed, so repeated lookups of a name do not search again.
         /// \param[in] _name
         ///   Name of the Link within this Model.
         /// \return A Link reference. If a Link named _name does not exist in
@@ -319,6 +325,8 @@ namespace ignition
         public: ConstJointPtrType GetJoint(std::size_t _index) const;
 
         /// \brief Get a Joint that exists within this Model.
+        /// The identity that a name refers to is remembered until a model is
+        /// removed, so repeated lookups of a name do not search again.
         /// \param[in] _name
         ///   Name of the Joint within this Model.
         /// \return A Joint reference. If a Joint named _name does not exist in
@@ -399,6 +407,8 @@ namespace ignition
         public: ConstShapePtrType GetShape(std::size_t _index) const;
 
         /// \brief Get a Shape that exists within this Link.
+        /// The identity that a name refers to is remembered until a model is
+        /// removed, so repeated lookups of a name do not search again.
         /// \param[in] _name
         ///   Name of the Shape within this Link
         /// \return A Shape reference. If a Shape named _name does not exist in
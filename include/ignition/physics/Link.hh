@@ -18,6 +18,8 @@
 #ifndef IGNITION_PHYSICS_LINK_HH_
 #define IGNITION_PHYSICS_LINK_HH_
 
+#include <vector>
+
 #include <ignition/physics/FeatureList.hh>
 #include <ignition/physics/FrameID.hh>
 #include <ignition/physics/FrameSemantics.hh>
@@ -129,6 +131,69 @@ namespace ignition
             const Identity &_id, const AngularVectorType &_torque) = 0;
       };
     };
+
+    /////////////////////////////////////////////////
+    /// \brief A packed set of external wrenches to apply to many links at
+    /// once. Entry i of each non-empty array belongs to the link links[i]. All
+    /// quantities are expressed in world coordinates.
+    template <typename Scalar, std::size_t Dim>
+    struct ExternalWrenches
+    {
+      /// \brief Entity IDs of the links, as returned by Link::EntityID()
+      std::vector<std::size_t> links;
+
+      /// \brief Forces to apply. Leave this empty to apply only torques.
+      std::vector<LinearVector<Scalar, Dim>> forces;
+
+      /// \brief Torques to apply. Leave this empty to apply only forces.
+      std::vector<AngularVector<Scalar, Dim>> torques;
+
+      /// \brief Points of application of the forces in the world frame.
+      /// Leave this empty to apply each force at the origin of its link.
+      std::vector<LinearVector<Scalar, Dim>> positions;
+    };
+    IGN_PHYSICS_MAKE_ALL_TYPE_COMBOS(ExternalWrenches)
+
+    /////////////////////////////////////////////////
+    /// \brief This feature applies external wrenches to many links of a world
+    /// in one call. It has the same effect as calling
+    /// AddLinkExternalForceTorque::Link::AddExternalForce and
+    /// AddExternalTorque for each link, without the cost of a separate call
+    /// for each of them.
+    class IGNITION_PHYSICS_VISIBLE AddExternalWrenchesFeature
+      : public virtual Feature
+    {
+      /// \brief The World API for adding external wrenches
+      public: template <typename PolicyT, typename FeaturesT>
+      class World : public virtual Feature::World<PolicyT, FeaturesT>
+      {
+        public: using ExternalWrenchesType =
+            typename FromPolicy<PolicyT>::template Use<ExternalWrenches>;
+
+        /// \brief Add external wrenches to links of this world. The wrenches
+        /// are applied for one simulation step only.
+        ///
+        /// If any non-empty array of _wrenches has a different size than
+        /// _wrenches.links, an error is printed and nothing is applied.
+        /// Entries whose link does not belong to this world are skipped.
+        /// \param[in] _wrenches The wrenches to apply
+        public: void AddExternalWrenches(
+            const ExternalWrenchesType &_wrenches);
+      };
+
+      /// \private The implementation API for adding external wrenches
+      public: template <typename PolicyT>
+      class Implementation : public virtual Feature::Implementation<PolicyT>
+      {
+        public: using ExternalWrenchesType =
+            typename FromPolicy<PolicyT>::template Use<ExternalWrenches>;
+
+        // see World::AddExternalWrenches above
+        public: virtual void AddWorldExternalWrenches(
+            const Identity &_worldID,
+            const ExternalWrenchesType &_wrenches) = 0;
+      };
+    };
   }
 }
 
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_LINKFRAMEDATA_HH_
+#define IGNITION_PHYSICS_LINKFRAMEDATA_HH_
+
+#include <vector>
+
+#include <ignition/physics/FeatureList.hh>
+#include <ignition/physics/FrameData.hh>
+
+namespace ignition
+{
+  namespace physics
+  {
+    /////////////////////////////////////////////////
+    /// \brief This feature gets the frame data of every link of a model or a
+    /// world, relative to the world, in one call. It gives the same data as
+    /// calling FrameDataRelativeToWorld() on each link, without the cost of a
+    /// separate call and entity lookup for each of them.
+    ///
+    /// The data is ordered by the index of each link in its model. For a
+    /// world, the links of the model at index 0 come first, followed by the
+    /// links of the model at index 1, and so on. Entry i of a model therefore
+    /// belongs to the link returned by GetLink(i), and the order only changes
+    /// when models or links are added or removed. Links that an engine merged
+    /// into another link, such as links welded by fixed joints, are included
+    /// at their own index.
+    class IGNITION_PHYSICS_VISIBLE GetLinkFrameDataFeature
+      : public virtual Feature
+    {
+      public: template <typename PolicyT, typename FeaturesT>
+      class World : public virtual Feature::World<PolicyT, FeaturesT>
+      {
+        public: using FrameData =
+            ignition::physics::FrameData<
+              typename PolicyT::Scalar, PolicyT::Dim>;
+
+        /// \brief Get the frame data of every link of this world.
+        /// \param[out] _data Resized to the number of links and filled with
+        /// their frame data. Its capacity is kept, so reusing the same vector
+        /// for each call avoids allocations.
+        /// \param[in] _fields FrameDataFields that should be filled in
+        public: void GetLinkFrameData(
+            std::vector<FrameData> &_data,
+            unsigned int _fields = FRAME_DATA_ALL) const
+        {
+          this->template Interface<GetLinkFrameDataFeature>()
+              ->GetWorldLinkFrameData(this->identity, _data, _fields);
+        }
+      };
+
+      public: template <typename PolicyT, typename FeaturesT>
+      class Model : public virtual Feature::Model<PolicyT, FeaturesT>
+      {
+        public: using FrameData =
+            ignition::physics::FrameData<
+              typename PolicyT::Scalar, PolicyT::Dim>;
+
+        /// \brief Get the frame data of every link of this model.
+        /// \param[out] _data Resized to the number of links and filled with
+        /// their frame data. Its capacity is kept, so reusing the same vector
+        /// for each call avoids allocations.
+        /// \param[in] _fields FrameDataFields that should be filled in
+        public: void GetLinkFrameData(
+            std::vector<FrameData> &_data,
+            unsigned int _fields = FRAME_DATA_ALL) const
+        {
+          this->template Interface<GetLinkFrameDataFeature>()
+              ->GetModelLinkFrameData(this->identity, _data, _fields);
+        }
+      };
+
+      public: template <typename PolicyT>
+      class Implementation : public virtual Feature::Implementation<PolicyT>
+      {
+        public: using FrameData =
+            ignition::physics::FrameData<
+              typename PolicyT::Scalar, PolicyT::Dim>;
+
+        public: virtual void GetWorldLinkFrameData(
+            const Identity &_worldID,
+            std::vector<FrameData> &_data,
+            unsigned int _fields) const = 0;
+
+        public: virtual void GetModelLinkFrameData(
+            const Identity &_modelID,
+            std::vector<FrameData> &_data,
+            unsigned int _fields) const = 0;
+      };
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_MODELJOINTSTATE_HH_
+#define IGNITION_PHYSICS_MODELJOINTSTATE_HH_
+
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <ignition/physics/FeatureList.hh>
+
+namespace ignition
+{
+  namespace physics
+  {
+    /////////////////////////////////////////////////
+    /// \brief Identifies one entry of the joint state vectors of a model.
+    struct ModelDof
+    {
+      /// \brief Name of the joint that owns this generalized coordinate
+      std::string jointName;
+
+      /// \brief Index of this generalized coordinate within its joint. Values
+      /// start from 0 and stop before Joint::GetDegreesOfFreedom().
+      std::size_t jointDof;
+    };
+
+    /////////////////////////////////////////////////
+    /// \brief This feature retrieves the generalized positions, velocities
+    /// and forces of every joint of a model at once, as vectors with one
+    /// entry per generalized coordinate. This is much cheaper than querying
+    /// each joint of a model with GetBasicJointState.
+    ///
+    /// The order of the entries is given by GetDofTable(). It stays the same
+    /// until joints are attached to or detached from the model.
+    class IGNITION_PHYSICS_VISIBLE GetModelJointState : public virtual Feature
+    {
+      /// \brief The Model API for getting the joint state of a model
+      public: template <typename PolicyT, typename FeaturesT>
+      class Model : public virtual Feature::Model<PolicyT, FeaturesT>
+      {
+        public: using Scalar = typename PolicyT::Scalar;
+        public: using VectorX = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
+
+        /// \brief Get the number of generalized coordinates of this model,
+        /// which is the size of every joint state vector of this model.
+        public: std::size_t GetDofCount() const
+        {
+          return this->template Interface<GetModelJointState>()
+              ->GetModelDofCount(this->identity);
+        }
+
+        /// \brief Get the joint and joint DOF that each entry of the joint
+        /// state vectors of this model corresponds to.
+        /// \return One entry for each generalized coordinate of this model
+        public: std::vector<ModelDof> GetDofTable() const
+        {
+          return this->template Interface<GetModelJointState>()
+              ->GetModelDofTable(this->identity);
+        }
+
+        /// \brief Get the generalized positions of this model.
+        public: VectorX GetJointPositions() const
+        {
+          return this->template Interface<GetModelJointState>()
+              ->GetModelJointPositions(this->identity);
+        }
+
+        /// \brief Get the generalized velocities of this model.
+        public: VectorX GetJointVelocities() const
+        {
+          return this->template Interface<GetModelJointState>()
+              ->GetModelJointVelocities(this->identity);
+        }
+
+        /// \brief Get the generalized forces of this model.
+        public: VectorX GetJointForces() const
+        {
+          return this->template Interface<GetModelJointState>()
+              ->GetModelJointForces(this->identity);
+        }
+      };
+
+      /// \private The implementation API for getting the joint state of a
+      /// model
+      public: template <typename PolicyT>
+      class Implementation : public virtual Feature::Implementation<PolicyT>
+      {
+        public: using Scalar = typename PolicyT::Scalar;
+        public: using VectorX = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
+
+        // see Model::GetDofCount above
+        public: virtual std::size_t GetModelDofCount(
+            const Identity &_modelID) const = 0;
+
+        // see Model::GetDofTable above
+        public: virtual std::vector<ModelDof> GetModelDofTable(
+            const Identity &_modelID) const = 0;
+
+        // see Model::GetJointPositions above
+        public: virtual VectorX GetModelJointPositions(
+            const Identity &_modelID) const = 0;
+
+        // see Model::GetJointVelocities above
+        public: virtual VectorX GetModelJointVelocities(
+            const Identity &_modelID) const = 0;
+
+        // see Model::GetJointForces above
+        public: virtual VectorX GetModelJointForces(
+            const Identity &_modelID) const = 0;
+      };
+    };
+
+    /////////////////////////////////////////////////
+    /// \brief This feature sets the generalized positions, velocities, forces
+    /// or velocity commands of every joint of a model at once. The vectors are
+    /// ordered as described by GetModelJointState::Model::GetDofTable().
+    ///
+    /// Each vector is validated as a whole before it is applied. If it does
+    /// not have one entry per generalized coordinate of the model, or if any
+    /// of its entries is not finite, an error is printed and the model is left
+    /// unchanged.
+    class IGNITION_PHYSICS_VISIBLE SetModelJointState : public virtual Feature
+    {
+      /// \brief The Model API for setting the joint state of a model
+      public: template <typename PolicyT, typename FeaturesT>
+      class Model : public virtual Feature::Model<PolicyT, FeaturesT>
+      {
+        public: using Scalar = typename PolicyT::Scalar;
+        public: using VectorX = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
+
+        /// \brief Set the generalized positions of this model.
+        public: void SetJointPositions(const VectorX &_positions)
+        {
+          this->template Interface<SetModelJointState>()
+              ->SetModelJointPositions(this->identity, _positions);
+        }
+
+        /// \brief Set the generalized velocities of this model.
+        public: void SetJointVelocities(const VectorX &_velocities)
+        {
+          this->template Interface<SetModelJointState>()
+              ->SetModelJointVelocities(this->identity, _velocities);
+        }
+
+        /// \brief Set the generalized forces of this model. This has the same
+        /// effect as calling Joint::SetForce for every generalized coordinate
+        /// of the model, except for the joint that connects a free-floating
+        /// model to the world, whose entries are ignored.
+        public: void SetJointForces(const VectorX &_forces)
+        {
+          this->template Interface<SetModelJointState>()
+              ->SetModelJointForces(this->identity, _forces);
+        }
+
+        /// \brief Command the generalized velocities of this model. This has
+        /// the same effect as calling Joint::SetVelocityCommand for every
+        /// generalized coordinate of the model. The joint that connects a
+        /// free-floating model to the world is not commanded and its entries
+        /// are ignored, so that the base of the model stays free.
+        public: void SetJointVelocityCommands(const VectorX &_velocities)
+        {
+          this->template Interface<SetModelJointState>()
+              ->SetModelJointVelocityCommands(this->identity, _velocities);
+        }
+      };
+
+      /// \private The implementation API for setting the joint state of a
+      /// model
+      public: template <typename PolicyT>
+      class Implementation : public virtual Feature::Implementation<PolicyT>
+      {
+        public: using Scalar = typename PolicyT::Scalar;
+        public: using VectorX = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
+
+        // see Model::SetJointPositions above
+        public: virtual void SetModelJointPositions(
+            const Identity &_modelID, const VectorX &_positions) = 0;
+
+        // see Model::SetJointVelocities above
+        public: virtual void SetModelJointVelocities(
+            const Identity &_modelID, const VectorX &_velocities) = 0;
+
+        // see Model::SetJointForces above
+        public: virtual void SetModelJointForces(
+            const Identity &_modelID, const VectorX &_forces) = 0;
+
+        // see Model::SetJointVelocityCommands above
+        public: virtual void SetModelJointVelocityCommands(
+            const Identity &_modelID, const VectorX &_velocities) = 0;
+      };
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef IGNITION_PHYSICS_RESETWORLD_HH_
+#define IGNITION_PHYSICS_RESETWORLD_HH_
+
+#include <ignition/physics/FeatureList.hh>
+
+namespace ignition
+{
+  namespace physics
+  {
+    /////////////////////////////////////////////////
+    /// \brief ResetWorldFeature allows a world to be returned to a previously
+    /// captured state without being destroyed and constructed again. Entities
+    /// keep their identities across a reset, so any EntityPtr that was valid
+    /// before the reset remains valid afterwards.
+    class IGNITION_PHYSICS_VISIBLE ResetWorldFeature : public virtual Feature
+    {
+      public: template <typename PolicyT, typename FeaturesT>
+      class World : public virtual Feature::World<PolicyT, FeaturesT>
+      {
+        /// \brief Record the current state of every model in this world as
+        /// the state that Reset() will return to. Engines that implement this
+        /// feature capture the state automatically at the end of constructing
+        /// a world from SDF, so this only needs to be called to move the reset
+        /// point.
+        public: void CaptureResetState()
+        {
+          this->template Interface<ResetWorldFeature>()
+              ->CaptureWorldResetState(this->identity);
+        }
+
+        /// \brief Return every model of this world to the most recently
+        /// captured state and rewind the simulation time to zero. Models that
+        /// were added after the state was captured are left untouched.
+        public: void Reset()
+        {
+          this->template Interface<ResetWorldFeature>()
+              ->ResetWorld(this->identity);
+        }
+      };
+
+      public: template <typename PolicyT>
+      class Implementation : public virtual Feature::Implementation<PolicyT>
+      {
+        public: virtual void CaptureWorldResetState(
+            const Identity &_worldID) = 0;
+
+        public: virtual void ResetWorld(const Identity &_worldID) = 0;
+      };
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_WORLD_HH_
+#define IGNITION_PHYSICS_WORLD_HH_
+
+#include <string>
+
+#include <ignition/physics/FeatureList.hh>
+
+namespace ignition
+{
+  namespace physics
+  {
+    /////////////////////////////////////////////////
+    /// \brief This feature selects the collision detector that a world uses
+    /// to find contacts. Each engine supports its own set of detectors; the
+    /// dartsim plugin recognizes "fcl", "dart", "bullet" and "ode", where the
+    /// underlying library was built with them.
+    ///
+    /// The detector can be changed at any time. The collision filters that
+    /// were set on the world, such as collide bitmasks, are kept.
+    class IGNITION_PHYSICS_VISIBLE CollisionDetector : public virtual Feature
+    {
+      /// \brief The World API for selecting the collision detector
+      public: template <typename PolicyT, typename FeaturesT>
+      class World : public virtual Feature::World<PolicyT, FeaturesT>
+      {
+        /// \brief Set the collision detector of this world. If the engine
+        /// does not support the requested detector, an error is printed and
+        /// the current detector is kept.
+        /// \param[in] _collisionDetector Name of the collision detector
+        public: void SetCollisionDetector(
+            const std::string &_collisionDetector);
+
+        /// \brief Get the name of the collision detector of this world.
+        public: std::string GetCollisionDetector() const;
+      };
+
+      /// \private The implementation API for selecting the collision detector
+      public: template <typename PolicyT>
+      class Implementation : public virtual Feature::Implementation<PolicyT>
+      {
+        // see World::SetCollisionDetector above
+        public: virtual void SetWorldCollisionDetector(
+            const Identity &_worldID,
+            const std::string &_collisionDetector) = 0;
+
+        // see World::GetCollisionDetector above
+        public: virtual std::string GetWorldCollisionDetector(
+            const Identity &_worldID) const = 0;
+      };
+    };
+
+    /////////////////////////////////////////////////
+    /// \brief This feature selects the solver that a world uses for its
+    /// constraints, and caps its iterations, to trade accuracy for speed.
+    /// The dartsim plugin recognizes "dantzig", a pivoting solver that falls
+    /// back to projected Gauss-Seidel when it fails, and "pgs", which uses
+    /// projected Gauss-Seidel alone.
+    class IGNITION_PHYSICS_VISIBLE Solver : public virtual Feature
+    {
+      /// \brief The World API for selecting the constraint solver
+      public: template <typename PolicyT, typename FeaturesT>
+      class World : public virtual Feature::World<PolicyT, FeaturesT>
+      {
+        /// \brief Set the constraint solver of this world. If the engine
+        /// does not support the requested solver, an error is printed and
+        /// the current solver is kept.
+        /// \param[in] _solver Name of the solver
+        public: void SetSolver(const std::string &_solver);
+
+        /// \brief Get the name of the constraint solver of this world.
+        public: std::string GetSolver() const;
+
+        /// \brief Set the most iterations that the solver of this world may
+        /// run in one step. Fewer iterations make steps cheaper and contacts
+        /// less accurate. Only iterative solvers, such as "pgs", have a
+        /// limit. If the world uses any other solver, an error is printed
+        /// and nothing changes. The limit is kept when the solver changes.
+        /// \param[in] _iterations Iteration limit, which must be positive
+        public: void SetSolverIterations(std::size_t _iterations);
+
+        /// \brief Get the iteration limit of the solver of this world.
+        /// \return The limit, or 0 if the solver is not iterative.
+        public: std::size_t GetSolverIterations() const;
+      };
+
+      /// \private The implementation API for selecting the constraint solver
+      public: template <typename PolicyT>
+      class Implementation : public virtual Feature::Implementation<PolicyT>
+      {
+        // see World::SetSolver above
+        public: virtual void SetWorldSolver(
+            const Identity &_worldID, const std::string &_solver) = 0;
+
+        // see World::GetSolver above
+        public: virtual std::string GetWorldSolver(
+            const Identity &_worldID) const = 0;
+
+        // see World::SetSolverIterations above
+        public: virtual void SetWorldSolverIterations(
+            const Identity &_worldID, std::size_t _iterations) = 0;
+
+        // see World::GetSolverIterations above
+        public: virtual std::size_t GetWorldSolverIterations(
+            const Identity &_worldID) const = 0;
+      };
+    };
+  }
+}
+
+#include <ignition/physics/detail/World.hh>
+
+#endif
@@ -51,9 +51,11 @@ namespace ignition
         const Dimensions &_size,
         const PoseType &_pose) -> ShapePtrType
     {
-      return ShapePtrType(this->pimpl,
-            this->template Interface<AttachBoxShapeFeature>()
-                ->AttachBoxShape(this->identity, _name, _size, _pose));
+      auto *impl = this->template Interface<AttachBoxShapeFeature>();
+      const Identity shape =
+          impl->AttachBoxShape(this->identity, _name, _size, _pose);
+      this->ClearIdentitiesByName(*impl);
+      return ShapePtrType(this->pimpl, shape);
     }
   }
 }
@@ -18,7 +18,9 @@
 #ifndef IGNITION_PHYSICS_DETAIL_CLONEABLE_HH_
 #define IGNITION_PHYSICS_DETAIL_CLONEABLE_HH_
 
+#include <cstddef>
 #include <memory>
+#include <new>
 #include <utility>
 #include "ignition/physics/Cloneable.hh"
 
@@ -26,6 +28,18 @@ namespace ignition
 {
   namespace physics
   {
+    namespace detail
+    {
+      /////////////////////////////////////////////////
+      /// \brief Check whether an object of type T can be constructed in a
+      /// buffer of _size bytes that is aligned to alignof(std::max_align_t).
+      template <typename T>
+      constexpr bool FitsInBuffer(const std::size_t _size)
+      {
+        return sizeof(T) <= _size && alignof(T) <= alignof(std::max_align_t);
+      }
+    }
+
     /////////////////////////////////////////////////
     template <typename T>
     // cppcheck-suppress syntaxError
@@ -95,6 +109,28 @@ namespace ignition
       static_cast<T&>(*this) =
           std::move(static_cast<MakeCloneable<T>&&>(other));
     }
+
+    /////////////////////////////////////////////////
+    template <typename T>
+    Cloneable *MakeCloneable<T>::CloneInto(
+        void *_buffer, const std::size_t _size) const
+    {
+      if (!detail::FitsInBuffer<MakeCloneable<T>>(_size))
+        return nullptr;
+
+      return new (_buffer) MakeCloneable<T>(*this);
+    }
+
+    /////////////////////////////////////////////////
+    template <typename T>
+    Cloneable *MakeCloneable<T>::MoveInto(
+        void *_buffer, const std::size_t _size)
+    {
+      if (!detail::FitsInBuffer<MakeCloneable<T>>(_size))
+        return nullptr;
+
+      return new (_buffer) MakeCloneable<T>(std::move(*this));
+    }
   }
 }
 
@@ -18,64 +18,32 @@
 #ifndef IGNITION_PHYSICS_DETAIL_COMPOSITEDATA_HH_
 #define IGNITION_PHYSICS_DETAIL_COMPOSITEDATA_HH_
 
+#include <algorithm>
+#include <cassert>
 #include <memory>
+#include <new>
+#include <typeinfo>
 #include <utility>
 
-#include <ignition/utilities/SuppressWarning.hh>
-
 #include "ignition/physics/CompositeData.hh"
 
 namespace ignition
 {
   namespace physics
   {
-    /// \brief Struct which contains information about a data type within the
-    /// CompositeData.
-    /// \private
-    struct IGNITION_PHYSICS_VISIBLE CompositeData::DataEntry
-    {
-      /// \brief Default constructor
-      public: DataEntry();
-
-      /// \brief Constructor that accepts an rvalue reference and a
-      /// requirement setting
-      public: DataEntry(
-        std::unique_ptr<Cloneable> &&_data,
-        bool _required);
-
-      IGN_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
-      /// \brief Data that is being held at this entry. nullptr means the
-      /// CompositeData does not have data for this entry
-      public: std::unique_ptr<Cloneable> data;
-      IGN_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
-
-      /// \brief Flag for whether the type of data at this entry is considered
-      /// to be required. This can be made true during the lifetime of the
-      /// CompositeData, but it must never be changed from true to false.
-      public: bool required;
-
-      /// \brief Flag for whether this data entry has been queried since
-      /// either (1) it was created using Copy(~), =, or the CompositeData
-      /// constructor, or (2) the last time ResetQueries() was called,
-      /// whichever was more recent. Functions that can mark an entry as
-      /// queried include Get(), InsertOrAssign(), Insert(), Query(), and Has().
-      public: mutable bool queried;
-    };
-
     namespace detail
     {
       /////////////////////////////////////////////////
       /// \brief Helper function to set the query flag of previously unqueried
-      /// data entries. The template argument is to support both iterator&
-      /// and const_iterator& argument types. This helper functions lets us
-      /// avoid hard-to-spot typos on this frequently performed task.
-      template <typename IteratorType>
-      void SetToQueried(const IteratorType &_it, std::size_t &_numQueries)
+      /// data entries. This helper functions lets us avoid hard-to-spot typos
+      /// on this frequently performed task.
+      inline void SetToQueried(
+          const CompositeData::DataEntry &_entry, std::size_t &_numQueries)
       {
-        if (!_it->second.queried)
+        if (!_entry.queried)
         {
           ++_numQueries;
-          _it->second.queried = true;
+          _entry.queried = true;
         }
       }
 
@@ -87,51 +55,119 @@ namespace ignition
           const bool _assign,
           std::size_t &_numEntries,
           std::size_t &_numQueries,
-          CompositeData::MapOfData &_dataMap,
+          CompositeData::DataEntry &_entry,
           Args &&..._args)
       {
         bool inserted = false;
-        const CompositeData::MapOfData::iterator it = _dataMap.insert(
-              std::make_pair(typeid(Data).name(),
-                             CompositeData::DataEntry())).first;
 
-        if (!it->second.data)
+        if (!_entry.data)
         {
           ++_numEntries;
-          it->second.data = std::unique_ptr<Cloneable>(
-                new MakeCloneable<Data>(std::forward<Args>(_args)...));
+          _entry.Emplace<Data>(std::forward<Args>(_args)...);
           inserted = true;
         }
         else if (_assign)
         {
-          static_cast<MakeCloneable<Data>&>(*it->second.data) =
+          static_cast<MakeCloneable<Data>&>(*_entry.data) =
               MakeCloneable<Data>(std::forward<Args>(_args)...);
         }
 
-        detail::SetToQueried(it, _numQueries);
+        detail::SetToQueried(_entry, _numQueries);
 
         return CompositeData::InsertResult<Data>{
-          static_cast<MakeCloneable<Data>&>(*it->second.data),
+          static_cast<MakeCloneable<Data>&>(*_entry.data),
           inserted};
       }
+
+      /////////////////////////////////////////////////
+      /// \brief Compare a map element to a TypeId, for binary searches
+      inline bool EntryIdLess(
+          const CompositeData::MapOfData::value_type &_element,
+          const CompositeData::TypeId _id)
+      {
+        return _element.first < _id;
+      }
+    }
+
+    /////////////////////////////////////////////////
+    template <typename Data, typename... Args>
+    MakeCloneable<Data> &CompositeData::DataEntry::Emplace(Args &&..._args)
+    {
+      assert(!this->data &&
+             "Calling Emplace on a data entry that already has data. This "
+             "should not be possible! Please report this bug!");
+
+      MakeCloneable<Data> *created = nullptr;
+      if constexpr (detail::FitsInBuffer<MakeCloneable<Data>>(InlineDataSize))
+      {
+        created = new (this->buffer) MakeCloneable<Data>(
+              std::forward<Args>(_args)...);
+        this->data = DataPtr(created, CloneableDeleter{true});
+      }
+      else
+      {
+        created = new MakeCloneable<Data>(std::forward<Args>(_args)...);
+        this->data = DataPtr(created, CloneableDeleter{false});
+      }
+
+      return *created;
+    }
+
+    /////////////////////////////////////////////////
+    template <typename Data>
+    CompositeData::TypeId CompositeData::TypeIdOf()
+    {
+      // The registry is only visited once per type and shared library
+      static const TypeId id = RegisterDataType(typeid(Data).name());
+      return id;
+    }
+
+    /////////////////////////////////////////////////
+    inline CompositeData::DataEntry *CompositeData::FindEntry(
+        const TypeId _id) const
+    {
+      const MapOfData::const_iterator it = std::lower_bound(
+            this->dataMap.begin(), this->dataMap.end(), _id,
+            &detail::EntryIdLess);
+
+      if (this->dataMap.end() == it || it->first != _id)
+        return nullptr;
+
+      return it->second;
+    }
+
+    /////////////////////////////////////////////////
+    inline CompositeData::DataEntry &CompositeData::FindOrCreateEntry(
+        const TypeId _id)
+    {
+      const MapOfData::iterator it = std::lower_bound(
+            this->dataMap.begin(), this->dataMap.end(), _id,
+            &detail::EntryIdLess);
+
+      if (this->dataMap.end() != it && it->first == _id)
+        return *it->second;
+
+      this->dataEntries.emplace_back();
+      DataEntry &entry = this->dataEntries.back();
+      this->dataMap.emplace(it, _id, &entry);
+      return entry;
     }
 
     /////////////////////////////////////////////////
     template <typename Data>
     Data &CompositeData::Get()
     {
-      const MapOfData::iterator it = this->dataMap.insert(
-            std::make_pair(typeid(Data).name(), DataEntry())).first;
+      DataEntry &entry = this->FindOrCreateEntry(TypeIdOf<Data>());
 
-      if (!it->second.data)
+      if (!entry.data)
       {
         ++this->numEntries;
-        it->second.data = std::unique_ptr<Cloneable>(new MakeCloneable<Data>());
+        entry.Emplace<Data>();
       }
 
-      detail::SetToQueried(it, this->numQueries);
+      detail::SetToQueried(entry, this->numQueries);
 
-      return static_cast<MakeCloneable<Data>&>(*it->second.data);
+      return static_cast<MakeCloneable<Data>&>(*entry.data);
     }
 
     /////////////////////////////////////////////////
@@ -139,7 +175,8 @@ namespace ignition
     auto CompositeData::Insert(Args &&..._args) -> InsertResult<Data>
     {
       return detail::InsertHelper<Data>(
-            false, this->numEntries, this->numQueries, this->dataMap,
+            false, this->numEntries, this->numQueries,
+            this->FindOrCreateEntry(TypeIdOf<Data>()),
             std::forward<Args>(_args)...);
     }
 
@@ -148,7 +185,8 @@ namespace ignition
     auto CompositeData::InsertOrAssign(Args &&..._args) -> InsertResult<Data>
     {
       return detail::InsertHelper<Data>(
-            true, this->numEntries, this->numQueries, this->dataMap,
+            true, this->numEntries, this->numQueries,
+            this->FindOrCreateEntry(TypeIdOf<Data>()),
             std::forward<Args>(_args)...);
     }
 
@@ -156,25 +194,24 @@ namespace ignition
     template <typename Data>
     bool CompositeData::Remove()
     {
-      const MapOfData::iterator it =
-          this->dataMap.find(typeid(Data).name());
+      DataEntry * const entry = this->FindEntry(TypeIdOf<Data>());
 
-      if (this->dataMap.end() == it || !it->second.data)
+      if (!entry || !entry->data)
         return true;
 
       // Do not remove it if it's required
-      if (it->second.required)
+      if (entry->required)
         return false;
 
       // Decrement the query count if it had been queried
-      if (it->second.queried)
+      if (entry->queried)
       {
         --this->numQueries;
-        it->second.queried = false;
+        entry->queried = false;
       }
 
       --this->numEntries;
-      it->second.data.reset();
+      entry->data.reset();
       return true;
     }
 
@@ -182,38 +219,30 @@ namespace ignition
     template <typename Data>
     Data *CompositeData::Query(const QueryMode _mode)
     {
-      const MapOfData::const_iterator it =
-          this->dataMap.find(typeid(Data).name());
+      const DataEntry * const entry = this->FindEntry(TypeIdOf<Data>());
 
-      if (this->dataMap.end() == it)
-        return nullptr;
-
-      if (!it->second.data)
+      if (!entry || !entry->data)
         return nullptr;
 
       if (QueryMode::NORMAL == _mode)
-        detail::SetToQueried(it, this->numQueries);
+        detail::SetToQueried(*entry, this->numQueries);
 
-      return static_cast<MakeCloneable<Data>*>(it->second.data.get());
+      return static_cast<MakeCloneable<Data>*>(entry->data.get());
     }
 
     /////////////////////////////////////////////////
     template <typename Data>
     const Data *CompositeData::Query(const QueryMode _mode) const
     {
-      const MapOfData::const_iterator it =
-          this->dataMap.find(typeid(Data).name());
+      const DataEntry * const entry = this->FindEntry(TypeIdOf<Data>());
 
-      if (this->dataMap.end() == it)
-        return nullptr;
-
-      if (!it->second.data)
+      if (!entry || !entry->data)
         return nullptr;
 
       if (QueryMode::NORMAL == _mode)
-        detail::SetToQueried(it, this->numQueries);
+        detail::SetToQueried(*entry, this->numQueries);
 
-      return static_cast<const MakeCloneable<Data>*>(it->second.data.get());
+      return static_cast<const MakeCloneable<Data>*>(entry->data.get());
     }
 
     /////////////////////////////////////////////////
@@ -230,18 +259,14 @@ namespace ignition
       // status is initialized to everything being false
       DataStatus status;
 
-      const MapOfData::const_iterator it =
-          this->dataMap.find(typeid(Data).name());
-
-      if (this->dataMap.end() == it)
-        return status;
+      const DataEntry * const entry = this->FindEntry(TypeIdOf<Data>());
 
-      if (!it->second.data)
+      if (!entry || !entry->data)
         return status;
 
       status.exists = true;
-      status.required = it->second.required;
-      status.queried = it->second.queried;
+      status.required = entry->required;
+      status.queried = entry->queried;
 
       return status;
     }
@@ -250,20 +275,16 @@ namespace ignition
     template <typename Data>
     bool CompositeData::Unquery() const
     {
-      const MapOfData::const_iterator it =
-          this->dataMap.find(typeid(Data).name());
-
-      if (this->dataMap.end() == it)
-        return false;
+      const DataEntry * const entry = this->FindEntry(TypeIdOf<Data>());
 
-      if (!it->second.data)
+      if (!entry || !entry->data)
         return false;
 
-      if (!it->second.queried)
+      if (!entry->queried)
         return false;
 
       --this->numQueries;
-      it->second.queried = false;
+      entry->queried = false;
 
       return true;
     }
@@ -272,33 +293,30 @@ namespace ignition
     template <typename Data, typename... Args>
     Data &CompositeData::MakeRequired(Args &&..._args)
     {
-      const MapOfData::iterator it = this->dataMap.insert(
-            std::make_pair(typeid(Data).name(), DataEntry())).first;
+      DataEntry &entry = this->FindOrCreateEntry(TypeIdOf<Data>());
 
-      it->second.required = true;
-      if (!it->second.data)
+      entry.required = true;
+      if (!entry.data)
       {
         ++this->numEntries;
-        it->second.data = std::unique_ptr<Cloneable>(
-              new MakeCloneable<Data>(std::forward<Args>(_args)...));
+        entry.Emplace<Data>(std::forward<Args>(_args)...);
       }
 
-      detail::SetToQueried(it, this->numQueries);
+      detail::SetToQueried(entry, this->numQueries);
 
-      return static_cast<MakeCloneable<Data>&>(*it->second.data);
+      return static_cast<MakeCloneable<Data>&>(*entry.data);
     }
 
     /////////////////////////////////////////////////
     template <typename Data>
     bool CompositeData::Requires() const
     {
-      const MapOfData::const_iterator it =
-          this->dataMap.find(typeid(Data).name());
+      const DataEntry * const entry = this->FindEntry(TypeIdOf<Data>());
 
-      if (this->dataMap.end() == it)
+      if (!entry)
         return false;
 
-      return it->second.required;
+      return entry->required;
     }
 
     /////////////////////////////////////////////////
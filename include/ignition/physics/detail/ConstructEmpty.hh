@@ -30,9 +30,10 @@ template <typename PolicyT, typename FeaturesT>
 auto ConstructEmptyWorldFeature::Engine<PolicyT, FeaturesT>
 ::ConstructEmptyWorld(const std::string &_name) -> WorldPtrType
 {
-  return WorldPtrType(this->pimpl,
-        this->template Interface<ConstructEmptyWorldFeature>()
-                      ->ConstructEmptyWorld(this->identity, _name));
+  auto *impl = this->template Interface<ConstructEmptyWorldFeature>();
+  const Identity world = impl->ConstructEmptyWorld(this->identity, _name);
+  this->ClearIdentitiesByName(*impl);
+  return WorldPtrType(this->pimpl, world);
 }
 
 /////////////////////////////////////////////////
@@ -40,9 +41,10 @@ template <typename PolicyT, typename FeaturesT>
 auto ConstructEmptyModelFeature::World<PolicyT, FeaturesT>
 ::ConstructEmptyModel(const std::string &_name) -> ModelPtrType
 {
-  return ModelPtrType(this->pimpl,
-        this->template Interface<ConstructEmptyModelFeature>()
-                      ->ConstructEmptyModel(this->identity, _name));
+  auto *impl = this->template Interface<ConstructEmptyModelFeature>();
+  const Identity model = impl->ConstructEmptyModel(this->identity, _name);
+  this->ClearIdentitiesByName(*impl);
+  return ModelPtrType(this->pimpl, model);
 }
 
 /////////////////////////////////////////////////
@@ -50,9 +52,10 @@ template <typename PolicyT, typename FeaturesT>
 auto ConstructEmptyLinkFeature::Model<PolicyT, FeaturesT>
 ::ConstructEmptyLink(const std::string &_name) -> LinkPtrType
 {
-  return LinkPtrType(this->pimpl,
-        this->template Interface<ConstructEmptyLinkFeature>()
-                     ->ConstructEmptyLink(this->identity, _name));
+  auto *impl = this->template Interface<ConstructEmptyLinkFeature>();
+  const Identity link = impl->ConstructEmptyLink(this->identity, _name);
+  this->ClearIdentitiesByName(*impl);
+  return LinkPtrType(this->pimpl, link);
 }
 
 }
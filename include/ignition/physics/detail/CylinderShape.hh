@@ -71,10 +71,11 @@ namespace ignition
         Scalar _height,
         const PoseType &_pose) -> ShapePtrType
     {
-      return ShapePtrType(this->pimpl,
-            this->template Interface<AttachCylinderShapeFeature>()
-                ->AttachCylinderShape(
-                            this->identity, _name, _radius, _height, _pose));
+      auto *impl = this->template Interface<AttachCylinderShapeFeature>();
+      const Identity shape = impl->AttachCylinderShape(
+          this->identity, _name, _radius, _height, _pose);
+      this->ClearIdentitiesByName(*impl);
+      return ShapePtrType(this->pimpl, shape);
     }
   }
 }
@@ -19,6 +19,8 @@
 #define IGNITION_PHYSICS_DETAIL_ENTITY_HH_
 
 #include <memory>
+#include <optional>
+#include <string>
 #include <tuple>
 #include <utility>
 
@@ -257,8 +259,10 @@ namespace ignition
       {
         // Emplace to set the identity because assigment is not possible. Use
         // the entity's own pimpl temporarily for the construction and copy
-        // assign the pimpl afterward
-        this->entity.emplace(this->entity->pimpl, _other.entity->identity);
+        // assign the pimpl afterward. The pimpl is held here because emplace
+        // destroys the current entity before constructing the new one.
+        std::shared_ptr<typename EntityT::Pimpl> pimpl = this->entity->pimpl;
+        this->entity.emplace(std::move(pimpl), _other.entity->identity);
         // Avoid reallocating the pimpl
         *this->entity->pimpl = *_other.entity->pimpl;
       }
@@ -362,8 +366,7 @@ namespace ignition
     typename FeatureT::template Implementation<Policy>*
     Entity<Policy, Features>::Interface()
     {
-      return (*this->pimpl)->template QueryInterface<
-          typename FeatureT::template Implementation<Policy>>();
+      return this->pimpl->template FeatureInterface<FeatureT>();
     }
 
     /////////////////////////////////////////////////
@@ -372,8 +375,38 @@ namespace ignition
     const typename FeatureT::template Implementation<Policy>*
     Entity<Policy, Features>::Interface() const
     {
-      return (*this->pimpl)->template QueryInterface<
-          typename FeatureT::template Implementation<Policy>>();
+      return this->pimpl->template FeatureInterface<FeatureT>();
+    }
+
+    /////////////////////////////////////////////////
+    template <typename Policy, typename Features>
+    template <typename LookupT>
+    Identity Entity<Policy, Features>::IdentityByName(
+        const detail::Implementation &_impl,
+        const detail::EntityHandleCache::Kind _kind,
+        const std::string &_name,
+        const LookupT &_lookup) const
+    {
+      detail::EntityHandleCache &cache = *_impl.entityHandles;
+      if (std::optional<Identity> cached =
+            cache.Find(_kind, this->identity.id, _name))
+      {
+        return *cached;
+      }
+
+      const Identity found = _lookup();
+      if (found)
+        cache.Insert(_kind, this->identity.id, _name, found);
+
+      return found;
+    }
+
+    /////////////////////////////////////////////////
+    template <typename Policy, typename Features>
+    void Entity<Policy, Features>::ClearIdentitiesByName(
+        const detail::Implementation &_impl)
+    {
+      _impl.entityHandles->Clear();
     }
 
     /////////////////////////////////////////////////
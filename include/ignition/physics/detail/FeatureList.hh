@@ -18,6 +18,8 @@
 #ifndef IGNITION_PHYSICS_DETAIL_FEATURELIST_HH_
 #define IGNITION_PHYSICS_DETAIL_FEATURELIST_HH_
 
+#include <array>
+#include <cstddef>
 #include <memory>
 #include <set>
 #include <string>
@@ -117,6 +119,38 @@ namespace ignition
         struct type { };
       };
 
+      /////////////////////////////////////////////////
+      /// \private Find the position of type T within a std::tuple. If T is not
+      /// in the tuple, the value is the size of the tuple.
+      template <typename T, typename Tuple>
+      struct TupleIndex;
+
+      template <typename T>
+      struct TupleIndex<T, std::tuple<>>
+          : std::integral_constant<std::size_t, 0> { };
+
+      template <typename T, typename... Others>
+      struct TupleIndex<T, std::tuple<T, Others...>>
+          : std::integral_constant<std::size_t, 0> { };
+
+      template <typename T, typename U, typename... Others>
+      struct TupleIndex<T, std::tuple<U, Others...>>
+          : std::integral_constant<std::size_t,
+              1 + TupleIndex<T, std::tuple<Others...>>::value> { };
+
+      /////////////////////////////////////////////////
+      /// \private Get a std::tuple of the implementation interfaces of a
+      /// std::tuple of features.
+      template <typename Policy, typename FeatureTuple>
+      struct ImplementationsOf;
+
+      template <typename Policy, typename... Features>
+      struct ImplementationsOf<Policy, std::tuple<Features...>>
+      {
+        using type =
+            std::tuple<typename Features::template Implementation<Policy>...>;
+      };
+
       /////////////////////////////////////////////////
       /// \private This class is used to determine what type of
       /// SpecializedPluginPtr should be used by the entities provided by a
@@ -128,7 +162,122 @@ namespace ignition
             : ::ignition::plugin::detail::SelectSpecializers<
               typename ComposePlugin<Policy, FeaturesT>::type> { };
 
-        using type = ::ignition::plugin::TemplatePluginPtr<Specializer>;
+        using PluginPtr = ::ignition::plugin::TemplatePluginPtr<Specializer>;
+
+        /// \private The plugin handle that is shared by the entities of a
+        /// FeatureList. The implementation of every feature in the list is
+        /// looked up once, whenever the handle is given a plugin, so that
+        /// entities can reach it with one indirection instead of querying the
+        /// plugin on every call.
+        class type : public PluginPtr
+        {
+          /// \brief All the features of FeaturesT, including the features
+          /// that they require, without repetitions.
+          public: using Features = typename CombineLists<FeaturesT>::Result;
+
+          /// \brief The implementation interface of each feature in Features.
+          /// Features that inherit their implementation, e.g. the different
+          /// kinds of frame semantics, share the same interface.
+          public: using Interfaces =
+              typename ImplementationsOf<Policy, Features>::type;
+
+          public: type() = default;
+
+          public: type(const type &_other) = default;
+
+          public: type(type &&_other)
+            : PluginPtr(std::move(_other)),
+              interfaces(_other.interfaces)
+          {
+            _other.interfaces.fill(nullptr);
+          }
+
+          /// \brief Take the plugin of any other plugin handle, e.g. the
+          /// handle of an entity with a different FeatureList.
+          public: template <typename OtherPluginT>
+          type(
+              const ::ignition::plugin::TemplatePluginPtr<OtherPluginT> &_other)
+            : PluginPtr(_other)
+          {
+            this->ResolveInterfaces();
+          }
+
+          public: type &operator=(const type &_other) = default;
+
+          public: type &operator=(type &&_other)
+          {
+            PluginPtr::operator=(std::move(_other));
+            this->interfaces = _other.interfaces;
+            _other.interfaces.fill(nullptr);
+            return *this;
+          }
+
+          public: template <typename OtherPluginT>
+          type &operator=(
+              const ::ignition::plugin::TemplatePluginPtr<OtherPluginT> &_other)
+          {
+            PluginPtr::operator=(_other);
+            this->ResolveInterfaces();
+            return *this;
+          }
+
+          public: type &operator=(std::nullptr_t)
+          {
+            this->Clear();
+            return *this;
+          }
+
+          public: void Clear()
+          {
+            PluginPtr::Clear();
+            this->interfaces.fill(nullptr);
+          }
+
+          /// \brief Get the implementation of feature F. If its interface is
+          /// one of Interfaces, it is read from the table that was filled in
+          /// when this handle was given its plugin. Otherwise it is queried
+          /// from the plugin.
+          /// \return The implementation of F, or a nullptr if the plugin does
+          /// not provide it.
+          public: template <typename F>
+          typename F::template Implementation<Policy> *FeatureInterface() const
+          {
+            using Interface = typename F::template Implementation<Policy>;
+            constexpr std::size_t index =
+                TupleIndex<Interface, Interfaces>::value;
+            if constexpr (index < std::tuple_size_v<Interfaces>)
+              return static_cast<Interface*>(this->interfaces[index]);
+            else
+              return (*this)->template QueryInterface<Interface>();
+          }
+
+          /// \brief Look up the implementation of each entry of Interfaces
+          private: void ResolveInterfaces()
+          {
+            this->ResolveInterfaces(std::make_index_sequence<
+                std::tuple_size_v<Interfaces>>());
+          }
+
+          private: template <std::size_t... I>
+          void ResolveInterfaces(std::index_sequence<I...>)
+          {
+            if (this->IsEmpty())
+            {
+              this->interfaces.fill(nullptr);
+              return;
+            }
+
+            this->interfaces = {{
+              static_cast<void*>((*this)->template QueryInterface<
+                std::tuple_element_t<I, Interfaces>>())...
+            }};
+          }
+
+          /// \brief The plugin's implementation of each entry of Interfaces,
+          /// in the same order
+          private: std::array<void*, std::tuple_size_v<Interfaces>>
+              interfaces = {};
+        };
       };
 
       /////////////////////////////////////////////////
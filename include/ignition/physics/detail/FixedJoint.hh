@@ -32,9 +32,11 @@ namespace ignition
         const BaseLinkPtr<PolicyT> &_parent,
         const std::string &_name) -> JointPtrType
     {
-      return JointPtrType(this->pimpl,
-            this->template Interface<AttachFixedJointFeature>()
-                ->AttachFixedJoint(this->identity, _parent, _name));
+      auto *impl = this->template Interface<AttachFixedJointFeature>();
+      const Identity joint =
+          impl->AttachFixedJoint(this->identity, _parent, _name);
+      this->ClearIdentitiesByName(*impl);
+      return JointPtrType(this->pimpl, joint);
     }
   }
 }
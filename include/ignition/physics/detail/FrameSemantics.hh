@@ -18,6 +18,7 @@
 #ifndef IGNITION_PHYSICS_DETAIL_FRAMESEMANTICS_HH_
 #define IGNITION_PHYSICS_DETAIL_FRAMESEMANTICS_HH_
 
+#include <cstddef>
 #include <memory>
 
 #include <ignition/physics/FrameSemantics.hh>
@@ -28,24 +29,129 @@ namespace ignition
   {
     namespace detail
     {
-      template <typename PolicyT, typename RQ>
-      static typename RQ::Quantity Resolve(
+      /////////////////////////////////////////////////
+      /// \brief The FrameDataFields that Resolve needs from the frames that a
+      /// quantity of Space is resolved against. Positions, orientations and
+      /// free vectors only depend on the poses of their frames, while
+      /// RelativeFrameData needs every field.
+      template <typename Space>
+      struct RequiredFrameDataFields
+      {
+        static constexpr unsigned int value = FRAME_DATA_ALL;
+      };
+
+      template <typename _Scalar, std::size_t _Dim>
+      struct RequiredFrameDataFields<SESpace<_Scalar, _Dim>>
+      {
+        static constexpr unsigned int value = FRAME_DATA_POSE;
+      };
+
+      template <typename _Scalar, std::size_t _Dim, typename _Quantity>
+      struct RequiredFrameDataFields<SOSpace<_Scalar, _Dim, _Quantity>>
+      {
+        static constexpr unsigned int value = FRAME_DATA_POSE;
+      };
+
+      template <typename _Scalar, std::size_t _Dim>
+      struct RequiredFrameDataFields<EuclideanSpace<_Scalar, _Dim>>
+      {
+        static constexpr unsigned int value = FRAME_DATA_POSE;
+      };
+
+      template <typename _Scalar, std::size_t _Dim>
+      struct RequiredFrameDataFields<VectorSpace<_Scalar, _Dim>>
+      {
+        static constexpr unsigned int value = FRAME_DATA_POSE;
+      };
+
+      template <typename _Scalar, std::size_t _Dim>
+      struct RequiredFrameDataFields<AABBSpace<_Scalar, _Dim>>
+      {
+        static constexpr unsigned int value = FRAME_DATA_POSE;
+      };
+
+      /////////////////////////////////////////////////
+      /// \brief The frame data that Resolve needs to express quantities of a
+      /// coordinate space, which all have the same parent frame, in terms of a
+      /// relativeTo frame and an inCoordinatesOf frame. It is retrieved from
+      /// the engine once by PrepareResolve, and can then be applied to any
+      /// number of quantities.
+      template <typename Space>
+      struct ResolveFrames
+      {
+        using Quantity = typename Space::Quantity;
+        using FrameDataType = typename Space::FrameDataType;
+        using RotationType = typename Space::RotationType;
+
+        enum class Change { None, ToWorld, ToTarget };
+
+        /// \brief How the quantity is moved to the relativeTo frame
+        Change frameChange = Change::None;
+
+        /// \brief How the coordinates of the quantity are changed to those of
+        /// the inCoordinatesOf frame
+        Change coordinateChange = Change::None;
+
+        FrameDataType parentFrameData;
+        FrameDataType relativeToData;
+        RotationType currentCoordinates;
+        RotationType inCoordinatesOfRotation;
+
+        /// \brief Resolve one value that is expressed in the parent frame.
+        Quantity Apply(const Quantity &_value) const
+        {
+          if (this->frameChange == Change::None
+              && this->coordinateChange == Change::None)
+          {
+            return _value;
+          }
+
+          const Quantity q =
+              this->frameChange == Change::ToWorld ?
+                Space::ResolveToWorldFrame(_value, this->parentFrameData)
+              : this->frameChange == Change::ToTarget ?
+                Space::ResolveToTargetFrame(
+                  _value, this->parentFrameData, this->relativeToData)
+              : _value;
+
+          if (this->coordinateChange == Change::ToWorld)
+          {
+            // Resolving quantities to the world coordinates requires fewer
+            // operations than resolving to an arbitrary frame.
+            return Space::ResolveToWorldCoordinates(
+                  q, this->currentCoordinates);
+          }
+
+          if (this->coordinateChange == Change::ToTarget)
+          {
+            return Space::ResolveToTargetCoordinates(
+                  q, this->currentCoordinates, this->inCoordinatesOfRotation);
+          }
+
+          return q;
+        }
+      };
+
+      /////////////////////////////////////////////////
+      template <typename PolicyT, typename Space>
+      static ResolveFrames<Space> PrepareResolve(
           const FrameSemantics::Implementation<PolicyT> &_impl,
-          const RQ &_quantity,
+          const FrameID &_parentFrameID,
           const FrameID &_relativeTo,
           const FrameID &_inCoordinatesOf)
       {
-        using Quantity = typename RQ::Quantity;
-        using Space = typename RQ::Space;
         using FrameDataType = typename Space::FrameDataType;
         using RotationType = typename Space::RotationType;
+        using Change = typename ResolveFrames<Space>::Change;
 
-        const FrameID &parentFrameID = _quantity.ParentFrame();
+        ResolveFrames<Space> frames;
 
-        Quantity q;
-        RotationType currentCoordinates;
+        // Changing coordinates only needs the orientation of a frame, and the
+        // frame itself only needs the fields that its space depends on.
+        constexpr unsigned int spaceFields =
+            RequiredFrameDataFields<Space>::value;
 
-        if (parentFrameID == _relativeTo)
+        if (_parentFrameID == _relativeTo)
         {
           // The quantity is already expressed relative to the _relativeTo frame
 
@@ -53,43 +159,37 @@ namespace ignition
           {
             // The quantity is already expressed in coordinates of the
             // _inCoordinatesOf frame
-            return _quantity.RelativeToParent();
+            return frames;
           }
 
-          q = _quantity.RelativeToParent();
-          currentCoordinates = _impl.FrameDataRelativeToWorld(
-                _relativeTo).pose.linear();
+          frames.currentCoordinates = _impl.SelectedFrameDataRelativeToWorld(
+                _relativeTo, FRAME_DATA_POSE).pose.linear();
         }
         else
         {
           // We should only ask for the FrameData if the parent frame is not the
           // world frame.
-          const FrameDataType parentFrameData = parentFrameID.IsWorld() ?
-                FrameDataType() : _impl.FrameDataRelativeToWorld(parentFrameID);
+          frames.parentFrameData = _parentFrameID.IsWorld() ?
+                FrameDataType()
+              : _impl.SelectedFrameDataRelativeToWorld(
+                  _parentFrameID, spaceFields);
 
           if (_relativeTo.IsWorld())
           {
             // Resolving quantities to the world frame requires fewer operations
             // than resolving to an arbitrary frame, so we use a special
             // function for that.
-            q = Space::ResolveToWorldFrame(
-                  _quantity.RelativeToParent(),
-                  parentFrameData);
+            frames.frameChange = Change::ToWorld;
 
             // The World Frame has all zero fields
-            currentCoordinates = RotationType::Identity();
+            frames.currentCoordinates = RotationType::Identity();
           }
           else
           {
-            const FrameDataType relativeToData =
-                _impl.FrameDataRelativeToWorld(_relativeTo);
-
-            q = Space::ResolveToTargetFrame(
-                  _quantity.RelativeToParent(),
-                  parentFrameData,
-                  relativeToData);
-
-            currentCoordinates = relativeToData.pose.linear();
+            frames.frameChange = Change::ToTarget;
+            frames.relativeToData = _impl.SelectedFrameDataRelativeToWorld(
+                  _relativeTo, spaceFields);
+            frames.currentCoordinates = frames.relativeToData.pose.linear();
           }
         }
 
@@ -97,21 +197,61 @@ namespace ignition
         {
           if (_inCoordinatesOf.IsWorld())
           {
-            // Resolving quantities to the world coordinates requires fewer
-            // operations than resolving to an arbitrary frame.
-            return Space::ResolveToWorldCoordinates(q, currentCoordinates);
+            frames.coordinateChange = Change::ToWorld;
           }
           else
           {
-            const RotationType inCoordinatesOfRotation =
-                _impl.FrameDataRelativeToWorld(_inCoordinatesOf).pose.linear();
-
-            return Space::ResolveToTargetCoordinates(
-                  q, currentCoordinates, inCoordinatesOfRotation);
+            frames.coordinateChange = Change::ToTarget;
+            frames.inCoordinatesOfRotation =
+                _impl.SelectedFrameDataRelativeToWorld(
+                  _inCoordinatesOf, FRAME_DATA_POSE).pose.linear();
           }
         }
 
-        return q;
+        return frames;
+      }
+
+      /////////////////////////////////////////////////
+      template <typename PolicyT, typename RQ>
+      static typename RQ::Quantity Resolve(
+          const FrameSemantics::Implementation<PolicyT> &_impl,
+          const RQ &_quantity,
+          const FrameID &_relativeTo,
+          const FrameID &_inCoordinatesOf)
+      {
+        return PrepareResolve<PolicyT, typename RQ::Space>(
+              _impl, _quantity.ParentFrame(), _relativeTo, _inCoordinatesOf)
+            .Apply(_quantity.RelativeToParent());
+      }
+
+      /////////////////////////////////////////////////
+      /// \brief Resolve an array of quantities, and pass the index and the
+      /// result of each one to _store. The frame data is retrieved once for
+      /// each run of consecutive quantities that have the same parent frame.
+      template <typename PolicyT, typename RQ, typename StoreT>
+      static void ResolveArray(
+          const FrameSemantics::Implementation<PolicyT> &_impl,
+          const RQ *_quantities,
+          const std::size_t _count,
+          const FrameID &_relativeTo,
+          const FrameID &_inCoordinatesOf,
+          const StoreT &_store)
+      {
+        std::size_t i = 0;
+        while (i < _count)
+        {
+          // Copy the parent frame, since _store may overwrite the quantity
+          const FrameID parentFrameID = _quantities[i].ParentFrame();
+          const ResolveFrames<typename RQ::Space> frames =
+              PrepareResolve<PolicyT, typename RQ::Space>(
+                _impl, parentFrameID, _relativeTo, _inCoordinatesOf);
+
+          for (; i < _count && _quantities[i].ParentFrame() == parentFrameID;
+               ++i)
+          {
+            _store(i, frames.Apply(_quantities[i].RelativeToParent()));
+          }
+        }
       }
     }
 
@@ -147,6 +287,57 @@ namespace ignition
                 this->Resolve(_quantity, _withRespectTo, _withRespectTo));
     }
 
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    template <typename RQ>
+    void FrameSemantics::Engine<PolicyT, FeaturesT>::Resolve(
+        const RQ *_quantities,
+        const std::size_t _count,
+        typename RQ::Quantity *_resolved,
+        const FrameID &_relativeTo,
+        const FrameID &_inCoordinatesOf) const
+    {
+      detail::ResolveArray<PolicyT>(
+            *this->template Interface<FrameSemantics>(),
+            _quantities, _count, _relativeTo, _inCoordinatesOf,
+            [_resolved](const std::size_t _i,
+                        const typename RQ::Quantity &_value)
+            {
+              _resolved[_i] = _value;
+            });
+    }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    template <typename RQ>
+    void FrameSemantics::Engine<PolicyT, FeaturesT>::Resolve(
+        const RQ *_quantities,
+        const std::size_t _count,
+        typename RQ::Quantity *_resolved,
+        const FrameID &_relativeTo) const
+    {
+      this->Resolve(_quantities, _count, _resolved, _relativeTo, _relativeTo);
+    }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    template <typename RQ>
+    void FrameSemantics::Engine<PolicyT, FeaturesT>::Reframe(
+        const RQ *_quantities,
+        const std::size_t _count,
+        RQ *_reframed,
+        const FrameID &_withRespectTo) const
+    {
+      detail::ResolveArray<PolicyT>(
+            *this->template Interface<FrameSemantics>(),
+            _quantities, _count, _withRespectTo, _withRespectTo,
+            [_reframed, &_withRespectTo](const std::size_t _i,
+                                         const typename RQ::Quantity &_value)
+            {
+              _reframed[_i] = RQ(_withRespectTo, _value);
+            });
+    }
+
     /////////////////////////////////////////////////
     template <typename PolicyT, typename FeaturesT>
     FrameID FrameSemantics::Frame<PolicyT, FeaturesT>::GetFrameID() const
@@ -200,6 +391,15 @@ namespace ignition
       return this->GetFrameID();
     }
 
+    /////////////////////////////////////////////////
+    template <typename PolicyT>
+    auto FrameSemantics::Implementation<PolicyT>
+    ::SelectedFrameDataRelativeToWorld(
+        const FrameID &_id, unsigned int /*_fields*/) const -> FrameData
+    {
+      return this->FrameDataRelativeToWorld(_id);
+    }
+
     /////////////////////////////////////////////////
     template <typename PolicyT>
     FrameID FrameSemantics::Implementation<PolicyT>::GenerateFrameID(
@@ -67,6 +67,33 @@ auto GetContactsFromLastStepFeature::World<
   return output;
 }
 
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+void ReduceContactsFeature::World<PolicyT, FeaturesT>
+::SetMaxContactsPerShapePair(std::size_t _maxContacts)
+{
+  this->template Interface<ReduceContactsFeature>()
+      ->SetWorldMaxContactsPerShapePair(this->identity, _maxContacts);
+}
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+std::size_t ReduceContactsFeature::World<PolicyT, FeaturesT>
+::GetMaxContactsPerShapePair() const
+{
+  return this->template Interface<ReduceContactsFeature>()
+      ->GetWorldMaxContactsPerShapePair(this->identity);
+}
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+double ReduceContactsFeature::World<PolicyT, FeaturesT>
+::GetContactReductionFactor() const
+{
+  return this->template Interface<ReduceContactsFeature>()
+      ->GetWorldContactReductionFactor(this->identity);
+}
+
 }  // namespace physics
 }  // namespace ignition
 
@@ -76,9 +76,10 @@ namespace ignition
     auto GetWorldFromEngine::Engine<PolicyT, FeaturesT>::GetWorld(
         const std::string &_name) -> WorldPtrType
     {
-      return WorldPtrType(this->pimpl,
-                      this->template Interface<GetWorldFromEngine>()
-                          ->GetWorld(this->identity, _name));
+      const auto *impl = this->template Interface<GetWorldFromEngine>();
+      return WorldPtrType(this->pimpl, this->IdentityByName(
+          *impl, detail::EntityHandleCache::Kind::World, _name,
+          [&]() { return impl->GetWorld(this->identity, _name); }));
     }
 
     /////////////////////////////////////////////////
@@ -86,9 +87,10 @@ namespace ignition
     auto GetWorldFromEngine::Engine<PolicyT, FeaturesT>::GetWorld(
         const std::string &_name) const -> ConstWorldPtrType
     {
-      return ConstWorldPtrType(this->pimpl,
-                           this->template Interface<GetWorldFromEngine>()
-                              ->GetWorld(this->identity, _name));
+      const auto *impl = this->template Interface<GetWorldFromEngine>();
+      return ConstWorldPtrType(this->pimpl, this->IdentityByName(
+          *impl, detail::EntityHandleCache::Kind::World, _name,
+          [&]() { return impl->GetWorld(this->identity, _name); }));
     }
 
     /////////////////////////////////////////////////
@@ -162,9 +164,10 @@ namespace ignition
     auto GetModelFromWorld::World<PolicyT, FeaturesT>::GetModel(
         const std::string &_name) -> ModelPtrType
     {
-      return ModelPtrType(this->pimpl,
-                      this->template Interface<GetModelFromWorld>()
-                          ->GetModel(this->identity, _name));
+      const auto *impl = this->template Interface<GetModelFromWorld>();
+      return ModelPtrType(this->pimpl, this->IdentityByName(
+          *impl, detail::EntityHandleCache::Kind::Model, _name,
+          [&]() { return impl->GetModel(this->identity, _name); }));
     }
 
     /////////////////////////////////////////////////
@@ -172,9 +175,10 @@ namespace ignition
     auto GetModelFromWorld::World<PolicyT, FeaturesT>::GetModel(
         const std::string &_name) const -> ConstModelPtrType
     {
-      return ConstModelPtrType(this->pimpl,
-                           this->template Interface<GetModelFromWorld>()
-                               ->GetModel(this->identity, _name));
+      const auto *impl = this->template Interface<GetModelFromWorld>();
+      return ConstModelPtrType(this->pimpl, this->IdentityByName(
+          *impl, detail::EntityHandleCache::Kind::Model, _name,
+          [&]() { return impl->GetModel(this->identity, _name); }));
     }
 
     /////////////////////////////////////////////////
@@ -248,9 +252,10 @@ namespace ignition
     auto GetLinkFromModel::Model<PolicyT, FeaturesT>::GetLink(
         const std::string &_name) -> LinkPtrType
     {
-      return LinkPtrType(this->pimpl,
-                     this->template Interface<GetLinkFromModel>()
-                         ->GetLink(this->identity, _name));
+      const auto *impl = this->template Interface<GetLinkFromModel>();
+      return LinkPtrType(this->pimpl, this->IdentityByName(
+          *impl, detail::EntityHandleCache::Kind::Link, _name,
+          [&]() { return impl->GetLink(this->identity, _name); }));
     }
 
     /////////////////////////////////////////////////
@@ -258,9 +263,10 @@ namespace ignition
     auto GetLinkFromModel::Model<PolicyT, FeaturesT>::GetLink(
         const std::string &_name) const -> ConstLinkPtrType
     {
-      return ConstLinkPtrType(this->pimpl,
-                          this->template Interface<GetLinkFromModel>()
-                              ->GetLink(this->identity, _name));
+      const auto *impl = this->template Interface<GetLinkFromModel>();
+      return ConstLinkPtrType(this->pimpl, this->IdentityByName(
+          *impl, detail::EntityHandleCache::Kind::Link, _name,
+          [&]() { return impl->GetLink(this->identity, _name); }));
     }
 
     /////////////////////////////////////////////////
@@ -297,9 +303,10 @@ namespace ignition
     auto GetJointFromModel::Model<PolicyT, FeaturesT>::GetJoint(
         const std::string &_name) -> JointPtrType
     {
-      return JointPtrType(this->pimpl,
-                     this->template Interface<GetJointFromModel>()
-                         ->GetJoint(this->identity, _name));
+      const auto *impl = this->template Interface<GetJointFromModel>();
+      return JointPtrType(this->pimpl, this->IdentityByName(
+          *impl, detail::EntityHandleCache::Kind::Joint, _name,
+          [&]() { return impl->GetJoint(this->identity, _name); }));
     }
 
     /////////////////////////////////////////////////
@@ -307,9 +314,10 @@ namespace ignition
     auto GetJointFromModel::Model<PolicyT, FeaturesT>::GetJoint(
         const std::string &_name) const -> ConstJointPtrType
     {
-      return ConstJointPtrType(this->pimpl,
-                          this->template Interface<GetJointFromModel>()
-                              ->GetJoint(this->identity, _name));
+      const auto *impl = this->template Interface<GetJointFromModel>();
+      return ConstJointPtrType(this->pimpl, this->IdentityByName(
+          *impl, detail::EntityHandleCache::Kind::Joint, _name,
+          [&]() { return impl->GetJoint(this->identity, _name); }));
     }
 
     /////////////////////////////////////////////////
@@ -382,9 +390,10 @@ namespace ignition
     auto GetShapeFromLink::Link<PolicyT, FeaturesT>::GetShape(
         const std::string &_name) -> ShapePtrType
     {
-      return ShapePtrType(this->pimpl,
-            this->template Interface<GetShapeFromLink>()->GetShape(
-                            this->identity, _name));
+      const auto *impl = this->template Interface<GetShapeFromLink>();
+      return ShapePtrType(this->pimpl, this->IdentityByName(
+          *impl, detail::EntityHandleCache::Kind::Shape, _name,
+          [&]() { return impl->GetShape(this->identity, _name); }));
     }
 
     /////////////////////////////////////////////////
@@ -392,9 +401,10 @@ namespace ignition
     auto GetShapeFromLink::Link<PolicyT, FeaturesT>::GetShape(
         const std::string &_name) const -> ConstShapePtrType
     {
-      return ConstShapePtrType(this->pimpl,
-            this->template Interface<GetShapeFromLink>()->GetShape(
-                            this->identity, _name));
+      const auto *impl = this->template Interface<GetShapeFromLink>();
+      return ConstShapePtrType(this->pimpl, this->IdentityByName(
+          *impl, detail::EntityHandleCache::Kind::Shape, _name,
+          [&]() { return impl->GetShape(this->identity, _name); }));
     }
 
     /////////////////////////////////////////////////
@@ -19,7 +19,15 @@
 #define IGNITION_PHYSICS_DETAIL_IDENTITY_HH_
 
 #include <cstddef>
+#include <deque>
+#include <functional>
+#include <map>
 #include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <tuple>
+#include <vector>
 
 #include <ignition/physics/Export.hh>
 #include <ignition/utilities/SuppressWarning.hh>
@@ -34,6 +42,74 @@ namespace ignition
 
     namespace detail
     {
+      class EntityHandleCache;
+
+      /////////////////////////////////////////////////
+      /// \brief A slot that non-owning identities refer to instead of holding
+      /// a reference-counted pointer to their object. See ReferenceSlots.
+      struct ReferenceSlot
+      {
+        /// \brief The object of this slot, or nullptr if it was removed
+        void *object = nullptr;
+
+        /// \brief Incremented every time the object of this slot is removed,
+        /// so that identities of a removed object do not resolve to the next
+        /// object that is given this slot.
+        std::size_t generation = 0;
+      };
+
+      /////////////////////////////////////////////////
+      /// \brief Storage for the slots of non-owning identities. A plugin that
+      /// opts into non-owning identities keeps one of these, acquires a slot
+      /// for each of its objects, and passes the slot to GenerateIdentity
+      /// instead of a shared_ptr. Copying such an identity does not touch any
+      /// reference count.
+      ///
+      /// Slots are reused but never freed before the plugin is destroyed, and
+      /// a plugin outlives every Entity that refers to it, so an identity can
+      /// always check whether its object is still alive.
+      class ReferenceSlots
+      {
+        /// \brief Give an object a slot
+        /// \param[in] _object
+        ///   The object. It must stay alive until Release is called.
+        /// \return the slot of the object
+        public: ReferenceSlot &Acquire(void *_object)
+        {
+          ReferenceSlot *slot = nullptr;
+          if (this->freeSlots.empty())
+          {
+            this->slots.emplace_back();
+            slot = &this->slots.back();
+          }
+          else
+          {
+            slot = this->freeSlots.back();
+            this->freeSlots.pop_back();
+          }
+
+          slot->object = _object;
+          return *slot;
+        }
+
+        /// \brief Call this when the object of a slot is removed. Identities
+        /// of the object resolve to nullptr from then on.
+        /// \param[in] _slot
+        ///   A slot that was returned by Acquire
+        public: void Release(ReferenceSlot &_slot)
+        {
+          _slot.object = nullptr;
+          ++_slot.generation;
+          this->freeSlots.push_back(&_slot);
+        }
+
+        /// \brief The slots. A deque never moves its elements when it grows.
+        private: std::deque<ReferenceSlot> slots;
+
+        /// \brief Slots that can be given to new objects
+        private: std::vector<ReferenceSlot*> freeSlots;
+      };
+
       /////////////////////////////////////////////////
       /// \brief This base class is used by plugin implementations to generate
       /// identities for entities.
@@ -45,6 +121,18 @@ namespace ignition
             std::size_t _id,
             const std::shared_ptr<void> &_ref = nullptr) const;
 
+        /// \brief Generate a non-owning identity for an Entity. The identity
+        /// does not keep its object alive. Use this when the plugin owns its
+        /// objects and does not want to pay for reference counting every time
+        /// an identity is created or copied.
+        /// \param[in] _id
+        ///   The ID of the entity
+        /// \param[in] _slot
+        ///   The slot of the object of the entity. See ReferenceSlots.
+        protected: Identity GenerateIdentity(
+            std::size_t _id,
+            const ReferenceSlot &_slot) const;
+
         protected: Identity GenerateInvalidId() const;
 
         /// \brief An implementation class can use this function to get the
@@ -55,13 +143,27 @@ namespace ignition
         /// \brief An implementation class can use this function to get the
         /// reference contained in the identity
         /// \tparam T The stored pointer is cast to this type.
-        /// \return A raw pointer from the stored shared_ptr but cast to the
-        /// provided type T
+        /// \return A raw pointer from the stored shared_ptr, or the object of
+        /// the slot of a non-owning identity, cast to the provided type T.
+        /// This is a nullptr if the object of a non-owning identity was
+        /// removed.
         protected: template<typename T>
-        T *ReferenceInterface(const Identity &_identity) const
-        {
-          return static_cast<T *>(this->Reference(_identity).get());
-        }
+        T *ReferenceInterface(const Identity &_identity) const;
+
+        /// \brief Constructor
+        public: Implementation();
+
+        /// \brief Destructor
+        public: ~Implementation();
+
+        /// \brief Identities of entities that were looked up by name through
+        /// the entity API. See EntityHandleCache.
+        IGN_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+        private: const std::unique_ptr<EntityHandleCache> entityHandles;
+        IGN_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+
+        // Entities use the cache of the plugin that they belong to
+        template <typename, typename> friend class ::ignition::physics::Entity;
       };
     }
 
@@ -99,6 +201,14 @@ namespace ignition
       public: const std::shared_ptr<void> ref;
       IGN_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
 
+      /// \brief The slot of the object of a non-owning identity, or nullptr
+      /// if this identity uses ref instead. See detail::ReferenceSlots.
+      public: const detail::ReferenceSlot * const slot;
+
+      /// \brief The generation of slot when this identity was created. The
+      /// object was removed if this no longer matches.
+      public: const std::size_t generation;
+
       /// \brief This is used by Entity so that it can default-construct. This
       /// should never actually be called.
       private: Identity();
@@ -108,10 +218,98 @@ namespace ignition
           std::size_t _id,
           const std::shared_ptr<void> &_ref);
 
+      /// \brief This is called by Feature::Implementation
+      private: Identity(
+          std::size_t _id,
+          const detail::ReferenceSlot &_slot);
+
       // These friends are the only classes allowed to create an identity
       template <typename, typename> friend class ::ignition::physics::Entity;
       friend class ::ignition::physics::detail::Implementation;
     };
+
+    namespace detail
+    {
+      /////////////////////////////////////////////////
+      /// \brief The identities of entities that were looked up by name, kept
+      /// by each plugin so that the entity API can answer repeated lookups,
+      /// such as World::GetModel(name), without asking the engine again.
+      ///
+      /// The entity API clears the cache whenever it creates or removes an
+      /// entity, or attaches or detaches a joint, since that can change what a
+      /// name refers to, or remove or move any number of links, joints and
+      /// shapes. Identities whose object was removed in some other way are
+      /// not returned either, if they can tell (see ReferenceSlot). Lookups
+      /// that fail are never stored.
+      class IGNITION_PHYSICS_VISIBLE EntityHandleCache
+      {
+        /// \brief The kinds of entities that can be looked up by name
+        public: enum class Kind { World, Model, Link, Joint, Shape };
+
+        /// \brief Find an identity that was stored earlier.
+        /// \param[in] _kind
+        ///   The kind of entity that was looked up
+        /// \param[in] _parentID
+        ///   The ID of the entity that the lookup was made on
+        /// \param[in] _name
+        ///   The name that was looked up
+        /// \return The identity, or std::nullopt if none was stored or if the
+        /// object of the stored identity was removed
+        public: std::optional<Identity> Find(
+            Kind _kind,
+            std::size_t _parentID,
+            const std::string &_name) const;
+
+        /// \brief Store the result of a lookup, replacing any identity that
+        /// was stored for the same lookup.
+        /// \param[in] _kind
+        ///   The kind of entity that was looked up
+        /// \param[in] _parentID
+        ///   The ID of the entity that the lookup was made on
+        /// \param[in] _name
+        ///   The name that was looked up
+        /// \param[in] _identity
+        ///   The identity of the entity that was found
+        public: void Insert(
+            Kind _kind,
+            std::size_t _parentID,
+            const std::string &_name,
+            const Identity &_identity);
+
+        /// \brief Forget every stored identity
+        public: void Clear();
+
+        /// \brief Get the number of stored identities
+        public: std::size_t Size() const;
+
+        private: using Key = std::tuple<Kind, std::size_t, std::string>;
+
+        IGN_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+        /// \brief Protects identities, since entities of one engine may be
+        /// used from several threads. Lookups only need a shared lock.
+        private: mutable std::shared_mutex mutex;
+
+        /// \brief The stored identities. The comparator is transparent so
+        /// that Find does not need to copy the name.
+        private: std::map<Key, Identity, std::less<>> identities;
+        IGN_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+      };
+
+      /////////////////////////////////////////////////
+      template<typename T>
+      T *Implementation::ReferenceInterface(const Identity &_identity) const
+      {
+        if (_identity.slot)
+        {
+          if (_identity.slot->generation != _identity.generation)
+            return nullptr;
+
+          return static_cast<T *>(_identity.slot->object);
+        }
+
+        return static_cast<T *>(this->Reference(_identity).get());
+      }
+    }
   }
 }
 
@@ -163,8 +163,9 @@ namespace ignition
     template <typename PolicyT, typename FeaturesT>
     void DetachJointFeature::Joint<PolicyT, FeaturesT>::Detach()
     {
-      this->template Interface<DetachJointFeature>()
-          ->DetachJoint(this->identity);
+      auto *impl = this->template Interface<DetachJointFeature>();
+      impl->DetachJoint(this->identity);
+      this->ClearIdentitiesByName(*impl);
     }
   }
 }
@@ -96,6 +96,16 @@ void AddLinkExternalForceTorque::Link<PolicyT, FeaturesT>::AddExternalTorque(
       ->AddLinkExternalTorqueInWorld(this->identity, torqueWorld);
 }
 
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+void AddExternalWrenchesFeature::World<PolicyT, FeaturesT>
+::AddExternalWrenches(
+    const ExternalWrenchesType &_wrenches)
+{
+  this->template Interface<AddExternalWrenchesFeature>()
+      ->AddWorldExternalWrenches(this->identity, _wrenches);
+}
+
 }  // namespace physics
 }  // namespace ignition
 
@@ -67,9 +67,11 @@ namespace physics
       const Normal &_normal,
       const Point &_point)
   {
-    return PlaneShapePtr<P, F>(this->pimpl,
-          this->template Interface<AttachPlaneShapeFeature>()
-            ->AttachPlaneShape(this->identity, _name, _normal, _point));
+    auto *impl = this->template Interface<AttachPlaneShapeFeature>();
+    const Identity shape =
+        impl->AttachPlaneShape(this->identity, _name, _normal, _point);
+    this->ClearIdentitiesByName(*impl);
+    return PlaneShapePtr<P, F>(this->pimpl, shape);
   }
 }
 }
@@ -52,9 +52,11 @@ namespace ignition
         const std::string &_name,
         const Axis &_axis) -> JointPtrType
     {
-      return JointPtrType(this->pimpl,
-            this->template Interface<AttachPrismaticJointFeature>()
-              ->AttachPrismaticJoint(this->identity, _parent, _name, _axis));
+      auto *impl = this->template Interface<AttachPrismaticJointFeature>();
+      const Identity joint =
+          impl->AttachPrismaticJoint(this->identity, _parent, _name, _axis);
+      this->ClearIdentitiesByName(*impl);
+      return JointPtrType(this->pimpl, joint);
     }
   }
 }
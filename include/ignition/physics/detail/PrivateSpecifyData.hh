@@ -71,18 +71,17 @@ namespace ignition
           usedExpectedDataAccess = true;
           #endif
 
-          if (!this->expectedIterator->second.data)
+          if (!this->expectedEntry->data)
           {
             ++_data->CompositeData::numEntries;
-            this->expectedIterator->second.data =
-                std::unique_ptr<Cloneable>(new MakeCloneable<Expected>());
+            this->expectedEntry->template Emplace<Expected>();
           }
 
-          SetToQueried(this->expectedIterator,
+          SetToQueried(*this->expectedEntry,
                        _data->CompositeData::numQueries);
 
           return static_cast<MakeCloneable<Expected>&>(
-                *this->expectedIterator->second.data);
+                *this->expectedEntry->data);
         }
 
         /// \brief Delegate the function to the standard CompositeData method
@@ -103,21 +102,26 @@ namespace ignition
           usedExpectedDataAccess = true;
           #endif
 
-          if (!this->expectedIterator->second.data)
-            ++_data->CompositeData::numEntries;
-
-          const bool inserted = !this->expectedIterator->second.data;
+          const bool inserted = !this->expectedEntry->data;
 
-          this->expectedIterator->second.data =
-              std::unique_ptr<Cloneable>(new MakeCloneable<Expected>(
-                                           std::forward<Args>(args)...));
+          if (inserted)
+          {
+            ++_data->CompositeData::numEntries;
+            this->expectedEntry->template Emplace<Expected>(
+                  std::forward<Args>(args)...);
+          }
+          else
+          {
+            static_cast<MakeCloneable<Expected>&>(*this->expectedEntry->data) =
+                MakeCloneable<Expected>(std::forward<Args>(args)...);
+          }
 
-          SetToQueried(this->expectedIterator,
+          SetToQueried(*this->expectedEntry,
                        _data->CompositeData::numQueries);
 
           return CompositeData::InsertResult<Expected>{
                 static_cast<MakeCloneable<Expected>&>(
-                  *this->expectedIterator->second.data),
+                  *this->expectedEntry->data),
                 inserted};
         }
 
@@ -141,20 +145,20 @@ namespace ignition
 
           bool inserted = false;
 
-          if (!this->expectedIterator->second.data)
+          if (!this->expectedEntry->data)
           {
             ++_data->CompositeData::numEntries;
-            this->expectedIterator->second.data = std::unique_ptr<Cloneable>(
-                  new MakeCloneable<Expected>(std::forward<Args>(args)...));
+            this->expectedEntry->template Emplace<Expected>(
+                  std::forward<Args>(args)...);
             inserted = true;
           }
 
-          SetToQueried(this->expectedIterator,
+          SetToQueried(*this->expectedEntry,
                        _data->CompositeData::numQueries);
 
           return CompositeData::InsertResult<Expected>{
                 static_cast<MakeCloneable<Expected>&>(
-                  *this->expectedIterator->second.data),
+                  *this->expectedEntry->data),
                 inserted};
         }
 
@@ -172,20 +176,20 @@ namespace ignition
           usedExpectedDataAccess = true;
           #endif
 
-          if (!this->expectedIterator->second.data)
+          if (!this->expectedEntry->data)
             return true;
 
-          if (this->expectedIterator->second.required)
+          if (this->expectedEntry->required)
             return false;
 
-          if (this->expectedIterator->second.queried)
+          if (this->expectedEntry->queried)
           {
             --_data->CompositeData::numQueries;
-            this->expectedIterator->second.queried = false;
+            this->expectedEntry->queried = false;
           }
 
           --_data->CompositeData::numEntries;
-          this->expectedIterator->second.data.reset();
+          this->expectedEntry->data.reset();
           return true;
         }
 
@@ -205,17 +209,17 @@ namespace ignition
           usedExpectedDataAccess = true;
           #endif
 
-          if (!this->expectedIterator->second.data)
+          if (!this->expectedEntry->data)
             return nullptr;
 
           if (CompositeData::QueryMode::NORMAL == _mode)
           {
-            SetToQueried(this->expectedIterator,
+            SetToQueried(*this->expectedEntry,
                                _data->CompositeData::numQueries);
           }
 
           return static_cast<MakeCloneable<Expected>*>(
-                this->expectedIterator->second.data.get());
+                this->expectedEntry->data.get());
         }
 
         /// \brief Delegate the function to the standard CompositeData method
@@ -235,17 +239,17 @@ namespace ignition
           usedExpectedDataAccess = true;
           #endif
 
-          if (!this->expectedIterator->second.data)
+          if (!this->expectedEntry->data)
             return nullptr;
 
           if (CompositeData::QueryMode::NORMAL == _mode)
           {
-            SetToQueried(this->expectedIterator,
+            SetToQueried(*this->expectedEntry,
                                _data->CompositeData::numQueries);
           }
 
           return static_cast<const MakeCloneable<Expected>*>(
-                this->expectedIterator->second.data.get());
+                this->expectedEntry->data.get());
         }
 
         /// \brief Use this->Query to perform the the Has function
@@ -275,12 +279,12 @@ namespace ignition
           // status is initialized to everything being false
           CompositeData::DataStatus status;
 
-          if (!this->expectedIterator->second.data)
+          if (!this->expectedEntry->data)
             return status;
 
           status.exists = true;
-          status.required = this->expectedIterator->second.required;
-          status.queried = this->expectedIterator->second.queried;
+          status.required = this->expectedEntry->required;
+          status.queried = this->expectedEntry->queried;
 
           return status;
         }
@@ -300,14 +304,14 @@ namespace ignition
           usedExpectedDataAccess = true;
           #endif
 
-          if (!this->expectedIterator->second.data)
+          if (!this->expectedEntry->data)
             return false;
 
-          if (!this->expectedIterator->second.queried)
+          if (!this->expectedEntry->queried)
             return false;
 
           --_data->CompositeData::numQueries;
-          this->expectedIterator->second.queried = false;
+          this->expectedEntry->queried = false;
 
           return true;
         }
@@ -330,20 +334,20 @@ namespace ignition
           usedExpectedDataAccess = true;
           #endif
 
-          this->expectedIterator->second.required = true;
+          this->expectedEntry->required = true;
 
-          if (!this->expectedIterator->second.data)
+          if (!this->expectedEntry->data)
           {
             ++_data->CompositeData::numEntries;
-            this->expectedIterator->second.data = std::unique_ptr<Cloneable>(
-                  new MakeCloneable<Expected>(std::forward<Args>(_args)...));
+            this->expectedEntry->template Emplace<Expected>(
+                  std::forward<Args>(_args)...);
           }
 
-          SetToQueried(this->expectedIterator,
+          SetToQueried(*this->expectedEntry,
               _data->CompositeData::numQueries);
 
           return static_cast<MakeCloneable<Expected>&>(
-                *this->expectedIterator->second.data);
+                *this->expectedEntry->data);
         }
 
         /// \brief Delegate the function to the standard CompositeData method
@@ -360,7 +364,7 @@ namespace ignition
           usedExpectedDataAccess = true;
           #endif
 
-          return this->expectedIterator->second.required;
+          return this->expectedEntry->required;
         }
 
         /// \brief Always returns false
@@ -378,10 +382,9 @@ namespace ignition
 
         template <typename...> friend class ::ignition::physics::ExpectData;
 
-        /// \brief Construct this with the iterator that it is meant to hold
-        private: explicit PrivateExpectData(
-            const CompositeData::MapOfData::iterator _it)
-          : expectedIterator(_it)
+        /// \brief Construct this with the entry that it is meant to hold
+        private: explicit PrivateExpectData(CompositeData::DataEntry *_entry)
+          : expectedEntry(_entry)
         {
           // Do nothing
         }
@@ -393,8 +396,8 @@ namespace ignition
         /// \brief Copy assignment operator.
         /// We need to specify a copy constructor because the compiler will not
         /// generate one for us. This is because the generated constructor would
-        /// try to copy expectedIterator and fail because it's a const. Since
-        /// expectedIterator is already initialized when the copy assignment
+        /// try to copy expectedEntry and fail because it's a const. Since
+        /// expectedEntry is already initialized when the copy assignment
         /// operator is used we do nothing here.
         private: PrivateExpectData<Expected> &operator=(
             const PrivateExpectData<Expected> &)
@@ -402,7 +405,7 @@ namespace ignition
           return *this;
         }
 
-        public: const CompositeData::MapOfData::iterator expectedIterator;
+        public: CompositeData::DataEntry * const expectedEntry;
       };
 
       template <typename Required>
@@ -413,30 +416,30 @@ namespace ignition
         public: template <typename Data>
         const Data &Get(
             const RequireData<Required> *_data,
-            const CompositeData::MapOfData::iterator &_it,
+            const CompositeData::DataEntry &_entry,
             type<Data>) const
         {
           static_assert(std::is_same<Data, Required>::type,
                         IGNITION_PHYSICS_CONST_GET_ERROR);
 
-          SetToQueried(_it, _data->CompositeData::numQueries);
+          SetToQueried(_entry, _data->CompositeData::numQueries);
 
-          return static_cast<const MakeCloneable<Required>&>(*_it->second.data);
+          return static_cast<const MakeCloneable<Required>&>(*_entry.data);
         }
 
         /// \brief Use a high-speed accessor for this Required data type
         public: const Required &Get(
             const RequireData<Required> *_data,
-            const CompositeData::MapOfData::iterator &_it,
+            const CompositeData::DataEntry &_entry,
             type<Required>) const
         {
           #ifdef IGNITION_UNITTEST_EXPECTDATA_ACCESS
           usedExpectedDataAccess = true;
           #endif
 
-          SetToQueried(_it, _data->CompositeData::numQueries);
+          SetToQueried(_entry, _data->CompositeData::numQueries);
 
-          return static_cast<const MakeCloneable<Required>&>(*_it->second.data);
+          return static_cast<const MakeCloneable<Required>&>(*_entry.data);
         }
 
         /// \brief Always returns false
@@ -30,8 +30,12 @@ namespace ignition
     bool RemoveModelFromWorld::World<PolicyT, FeaturesT>::RemoveModel(
         const std::size_t _index)
     {
-      return this->template Interface<RemoveModelFromWorld>()
-          ->RemoveModelByIndex(this->identity, _index);
+      auto *impl = this->template Interface<RemoveModelFromWorld>();
+      const bool removed = impl->RemoveModelByIndex(this->identity, _index);
+      if (removed)
+        this->ClearIdentitiesByName(*impl);
+
+      return removed;
     }
 
 
@@ -40,16 +44,24 @@ namespace ignition
     bool RemoveModelFromWorld::World<PolicyT, FeaturesT>::RemoveModel(
         const std::string &_name)
     {
-      return this->template Interface<RemoveModelFromWorld>()
-                          ->RemoveModelByName(this->identity, _name);
+      auto *impl = this->template Interface<RemoveModelFromWorld>();
+      const bool removed = impl->RemoveModelByName(this->identity, _name);
+      if (removed)
+        this->ClearIdentitiesByName(*impl);
+
+      return removed;
     }
 
     /////////////////////////////////////////////////
     template <typename PolicyT, typename FeaturesT>
     bool RemoveModelFromWorld::Model<PolicyT, FeaturesT>::Remove()
     {
-      return this->template Interface<RemoveModelFromWorld>()
-              ->RemoveModel(this->identity);
+      auto *impl = this->template Interface<RemoveModelFromWorld>();
+      const bool removed = impl->RemoveModel(this->identity);
+      if (removed)
+        this->ClearIdentitiesByName(*impl);
+
+      return removed;
     }
 
     /////////////////////////////////////////////////
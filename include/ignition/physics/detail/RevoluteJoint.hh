@@ -52,9 +52,11 @@ namespace ignition
         const std::string &_name,
         const Axis &_axis) -> JointPtrType
     {
-      return JointPtrType(this->pimpl,
-            this->template Interface<AttachRevoluteJointFeature>()
-              ->AttachRevoluteJoint(this->identity, _parent, _name, _axis));
+      auto *impl = this->template Interface<AttachRevoluteJointFeature>();
+      const Identity joint =
+          impl->AttachRevoluteJoint(this->identity, _parent, _name, _axis);
+      this->ClearIdentitiesByName(*impl);
+      return JointPtrType(this->pimpl, joint);
     }
   }
 }
@@ -32,9 +32,7 @@ namespace ignition
     ExpectData<Expected>::ExpectData()
       : CompositeData(),
         privateExpectData(
-          this->dataMap.insert(
-            std::make_pair(typeid(Expected).name(),
-                           CompositeData::DataEntry())).first)
+          &this->FindOrCreateEntry(CompositeData::TypeIdOf<Expected>()))
     {
       // Do nothing
     }
@@ -164,12 +162,11 @@ namespace ignition
         ExpectData<Required>()
     {
       CompositeData::DataEntry &entry =
-          this->ExpectData<Required>::privateExpectData
-            .expectedIterator->second;
+          *this->ExpectData<Required>::privateExpectData.expectedEntry;
 
       // Create the required data in its designated map entry, and mark it as
       // required for runtime checking.
-      entry.data = std::unique_ptr<Cloneable>(new MakeCloneable<Required>());
+      entry.Emplace<Required>();
       entry.required = true;
       ++CompositeData::numEntries;
     }
@@ -179,12 +176,11 @@ namespace ignition
     template <typename Data>
     const Data &RequireData<Required>::Get() const
     {
-      const CompositeData::MapOfData::iterator &it =
-          this->ExpectData<Required>::privateExpectData
-            .expectedIterator;
+      const CompositeData::DataEntry &entry =
+          *this->ExpectData<Required>::privateExpectData.expectedEntry;
 
       return this->RequireData<Required>::privateRequireData.Get(
-            this, it, detail::type<Data>());
+            this, entry, detail::type<Data>());
     }
 
     /////////////////////////////////////////////////
@@ -52,9 +52,11 @@ namespace ignition
         Scalar _radius,
         const PoseType &_pose) -> ShapePtrType
     {
-      return ShapePtrType(this->pimpl,
-            this->template Interface<AttachSphereShapeFeature>()
-                ->AttachSphereShape(this->identity, _name, _radius, _pose));
+      auto *impl = this->template Interface<AttachSphereShapeFeature>();
+      const Identity shape =
+          impl->AttachSphereShape(this->identity, _name, _radius, _pose);
+      this->ClearIdentitiesByName(*impl);
+      return ShapePtrType(this->pimpl, shape);
     }
   }
 }
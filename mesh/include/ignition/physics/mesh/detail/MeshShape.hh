@@ -63,9 +63,11 @@ namespace mesh
       const PoseType &_pose,
       const Dimensions &_scale) -> ShapePtrType
   {
-    return ShapePtrType(this->pimpl,
-          this->template Interface<AttachMeshShapeFeature>()
-              ->AttachMeshShape(this->identity, _name, _mesh, _pose, _scale));
+    auto *impl = this->template Interface<AttachMeshShapeFeature>();
+    const Identity shape = impl->AttachMeshShape(
+        this->identity, _name, _mesh, _pose, _scale);
+    this->ClearIdentitiesByName(*impl);
+    return ShapePtrType(this->pimpl, shape);
   }
 }
 }
@@ -49,9 +49,11 @@ template <typename PolicyT, typename FeaturesT>
 auto ConstructSdfCollision::Link<PolicyT, FeaturesT>::ConstructCollision(
     const ::sdf::Collision &_collision) -> ShapePtrType
 {
-  return ShapePtrType(this->pimpl,
-        this->template Interface<ConstructSdfCollision>()
-            ->ConstructSdfCollision(this->identity, _collision));
+  auto *impl = this->template Interface<ConstructSdfCollision>();
+  const Identity shape =
+      impl->ConstructSdfCollision(this->identity, _collision);
+  this->ClearIdentitiesByName(*impl);
+  return ShapePtrType(this->pimpl, shape);
 }
 
 }
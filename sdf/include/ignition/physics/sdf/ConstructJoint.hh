@@ -49,9 +49,10 @@ template <typename PolicyT, typename FeaturesT>
 auto ConstructSdfJoint::Model<PolicyT, FeaturesT>::ConstructJoint(
     const ::sdf::Joint &_joint) -> JointPtrType
 {
-  return JointPtrType(this->pimpl,
-        this->template Interface<ConstructSdfJoint>()
-              ->ConstructSdfJoint(this->identity, _joint));
+  auto *impl = this->template Interface<ConstructSdfJoint>();
+  const Identity joint = impl->ConstructSdfJoint(this->identity, _joint);
+  this->ClearIdentitiesByName(*impl);
+  return JointPtrType(this->pimpl, joint);
 }
 
 }
@@ -49,9 +49,10 @@ template <typename PolicyT, typename FeaturesT>
 auto ConstructSdfLink::Model<PolicyT, FeaturesT>::ConstructLink(
     const ::sdf::Link &_link) -> LinkPtrType
 {
-  return LinkPtrType(this->pimpl,
-        this->template Interface<ConstructSdfLink>()
-              ->ConstructSdfLink(this->identity, _link));
+  auto *impl = this->template Interface<ConstructSdfLink>();
+  const Identity link = impl->ConstructSdfLink(this->identity, _link);
+  this->ClearIdentitiesByName(*impl);
+  return LinkPtrType(this->pimpl, link);
 }
 
 }
@@ -51,9 +51,10 @@ template <typename PolicyT, typename FeaturesT>
 auto ConstructSdfModel::World<PolicyT, FeaturesT>::ConstructModel(
     const ::sdf::Model &_model) -> ModelPtrType
 {
-  return ModelPtrType(this->pimpl,
-        this->template Interface<ConstructSdfModel>()
-              ->ConstructSdfModel(this->identity, _model));
+  auto *impl = this->template Interface<ConstructSdfModel>();
+  const Identity model = impl->ConstructSdfModel(this->identity, _model);
+  this->ClearIdentitiesByName(*impl);
+  return ModelPtrType(this->pimpl, model);
 }
 }
 }
@@ -60,9 +60,10 @@ template <typename PolicyT, typename FeaturesT>
 auto ConstructSdfNestedModel::Model<PolicyT, FeaturesT>::ConstructNestedModel(
     const ::sdf::Model &_model) -> ModelPtrType
 {
-  return ModelPtrType(this->pimpl,
-        this->template Interface<ConstructSdfNestedModel>()
-              ->ConstructSdfNestedModel(this->identity, _model));
+  auto *impl = this->template Interface<ConstructSdfNestedModel>();
+  const Identity model = impl->ConstructSdfNestedModel(this->identity, _model);
+  this->ClearIdentitiesByName(*impl);
+  return ModelPtrType(this->pimpl, model);
 }
 
 /////////////////////////////////////////////////
@@ -70,9 +71,10 @@ template <typename PolicyT, typename FeaturesT>
 auto ConstructSdfNestedModel::World<PolicyT, FeaturesT>::ConstructNestedModel(
     const ::sdf::Model &_model) -> ModelPtrType
 {
-  return ModelPtrType(this->pimpl,
-        this->template Interface<ConstructSdfNestedModel>()
-              ->ConstructSdfNestedModel(this->identity, _model));
+  auto *impl = this->template Interface<ConstructSdfNestedModel>();
+  const Identity model = impl->ConstructSdfNestedModel(this->identity, _model);
+  this->ClearIdentitiesByName(*impl);
+  return ModelPtrType(this->pimpl, model);
 }
 }
 }
@@ -49,9 +49,10 @@ template <typename PolicyT, typename FeaturesT>
 auto ConstructSdfVisual::Link<PolicyT, FeaturesT>::ConstructVisual(
     const ::sdf::Visual &_visual) -> bool
 {
-  return static_cast<bool>(
-        this->template Interface<ConstructSdfVisual>()
-            ->ConstructSdfVisual(this->identity, _visual));
+  auto *impl = this->template Interface<ConstructSdfVisual>();
+  const Identity visual = impl->ConstructSdfVisual(this->identity, _visual);
+  this->ClearIdentitiesByName(*impl);
+  return static_cast<bool>(visual);
 }
 
 }
@@ -49,9 +49,10 @@ template <typename PolicyT, typename FeaturesT>
 auto ConstructSdfWorld::Engine<PolicyT, FeaturesT>::ConstructWorld(
     const ::sdf::World &_world) -> WorldPtrType
 {
-  return WorldPtrType(this->pimpl,
-        this->template Interface<ConstructSdfWorld>()
-            ->ConstructSdfWorld(this->identity, _world));
+  auto *impl = this->template Interface<ConstructSdfWorld>();
+  const Identity world = impl->ConstructSdfWorld(this->identity, _world);
+  this->ClearIdentitiesByName(*impl);
+  return WorldPtrType(this->pimpl, world);
 }
 
 }
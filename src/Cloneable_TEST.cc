@@ -17,6 +17,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <memory>
+
 #include "ignition/physics/Cloneable.hh"
 #include "utils/TestDataTypes.hh"
 
@@ -172,6 +175,73 @@ TEST(Cloneable_TEST, Copy)
   EXPECT_EQ("movingFrom", copyToCasted->myString);
 }
 
+/////////////////////////////////////////////////
+TEST(Cloneable_TEST, CloneInto)
+{
+  using ignition::physics::CloneableDeleter;
+  using CloneablePtr = std::unique_ptr<Cloneable, CloneableDeleter>;
+
+  alignas(std::max_align_t) unsigned char buffer[64];
+
+  MakeCloneable<DoubleData> doubleData(2.5);
+  {
+    CloneablePtr cloned(
+          doubleData.CloneInto(buffer, sizeof(buffer)), CloneableDeleter{true});
+    ASSERT_NE(nullptr, cloned);
+
+    MakeCloneable<DoubleData> *clonedCasted =
+        dynamic_cast<MakeCloneable<DoubleData>*>(cloned.get());
+    ASSERT_NE(nullptr, clonedCasted);
+    EXPECT_EQ(static_cast<void*>(buffer), static_cast<void*>(clonedCasted));
+    EXPECT_DOUBLE_EQ(2.5, clonedCasted->myDouble);
+  }
+
+  MakeCloneable<StringData> stringData("this will be moved");
+  {
+    CloneablePtr moved(
+          stringData.MoveInto(buffer, sizeof(buffer)), CloneableDeleter{true});
+    ASSERT_NE(nullptr, moved);
+
+    MakeCloneable<StringData> *movedCasted =
+        dynamic_cast<MakeCloneable<StringData>*>(moved.get());
+    ASSERT_NE(nullptr, movedCasted);
+    EXPECT_EQ("this will be moved", movedCasted->myString);
+  }
+
+  // Nothing is constructed when the object does not fit
+  EXPECT_EQ(nullptr, doubleData.CloneInto(buffer, sizeof(double)));
+  EXPECT_EQ(nullptr, stringData.MoveInto(buffer, 1));
+}
+
+/////////////////////////////////////////////////
+/// \brief A Cloneable type that only implements the functions that every
+/// Cloneable type had to implement before CloneInto(~) and MoveInto(~)
+/// existed
+class LegacyCloneable : public Cloneable
+{
+  public: std::unique_ptr<Cloneable> Clone() const override
+  {
+    return std::make_unique<LegacyCloneable>();
+  }
+
+  public: void Copy(const Cloneable &) override { }
+
+  public: void Copy(Cloneable &&) override { }
+};
+
+/////////////////////////////////////////////////
+TEST(Cloneable_TEST, DefaultCloneInto)
+{
+  alignas(std::max_align_t) unsigned char buffer[64];
+
+  // Types that do not override CloneInto(~) or MoveInto(~) are never placed in
+  // caller-owned storage, so callers fall back to Clone()
+  LegacyCloneable legacy;
+  EXPECT_EQ(nullptr, legacy.CloneInto(buffer, sizeof(buffer)));
+  EXPECT_EQ(nullptr, legacy.MoveInto(buffer, sizeof(buffer)));
+  EXPECT_NE(nullptr, legacy.Clone());
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
@@ -16,37 +16,79 @@
 */
 
 #include <cassert>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "ignition/physics/CompositeData.hh"
+#include "ignition/physics/CompositeDataArena.hh"
 
 namespace ignition
 {
   namespace physics
   {
+    namespace
+    {
+    /////////////////////////////////////////////////
+    /// \brief Registry of the labels of every data type that has been given a
+    /// TypeId in this process. The ID of a label is its index in labels.
+    struct TypeRegistry
+    {
+      std::mutex mutex;
+      std::unordered_map<std::string, CompositeData::TypeId> ids;
+      std::vector<std::string> labels;
+    };
+
+    /////////////////////////////////////////////////
+    static TypeRegistry &Registry()
+    {
+      static TypeRegistry registry;
+      return registry;
+    }
+    }
+
+    /////////////////////////////////////////////////
+    /// \brief Get the labels of a set of data types, sorted alphabetically
+    static std::set<std::string> LabelsOf(
+        const std::vector<CompositeData::TypeId> &_ids)
+    {
+      std::set<std::string> labels;
+
+      TypeRegistry &registry = Registry();
+      std::lock_guard<std::mutex> lock(registry.mutex);
+      for (const CompositeData::TypeId id : _ids)
+        labels.insert(registry.labels[id]);
+
+      return labels;
+    }
 
     /////////////////////////////////////////////////
     /// \brief Mark an entry as unqueried and decrement the query counter if
     /// the entry was originally marked as queried
     static void RemoveQuery(
-        const CompositeData::MapOfData::iterator &_it, std::size_t &_numQueries)
+        CompositeData::DataEntry &_entry, std::size_t &_numQueries)
     {
-      if (_it->second.queried)
+      if (_entry.queried)
       {
         --_numQueries;
-        _it->second.queried = false;
+        _entry.queried = false;
       }
     }
 
     /////////////////////////////////////////////////
-    /// \brief Remove an entry from a map and adjust the counters
+    /// \brief Remove the data of an entry and adjust the counters
     static void RemoveEntryUnlessRequired(
-        const CompositeData::MapOfData::iterator &_receiver,
+        CompositeData::DataEntry &_receiver,
         std::size_t &_numEntries, std::size_t &_numQueries)
     {
-      if (!_receiver->second.required)
+      if (!_receiver.required && _receiver.data)
       {
         // If the data isn't required, delete it
-        _receiver->second.data.reset();
+        _receiver.data.reset();
         --_numEntries;
         RemoveQuery(_receiver, _numQueries);
       }
@@ -55,62 +97,35 @@ namespace ignition
     /////////////////////////////////////////////////
     /// \brief Use this to copy data efficiently from one existing data instance
     /// to another existing data instance
-    template <typename SenderType>
     static void StandardDataCopy(
-        const CompositeData::MapOfData::iterator &_receiver,
-        SenderType _sender,
+        CompositeData::DataEntry &_receiver,
+        const CompositeData::DataEntry &_sender,
         const bool _mergeRequirements,
         std::size_t &/*_numEntries*/,
         std::size_t &/*_numQueries*/)
     {
-      _receiver->second.data->Copy(*_sender->second.data);
-      if (_mergeRequirements && _sender->second.required)
-        _receiver->second.required = true;
+      _receiver.data->Copy(*_sender.data);
+      if (_mergeRequirements && _sender.required)
+        _receiver.required = true;
     }
 
     /////////////////////////////////////////////////
-    /// \brief Use this to clone data into a map entry which has an entry for
-    /// the data type but does not currently have an instance
-    template <typename SenderType>
+    /// \brief Use this to clone data into an entry which does not currently
+    /// have an instance
     static void StandardDataClone(
-        const CompositeData::MapOfData::iterator &_receiver,
-        SenderType _sender,
+        CompositeData::DataEntry &_receiver,
+        const CompositeData::DataEntry &_sender,
         const bool _mergeRequirements,
         std::size_t &_numEntries,
         std::size_t &/*_numQueries*/)
     {
-      assert(!_receiver->second.data &&
+      assert(!_receiver.data &&
              "Calling StandardCloneData on a data entry that already exists. "
              "This should not be possible! Please report this bug!");
 
-      _receiver->second = CompositeData::DataEntry(
-            _sender->second.data->Clone(),
-            _mergeRequirements && _sender->second.required);
-
-      ++_numEntries;
-    }
-
-    /////////////////////////////////////////////////
-    /// \brief Use this to create a new data entry and instance for a map which
-    /// did not previously contain an entry for the data type
-    template <typename SenderType>
-    static void StandardDataCreate(
-        CompositeData::MapOfData &_toMap,
-        SenderType _sender,
-        const bool _mergeRequirements,
-        std::size_t &_numEntries)
-    {
-      const bool inserted = _toMap.insert(
-            std::make_pair(
-              _sender->first,
-              CompositeData::DataEntry(
-                _sender->second.data->Clone(),
-                _mergeRequirements && _sender->second.required))).second;
-
-      (void)(inserted);
-      assert(inserted &&
-             "Calling StandardDataCreate on a data entry that already exists. "
-             "This should not be possible! Please report this bug!");
+      _receiver.CloneFrom(*_sender.data);
+      _receiver.required =
+          (_mergeRequirements && _sender.required) || _receiver.required;
 
       ++_numEntries;
     }
@@ -118,111 +133,123 @@ namespace ignition
     /////////////////////////////////////////////////
     /// \brief Use move semantics for a more efficient version of
     /// StandardDataCopy and StandardDataClone
-    template <typename SenderType>
     static void MoveData(
-        const CompositeData::MapOfData::iterator &_receiver,
-        SenderType _sender,
+        CompositeData::DataEntry &_receiver,
+        CompositeData::DataEntry &_sender,
         const bool _mergeRequirements,
         std::size_t &_numEntries,
         std::size_t &/*_numQueries*/)
     {
-      if (!_receiver->second.data)
+      if (_receiver.data)
+      {
+        // Move into the existing instance instead of replacing it, so that no
+        // allocation is needed
+        _receiver.data->Copy(std::move(*_sender.data));
+        _sender.data.reset();
+      }
+      else
+      {
+        _receiver.MoveFrom(_sender);
         ++_numEntries;
+      }
 
-      _receiver->second.data.reset(_sender->second.data.release());
-      _receiver->second.required =
-          _mergeRequirements && _sender->second.required;
+      _receiver.required =
+          _mergeRequirements && _sender.required;
     }
 
     /////////////////////////////////////////////////
-    /// \brief Use move semantics for a more efficient version of
-    /// StandardDataCreate
-    template <typename SenderType>
-    static void MoveDataCreate(
-        CompositeData::MapOfData &_toMap,
-        SenderType _sender,
-        const bool _mergeRequirements,
-        std::size_t &_numEntries)
+    /// \brief Bring the counters of a CompositeData whose data was just moved
+    /// out by MoveData back in line with its entries
+    static void ReleaseMovedData(
+        CompositeData::MapOfData &_map,
+        std::size_t &_numEntries, std::size_t &_numQueries)
     {
-      const bool inserted = _toMap.insert(
-            std::make_pair(
-              _sender->first,
-              CompositeData::DataEntry(
-                std::unique_ptr<Cloneable>(_sender->second.data.release()),
-                _mergeRequirements && _sender->second.required))).second;
-
-      (void)(inserted);
-      assert(inserted &&
-             "Calling MoveDataCreate on a data entry that already exists. This "
-             "should not be possible! Please report this bug!");
+      for (auto &entry : _map)
+        entry.second->queried = false;
 
-      ++_numEntries;
+      _numEntries = 0;
+      _numQueries = 0;
     }
 
     /////////////////////////////////////////////////
-    template <typename SenderType>
+    template <typename SenderEntry>
     using DataTransferFnc = void(*)(
-            const CompositeData::MapOfData::iterator&,
-            SenderType, const bool, std::size_t&, std::size_t&);
+            CompositeData::DataEntry&,
+            SenderEntry&, const bool, std::size_t&, std::size_t&);
 
     /////////////////////////////////////////////////
-    template <typename SenderType>
-    using DataCreateFnc = void(*)(
-            CompositeData::MapOfData&,
-            SenderType, const bool, std::size_t&);
-
-    /////////////////////////////////////////////////
-    template <typename SenderType, typename FromMapType>
+    /// \brief Walk through the sorted maps of two CompositeData objects at
+    /// once, transferring the data of _fromMap into _toMap. Entries that
+    /// _toMap does not have yet are created in _toEntries.
+    template <typename SenderEntry>
     static void CopyMapData(
         std::size_t &_numEntries,
         std::size_t &_numQueries,
+        std::deque<CompositeData::DataEntry,
+                   CompositeDataArena::Allocator<CompositeData::DataEntry>>
+            &_toEntries,
         CompositeData::MapOfData &_toMap,
-        FromMapType _fromMap,
+        const CompositeData::MapOfData &_fromMap,
         const bool _mergeData,
         const bool _mergeRequirements,
-        DataTransferFnc<SenderType> CopyDataFnc,
-        DataTransferFnc<SenderType> CloneDataFnc,
-        DataCreateFnc<SenderType> CreateDataFnc)
+        DataTransferFnc<SenderEntry> CopyDataFnc,
+        DataTransferFnc<SenderEntry> CloneDataFnc)
     {
-      CompositeData::MapOfData::iterator receiver = _toMap.begin();
+      // Copying into an empty CompositeData is the most common case, and it
+      // only ever appends entries
+      if (_toMap.empty())
+        _toMap.reserve(_fromMap.size());
+
+      std::size_t receiver = 0;
       auto sender = _fromMap.begin();
 
       while (_fromMap.end() != sender)
       {
-        if (_toMap.end() == receiver)
+        SenderEntry &senderEntry = *sender->second;
+
+        if (_toMap.size() == receiver || sender->first < _toMap[receiver].first)
         {
-          // If we've reached the end of this CompositeData's map, then we
-          // should just add each remaining entry from sender. We don't have to
-          // worry about conflicts, because this CompositeData cannot already
-          // have any of these types.
-          if (sender->second.data)
+          if (senderEntry.data)
           {
-            CreateDataFnc(_toMap, sender, _mergeRequirements, _numEntries);
+            // The receiving map does not contain an entry that matches this
+            // entry of the sending map, and therefore the entry must be
+            // created.
+            _toEntries.emplace_back();
+            _toMap.emplace(
+                  _toMap.begin() + static_cast<std::ptrdiff_t>(receiver),
+                  sender->first, &_toEntries.back());
+
+            CloneDataFnc(_toEntries.back(), senderEntry, _mergeRequirements,
+                         _numEntries, _numQueries);
+
+            ++receiver;
           }
 
           ++sender;
         }
-        else if (receiver->first == sender->first)
+        else if (_toMap[receiver].first == sender->first)
         {
-          if (sender->second.data)
+          CompositeData::DataEntry &receiverEntry = *_toMap[receiver].second;
+
+          if (senderEntry.data)
           {
             // If the sender has an entry whose key matches this one...
 
-            if (receiver->second.data)
+            if (receiverEntry.data)
             {
               // If we already have an instance, we should copy instead of
               // allocating a clone
-              CopyDataFnc(receiver, sender, _mergeRequirements,
+              CopyDataFnc(receiverEntry, senderEntry, _mergeRequirements,
                           _numEntries, _numQueries);
             }
-            else if (!receiver->second.data)
+            else
             {
-              assert(!receiver->second.queried &&
+              assert(!receiverEntry.queried &&
                      "An entry which was supposed to be empty is marked as "
                      "queried. This should be impossible!");
 
               // If we don't already have an instance, we should clone it.
-              CloneDataFnc(receiver, sender, _mergeRequirements,
+              CloneDataFnc(receiverEntry, senderEntry, _mergeRequirements,
                            _numEntries, _numQueries);
             }
           }
@@ -232,7 +259,8 @@ namespace ignition
 
             if (!_mergeData)
             {
-              RemoveEntryUnlessRequired(receiver, _numEntries, _numQueries);
+              RemoveEntryUnlessRequired(
+                    receiverEntry, _numEntries, _numQueries);
             }
 
             // Note that this data cannot be required by the sender if they do
@@ -243,46 +271,38 @@ namespace ignition
           ++sender;
           ++receiver;
         }
-        else if (receiver->first < sender->first)
+        else
         {
           // If the receiver has some data that the sender does not...
 
           if (!_mergeData)
           {
-            RemoveEntryUnlessRequired(receiver, _numEntries, _numQueries);
+            RemoveEntryUnlessRequired(
+                  *_toMap[receiver].second, _numEntries, _numQueries);
           }
 
           ++receiver;
         }
-        else
-        {
-          if (sender->second.data)
-          {
-            // If the receiver has a higher key value, then the receiving map
-            // does not contain an entry that matches this entry of the sending
-            // map, and therefore the entry must be created.
-            CreateDataFnc(_toMap, sender, _mergeRequirements, _numEntries);
-          }
-
-          ++sender;
-        }
       }
 
       if (!_mergeData)
       {
         // Remove any remaining data structures in the receiver which do not
         // correspond to any entries that were in the sender.
-        while (_toMap.end() != receiver)
+        for (; receiver < _toMap.size(); ++receiver)
         {
-          RemoveEntryUnlessRequired(receiver, _numEntries, _numQueries);
-          ++receiver;
+          RemoveEntryUnlessRequired(
+                *_toMap[receiver].second, _numEntries, _numQueries);
         }
       }
     }
 
     /////////////////////////////////////////////////
     CompositeData::CompositeData()
-      : numEntries(0),
+      : dataEntries(CompositeDataArena::Allocator<DataEntry>(
+            CompositeDataArena::Current())),
+        dataMap(MapOfData::allocator_type(CompositeDataArena::Current())),
+        numEntries(0),
         numQueries(0)
     {
       // Do nothing
@@ -297,6 +317,21 @@ namespace ignition
       // Do nothing
     }
 
+    /////////////////////////////////////////////////
+    CompositeData::TypeId CompositeData::RegisterDataType(
+        const std::string &_label)
+    {
+      TypeRegistry &registry = Registry();
+      std::lock_guard<std::mutex> lock(registry.mutex);
+
+      const auto inserted = registry.ids.insert(
+            std::make_pair(_label, registry.labels.size()));
+      if (inserted.second)
+        registry.labels.push_back(_label);
+
+      return inserted.first->second;
+    }
+
     /////////////////////////////////////////////////
     std::size_t CompositeData::EntryCount() const
     {
@@ -321,7 +356,7 @@ namespace ignition
       numQueries = 0;
 
       for (auto &entry : dataMap)
-        entry.second.queried = false;
+        entry.second->queried = false;
     }
 
     /////////////////////////////////////////////////
@@ -330,15 +365,18 @@ namespace ignition
       if (EntryCount() == 0)
         return std::set<std::string>();
 
-      std::set<std::string> entries;
+      std::vector<TypeId> ids;
+      ids.reserve(this->numEntries);
 
       for (const auto &entry : dataMap)
       {
-        if (entry.second.data)
-          entries.insert(entries.end(), entry.first);
+        if (entry.second->data)
+          ids.push_back(entry.first);
       }
 
-      return entries;
+      // The map is sorted by TypeId, so the alphabetical order is only
+      // produced here, when the labels are requested
+      return LabelsOf(ids);
     }
 
     /////////////////////////////////////////////////
@@ -347,15 +385,16 @@ namespace ignition
       if (UnqueriedEntryCount() == 0)
         return std::set<std::string>();
 
-      std::set<std::string> unqueried;
+      std::vector<TypeId> ids;
+      ids.reserve(this->UnqueriedEntryCount());
 
       for (const auto &entry : dataMap)
       {
-        if (entry.second.data && !entry.second.queried)
-          unqueried.insert(unqueried.end(), entry.first);
+        if (entry.second->data && !entry.second->queried)
+          ids.push_back(entry.first);
       }
 
-      return unqueried;
+      return LabelsOf(ids);
     }
 
     /////////////////////////////////////////////////
@@ -363,14 +402,12 @@ namespace ignition
         const CompositeData &_other,
         const bool _mergeRequirements)
     {
-      using SenderType = CompositeData::MapOfData::const_iterator;
-      CopyMapData<SenderType, const CompositeData::MapOfData&>(
+      CopyMapData<const DataEntry>(
             numEntries, numQueries,
-            this->dataMap, _other.dataMap,
+            this->dataEntries, this->dataMap, _other.dataMap,
             false, _mergeRequirements,
-            &StandardDataCopy<SenderType>,
-            &StandardDataClone<SenderType>,
-            &StandardDataCreate<SenderType>);
+            &StandardDataCopy,
+            &StandardDataClone);
 
       return *this;
     }
@@ -380,14 +417,18 @@ namespace ignition
         CompositeData &&_other,
         const bool _mergeRequirements)
     {
-      using SenderType = CompositeData::MapOfData::iterator;
-      CopyMapData<SenderType, CompositeData::MapOfData&&>(
+      // Moving the data out of _other would destroy it
+      if (this == &_other)
+        return *this;
+
+      CopyMapData<DataEntry>(
             numEntries, numQueries,
-            this->dataMap, std::move(_other.dataMap),
+            this->dataEntries, this->dataMap, _other.dataMap,
             false, _mergeRequirements,
-            &MoveData<SenderType>,
-            &MoveData<SenderType>,
-            &MoveDataCreate<SenderType>);
+            &MoveData,
+            &MoveData);
+
+      ReleaseMovedData(_other.dataMap, _other.numEntries, _other.numQueries);
 
       return *this;
     }
@@ -397,14 +438,12 @@ namespace ignition
         const CompositeData &_other,
         const bool _mergeRequirements)
     {
-      using SenderType = CompositeData::MapOfData::const_iterator;
-      CopyMapData<SenderType, const CompositeData::MapOfData&>(
+      CopyMapData<const DataEntry>(
             numEntries, numQueries,
-            this->dataMap, _other.dataMap,
+            this->dataEntries, this->dataMap, _other.dataMap,
             true, _mergeRequirements,
-            &StandardDataCopy<SenderType>,
-            &StandardDataClone<SenderType>,
-            &StandardDataCreate<SenderType>);
+            &StandardDataCopy,
+            &StandardDataClone);
 
       return *this;
     }
@@ -414,14 +453,18 @@ namespace ignition
         CompositeData &&_other,
         const bool _mergeRequirements)
     {
-      using SenderType = CompositeData::MapOfData::iterator;
-      CopyMapData<SenderType, CompositeData::MapOfData&&>(
+      // Moving the data out of _other would destroy it
+      if (this == &_other)
+        return *this;
+
+      CopyMapData<DataEntry>(
             numEntries, numQueries,
-            this->dataMap, std::move(_other.dataMap),
+            this->dataEntries, this->dataMap, _other.dataMap,
             true, _mergeRequirements,
-            &MoveData<SenderType>,
-            &MoveData<SenderType>,
-            &MoveDataCreate<SenderType>);
+            &MoveData,
+            &MoveData);
+
+      ReleaseMovedData(_other.dataMap, _other.numEntries, _other.numQueries);
 
       return *this;
     }
@@ -454,21 +497,56 @@ namespace ignition
 
     /////////////////////////////////////////////////
     CompositeData::DataEntry::DataEntry()
-      : required(false),
+      : data(nullptr, CloneableDeleter{false}),
+        required(false),
         queried(false)
     {
       // Do nothing
     }
 
     /////////////////////////////////////////////////
-    CompositeData::DataEntry::DataEntry(
-        std::unique_ptr<Cloneable> &&_data,
-        bool _required)
-      : data(std::move(_data)),
-        required(_required),
-        queried(false)
+    void CompositeData::DataEntry::CloneFrom(const Cloneable &_other)
     {
-      // Do nothing
+      assert(!this->data &&
+             "Calling CloneFrom on a data entry that already has data. This "
+             "should not be possible! Please report this bug!");
+
+      if (Cloneable *clone = _other.CloneInto(this->buffer, InlineDataSize))
+        this->data = DataPtr(clone, CloneableDeleter{true});
+      else
+        this->data = DataPtr(_other.Clone().release(), CloneableDeleter{false});
+    }
+
+    /////////////////////////////////////////////////
+    void CompositeData::DataEntry::MoveFrom(DataEntry &_other)
+    {
+      assert(!this->data &&
+             "Calling MoveFrom on a data entry that already has data. This "
+             "should not be possible! Please report this bug!");
+
+      if (!_other.data)
+        return;
+
+      if (!_other.data.get_deleter().inlined)
+      {
+        // The data is on the heap, so it can change owner without being moved
+        this->data = std::move(_other.data);
+        return;
+      }
+
+      // Inline data fits in the buffer of any entry, but a type that only
+      // overrides CloneInto(~) cannot be moved into it
+      if (Cloneable *moved =
+              _other.data->MoveInto(this->buffer, InlineDataSize))
+      {
+        this->data = DataPtr(moved, CloneableDeleter{true});
+      }
+      else
+      {
+        this->data =
+            DataPtr(_other.data->Clone().release(), CloneableDeleter{false});
+      }
+      _other.data.reset();
     }
   }
 }
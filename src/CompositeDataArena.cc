@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <vector>
+
+#include "ignition/physics/CompositeDataArena.hh"
+
+namespace ignition
+{
+  namespace physics
+  {
+    /////////////////////////////////////////////////
+    /// \brief The arena that CompositeData objects on this thread allocate
+    /// from. nullptr means the heap.
+    static thread_local CompositeDataArena *tCurrentArena = nullptr;
+
+    /////////////////////////////////////////////////
+    class CompositeDataArena::Resource
+    {
+      /////////////////////////////////////////////////
+      public: explicit Resource(const std::size_t _initialSize)
+        : capacity(_initialSize),
+          block(new unsigned char[_initialSize])
+      {
+        // Do nothing
+      }
+
+      /////////////////////////////////////////////////
+      public: void *Allocate(
+          const std::size_t _bytes, const std::size_t _alignment)
+      {
+        ++this->outstanding;
+        // Include the worst case padding, so that the block never ends up too
+        // small after it is resized
+        this->used += _bytes + _alignment;
+
+        void *memory = this->block.get() + this->offset;
+        std::size_t space = this->capacity - this->offset;
+        if (std::align(_alignment, _bytes, memory, space))
+        {
+          this->offset = this->capacity - space + _bytes;
+          return memory;
+        }
+
+        // The block is full, so this cycle overflows to the heap
+        this->overflow.emplace_back(new unsigned char[_bytes + _alignment]);
+        memory = this->overflow.back().get();
+        space = _bytes + _alignment;
+        return std::align(_alignment, _bytes, memory, space);
+      }
+
+      /////////////////////////////////////////////////
+      public: void Release()
+      {
+        this->overflow.clear();
+
+        // If the last cycle did not fit in the block of the arena, then make
+        // the block large enough for it. Otherwise every cycle would allocate
+        // the overflow from the heap again, which defeats the arena.
+        if (this->used > this->capacity)
+        {
+          this->capacity = this->used;
+          this->block.reset(new unsigned char[this->capacity]);
+        }
+
+        this->offset = 0;
+        this->used = 0;
+      }
+
+      /// \brief Size of block, in bytes
+      private: std::size_t capacity;
+
+      /// \brief Number of bytes of block that have been handed out
+      private: std::size_t offset = 0;
+
+      /// \brief Number of bytes that were allocated since the last Release()
+      private: std::size_t used = 0;
+
+      /// \brief Memory that the arena hands out first
+      private: std::unique_ptr<unsigned char[]> block;
+
+      /// \brief Memory that was allocated from the heap because block was
+      /// full. It is freed by Release().
+      private: std::vector<std::unique_ptr<unsigned char[]>> overflow;
+
+      /// \brief Number of allocations that have not been returned. This is
+      /// atomic because a CompositeData may be destroyed by a different thread
+      /// than the one that created it.
+      public: std::atomic<std::size_t> outstanding{0};
+    };
+
+    /////////////////////////////////////////////////
+    CompositeDataArena::CompositeDataArena(const std::size_t _initialSize)
+      : resource(new Resource(_initialSize))
+    {
+      // Do nothing
+    }
+
+    /////////////////////////////////////////////////
+    CompositeDataArena::~CompositeDataArena()
+    {
+      assert(this->resource->outstanding == 0 &&
+             "A CompositeDataArena was destroyed while a CompositeData was "
+             "still using it!");
+    }
+
+    /////////////////////////////////////////////////
+    bool CompositeDataArena::Reset()
+    {
+      if (this->resource->outstanding != 0)
+        return false;
+
+      this->resource->Release();
+      return true;
+    }
+
+    /////////////////////////////////////////////////
+    std::size_t CompositeDataArena::OutstandingAllocations() const
+    {
+      return this->resource->outstanding;
+    }
+
+    /////////////////////////////////////////////////
+    CompositeDataArena *CompositeDataArena::Current()
+    {
+      return tCurrentArena;
+    }
+
+    /////////////////////////////////////////////////
+    void *CompositeDataArena::Allocate(
+        const std::size_t _bytes, const std::size_t _alignment)
+    {
+      return this->resource->Allocate(_bytes, _alignment);
+    }
+
+    /////////////////////////////////////////////////
+    void CompositeDataArena::Deallocate(void * /*_memory*/)
+    {
+      // Nothing is released until Reset()
+      --this->resource->outstanding;
+    }
+
+    /////////////////////////////////////////////////
+    CompositeDataArena::Scope::Scope(CompositeDataArena &_arena)
+      : previous(tCurrentArena)
+    {
+      tCurrentArena = &_arena;
+    }
+
+    /////////////////////////////////////////////////
+    CompositeDataArena::Scope::~Scope()
+    {
+      tCurrentArena = this->previous;
+    }
+  }
+}
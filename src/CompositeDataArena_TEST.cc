@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+
+#include <gtest/gtest.h>
+
+#include <optional>
+
+#include "ignition/physics/CompositeDataArena.hh"
+#include "utils/TestDataTypes.hh"
+
+using ignition::physics::CompositeData;
+using ignition::physics::CompositeDataArena;
+
+/////////////////////////////////////////////////
+TEST(CompositeDataArena_TEST, OptIn)
+{
+  // Without a scope, CompositeData allocates from the heap
+  EXPECT_EQ(nullptr, CompositeDataArena::Current());
+
+  CompositeDataArena arena;
+  {
+    CompositeDataArena::Scope scope(arena);
+    EXPECT_EQ(&arena, CompositeDataArena::Current());
+
+    CompositeDataArena nestedArena;
+    {
+      CompositeDataArena::Scope nestedScope(nestedArena);
+      CompositeData data = CreateSomeData<StringData, DoubleData>();
+      EXPECT_NE(0u, nestedArena.OutstandingAllocations());
+      EXPECT_EQ(0u, arena.OutstandingAllocations());
+    }
+
+    EXPECT_EQ(0u, nestedArena.OutstandingAllocations());
+    EXPECT_TRUE(nestedArena.Reset());
+    EXPECT_EQ(&arena, CompositeDataArena::Current());
+  }
+
+  EXPECT_EQ(nullptr, CompositeDataArena::Current());
+
+  // A CompositeData that was created outside of any scope does not use the
+  // arena
+  CompositeData heapData = CreateSomeData<StringData, DoubleData>();
+  EXPECT_EQ(0u, arena.OutstandingAllocations());
+}
+
+/////////////////////////////////////////////////
+TEST(CompositeDataArena_TEST, Reset)
+{
+  CompositeDataArena arena(256);
+  CompositeData heapData;
+
+  for (std::size_t step = 0; step < 10; ++step)
+  {
+    std::optional<CompositeData> stepData;
+    {
+      CompositeDataArena::Scope scope(arena);
+      stepData = CreateSomeData<
+          StringData, DoubleData, IntData, BoolData, CharData>();
+      stepData->Get<StringData>().myString = "step";
+    }
+
+    EXPECT_NE(0u, arena.OutstandingAllocations());
+
+    // The arena cannot be reset while its data is still in use
+    EXPECT_FALSE(arena.Reset());
+    EXPECT_EQ("step", stepData->Get<StringData>().myString);
+
+    // Data copied out of the arena allocates from the heap, so it stays valid
+    // after the arena is reset
+    heapData = *stepData;
+
+    stepData.reset();
+    EXPECT_EQ(0u, arena.OutstandingAllocations());
+    EXPECT_TRUE(arena.Reset());
+  }
+
+  EXPECT_EQ(5u, heapData.EntryCount());
+  EXPECT_EQ("step", heapData.Get<StringData>().myString);
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
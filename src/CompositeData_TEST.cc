@@ -17,6 +17,9 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <utility>
+
 #include "ignition/physics/CompositeData.hh"
 #include "utils/TestDataTypes.hh"
 
@@ -156,12 +159,11 @@ TEST(CompositeData_TEST, CopyMoveOperators)
 /////////////////////////////////////////////////
 struct zzzzzzzzz
 {
-  // With the Itanium ABI the typeid(~).name() of this class will be 9zzzzzzzzz
-  // In MSVC the typeid(~).name() of this class will be "class zzzzzzzzz"
-
-  // These properties should effectively guarantee that this class is always the
-  // last entry in a CompositeData instance, which is a useful property for
-  // achieving complete implementation line coverage in the next unit test.
+  // Entries are sorted by TypeId, and TypeIds are handed out in the order that
+  // data types are first used. This class is not used before the next unit
+  // test, so it is always the last entry in a CompositeData instance, which is
+  // a useful property for achieving complete implementation line coverage in
+  // that test.
 };
 
 /////////////////////////////////////////////////
@@ -215,6 +217,49 @@ TEST(CompositeData_TEST, CopyFunction)
   EXPECT_TRUE(zzzData.Has<FloatData>());
 }
 
+/////////////////////////////////////////////////
+struct LargeData
+{
+  // Too large to be stored inline in a data entry
+  std::array<double, 32> values;
+};
+
+/////////////////////////////////////////////////
+TEST(CompositeData_TEST, InlineAndHeapStorage)
+{
+  ignition::physics::CompositeData data;
+  data.Get<DoubleData>().myDouble = 4.5;
+  data.Get<StringData>().myString = "inline";
+  data.Get<LargeData>().values.fill(7.0);
+
+  // Copying must clone both kinds of entries
+  ignition::physics::CompositeData copied(data);
+  EXPECT_EQ(3u, copied.EntryCount());
+  EXPECT_DOUBLE_EQ(4.5, copied.Get<DoubleData>().myDouble);
+  EXPECT_EQ("inline", copied.Get<StringData>().myString);
+  EXPECT_DOUBLE_EQ(7.0, copied.Get<LargeData>().values[31]);
+
+  // The copy must be independent of the original
+  copied.Get<DoubleData>().myDouble = 0.0;
+  copied.Get<LargeData>().values.fill(1.0);
+  EXPECT_DOUBLE_EQ(4.5, data.Get<DoubleData>().myDouble);
+  EXPECT_DOUBLE_EQ(7.0, data.Get<LargeData>().values[0]);
+
+  // Moving must carry both kinds of entries over
+  const LargeData *large = data.Query<LargeData>();
+  ignition::physics::CompositeData moved(std::move(data));
+  EXPECT_DOUBLE_EQ(4.5, moved.Get<DoubleData>().myDouble);
+  EXPECT_EQ("inline", moved.Get<StringData>().myString);
+
+  // Heap-allocated data changes owner instead of being moved
+  EXPECT_EQ(large, moved.Query<LargeData>());
+
+  // Moving into existing entries reuses them
+  moved = std::move(copied);
+  EXPECT_DOUBLE_EQ(0.0, moved.Get<DoubleData>().myDouble);
+  EXPECT_DOUBLE_EQ(1.0, moved.Get<LargeData>().values[0]);
+}
+
 /////////////////////////////////////////////////
 TEST(CompositeData_TEST, CopyFunctionWithRequirements)
 {
@@ -580,6 +625,25 @@ TEST(CompositeData_TEST, Queries)
   EXPECT_NE(0u, all.count(typeid(BoolData).name()));
 }
 
+/////////////////////////////////////////////////
+TEST(CompositeData_TEST, TypeIds)
+{
+  using ignition::physics::CompositeData;
+
+  // The ID of a type is the same every time it is requested, and it matches
+  // the ID that is registered for the label of the type
+  const CompositeData::TypeId stringId = CompositeData::TypeIdOf<StringData>();
+  EXPECT_EQ(stringId, CompositeData::TypeIdOf<StringData>());
+  EXPECT_EQ(stringId,
+            CompositeData::RegisterDataType(typeid(StringData).name()));
+
+  // Different types get different IDs
+  EXPECT_NE(stringId, CompositeData::TypeIdOf<DoubleData>());
+  EXPECT_NE(stringId, CompositeData::TypeIdOf<IntData>());
+  EXPECT_NE(CompositeData::TypeIdOf<DoubleData>(),
+            CompositeData::TypeIdOf<IntData>());
+}
+
 /////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include <ignition/physics/RequestEngine.hh>
 #include <ignition/physics/Entity.hh>
 
@@ -61,6 +63,29 @@ class SecondLinkMockFeature : public virtual Feature
   };
 };
 
+/////////////////////////////////////////////////
+class NameLookupMockFeature : public virtual Feature
+{
+  public: template <typename FeatureType, typename Pimpl>
+  class Engine : public virtual Feature::Engine<FeatureType, Pimpl>
+  {
+    public: template <typename LookupT>
+    Identity MockLookUpWorld(
+        const detail::Implementation &_impl,
+        const std::string &_name,
+        const LookupT &_lookup) const
+    {
+      return this->IdentityByName(
+          _impl, detail::EntityHandleCache::Kind::World, _name, _lookup);
+    }
+
+    public: void MockRemoveWorld(const detail::Implementation &_impl) const
+    {
+      this->ClearIdentitiesByName(_impl);
+    }
+  };
+};
+
 /////////////////////////////////////////////////
 TEST(Feature_TEST, ConflictsWith)
 {
@@ -115,6 +140,138 @@ TEST(Feature_TEST, SimpleMock)
   EXPECT_EQ(3u, missing.size());
 }
 
+/////////////////////////////////////////////////
+TEST(Feature_TEST, NonOwningIdentity)
+{
+  class SlotImplementation : detail::Implementation
+  {
+    public: Identity Generate(std::size_t _id, detail::ReferenceSlot &_slot)
+    {
+      return this->Implementation::GenerateIdentity(_id, _slot);
+    }
+
+    public: int *Resolve(const Identity &_identity) const
+    {
+      return this->ReferenceInterface<int>(_identity);
+    }
+  };
+
+  SlotImplementation implementation;
+  detail::ReferenceSlots slots;
+
+  int first = 1;
+  detail::ReferenceSlot &firstSlot = slots.Acquire(&first);
+  const Identity firstID = implementation.Generate(3, firstSlot);
+  const Identity firstCopy = firstID;
+
+  EXPECT_EQ(3u, firstCopy.id);
+  EXPECT_EQ(nullptr, firstCopy.ref);
+  EXPECT_EQ(&first, implementation.Resolve(firstID));
+  EXPECT_EQ(&first, implementation.Resolve(firstCopy));
+
+  // Once the object is removed, its identities no longer resolve, even after
+  // its slot is given to another object
+  slots.Release(firstSlot);
+  EXPECT_EQ(nullptr, implementation.Resolve(firstID));
+
+  int second = 2;
+  detail::ReferenceSlot &secondSlot = slots.Acquire(&second);
+  EXPECT_EQ(&firstSlot, &secondSlot);
+  const Identity secondID = implementation.Generate(4, secondSlot);
+  EXPECT_EQ(nullptr, implementation.Resolve(firstCopy));
+  EXPECT_EQ(&second, implementation.Resolve(secondID));
+}
+
+/////////////////////////////////////////////////
+TEST(Feature_TEST, EntityHandleCache)
+{
+  using Kind = detail::EntityHandleCache::Kind;
+
+  class CountingImplementation : public detail::Implementation
+  {
+    public: Identity Generate(std::size_t _id) const
+    {
+      return this->Implementation::GenerateIdentity(_id, nullptr);
+    }
+
+    public: Identity Generate(
+        std::size_t _id, const detail::ReferenceSlot &_slot) const
+    {
+      return this->Implementation::GenerateIdentity(_id, _slot);
+    }
+
+    public: Identity LookUp(const std::string &_name)
+    {
+      ++this->lookups;
+      if (_name == "missing")
+        return this->GenerateInvalidId();
+
+      return this->Generate(this->nextID++);
+    }
+
+    public: int lookups = 0;
+    public: std::size_t nextID = 1;
+
+    public: std::shared_ptr<
+        Entity<FeaturePolicy3d, FeatureList<NameLookupMockFeature>>::Pimpl>
+        pimpl;
+  };
+
+  // The cache keeps apart entities of different kinds and parents that have
+  // the same name
+  detail::EntityHandleCache cache;
+  CountingImplementation implementation;
+  EXPECT_FALSE(cache.Find(Kind::Model, 1, "box"));
+  cache.Insert(Kind::Model, 1, "box", implementation.Generate(5));
+  ASSERT_TRUE(cache.Find(Kind::Model, 1, "box"));
+  EXPECT_EQ(5u, cache.Find(Kind::Model, 1, "box")->id);
+  EXPECT_FALSE(cache.Find(Kind::Link, 1, "box"));
+  EXPECT_FALSE(cache.Find(Kind::Model, 2, "box"));
+  EXPECT_EQ(1u, cache.Size());
+  cache.Clear();
+  EXPECT_EQ(0u, cache.Size());
+  EXPECT_FALSE(cache.Find(Kind::Model, 1, "box"));
+
+  // Identities whose object was removed are not returned, and storing the
+  // lookup again replaces them
+  detail::ReferenceSlots slots;
+  int object = 0;
+  detail::ReferenceSlot &slot = slots.Acquire(&object);
+  cache.Insert(Kind::Link, 1, "arm", implementation.Generate(7, slot));
+  ASSERT_TRUE(cache.Find(Kind::Link, 1, "arm"));
+  slots.Release(slot);
+  EXPECT_FALSE(cache.Find(Kind::Link, 1, "arm"));
+  cache.Insert(Kind::Link, 1, "arm", implementation.Generate(8));
+  ASSERT_TRUE(cache.Find(Kind::Link, 1, "arm"));
+  EXPECT_EQ(8u, cache.Find(Kind::Link, 1, "arm")->id);
+  EXPECT_EQ(1u, cache.Size());
+  cache.Clear();
+
+  // Entities only ask the engine the first time that a name is looked up
+  Engine3dPtr<FeatureList<NameLookupMockFeature>> engine(
+      implementation.pimpl, implementation.Generate(0));
+  const auto lookUp = [&](const std::string &_name)
+  {
+    return engine->MockLookUpWorld(implementation, _name,
+        [&]() { return implementation.LookUp(_name); });
+  };
+
+  const std::size_t worldID = lookUp("world").id;
+  EXPECT_EQ(1, implementation.lookups);
+  EXPECT_EQ(worldID, lookUp("world").id);
+  EXPECT_EQ(1, implementation.lookups);
+
+  // Failed lookups are not remembered
+  EXPECT_FALSE(lookUp("missing"));
+  EXPECT_FALSE(lookUp("missing"));
+  EXPECT_EQ(3, implementation.lookups);
+
+  // Removing entities makes the engine answer again
+  engine->MockRemoveWorld(implementation);
+  EXPECT_NE(worldID, lookUp("world").id);
+  EXPECT_EQ(4, implementation.lookups);
+}
+
 int main(int argc, char *argv[])
 {
   ::testing::InitGoogleTest(&argc, argv);
@@ -15,6 +15,10 @@
  *
 */
 
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+
 #include <ignition/physics/Entity.hh>
 
 namespace ignition
@@ -23,6 +27,16 @@ namespace ignition
   {
     namespace detail
     {
+      /////////////////////////////////////////////////
+      Implementation::Implementation()
+        : entityHandles(std::make_unique<EntityHandleCache>())
+      {
+        // Do nothing
+      }
+
+      /////////////////////////////////////////////////
+      Implementation::~Implementation() = default;
+
       /////////////////////////////////////////////////
       Identity Implementation::GenerateIdentity(
           std::size_t _id,
@@ -31,6 +45,14 @@ namespace ignition
         return Identity(_id, _ref);
       }
 
+      /////////////////////////////////////////////////
+      Identity Implementation::GenerateIdentity(
+          std::size_t _id,
+          const ReferenceSlot &_slot) const
+      {
+        return Identity(_id, _slot);
+      }
+
       /////////////////////////////////////////////////
       Identity Implementation::GenerateInvalidId() const
       {
@@ -43,6 +65,60 @@ namespace ignition
       {
         return _identity.ref;
       }
+
+      /////////////////////////////////////////////////
+      std::optional<Identity> EntityHandleCache::Find(
+          const Kind _kind,
+          const std::size_t _parentID,
+          const std::string &_name) const
+      {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        const auto it = this->identities.find(
+            std::tuple<Kind, std::size_t, const std::string &>(
+              _kind, _parentID, _name));
+
+        if (it == this->identities.end())
+          return std::nullopt;
+
+        // The object of a non-owning identity may have been removed without
+        // going through the entity API. The stale identity is left in place
+        // until the lookup is stored again.
+        const Identity &identity = it->second;
+        if (identity.slot && identity.slot->generation != identity.generation)
+          return std::nullopt;
+
+        return identity;
+      }
+
+      /////////////////////////////////////////////////
+      void EntityHandleCache::Insert(
+          const Kind _kind,
+          const std::size_t _parentID,
+          const std::string &_name,
+          const Identity &_identity)
+      {
+        std::unique_lock<std::shared_mutex> lock(this->mutex);
+        Key key(_kind, _parentID, _name);
+        const auto it = this->identities.find(key);
+        if (it != this->identities.end())
+          this->identities.erase(it);
+
+        this->identities.emplace(std::move(key), _identity);
+      }
+
+      /////////////////////////////////////////////////
+      void EntityHandleCache::Clear()
+      {
+        std::unique_lock<std::shared_mutex> lock(this->mutex);
+        this->identities.clear();
+      }
+
+      /////////////////////////////////////////////////
+      std::size_t EntityHandleCache::Size() const
+      {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        return this->identities.size();
+      }
     }
 
     /////////////////////////////////////////////////
@@ -60,7 +136,9 @@ namespace ignition
     /////////////////////////////////////////////////
     Identity::Identity()
       : id(INVALID_ENTITY_ID),
-        ref(nullptr)
+        ref(nullptr),
+        slot(nullptr),
+        generation(0)
     {
       // Do nothing
     }
@@ -70,7 +148,21 @@ namespace ignition
         std::size_t _id,
         const std::shared_ptr<void> &_ref)
       : id(_id),
-        ref(_ref)
+        ref(_ref),
+        slot(nullptr),
+        generation(0)
+    {
+      // Do nothing
+    }
+
+    /////////////////////////////////////////////////
+    Identity::Identity(
+        std::size_t _id,
+        const detail::ReferenceSlot &_slot)
+      : id(_id),
+        ref(nullptr),
+        slot(&_slot),
+        generation(_slot.generation)
     {
       // Do nothing
     }
@@ -0,0 +1,156 @@
+#include <benchmark/benchmark.h>
+
+#include <utility>
+
+#include "ignition/physics/CompositeDataArena.hh"
+#include "utils/TestDataTypes.hh"
+
+std::size_t gNumTests = 10000;
+
+// Small data types, like the ones that are passed through a simulation step,
+// which can be stored inline in a CompositeData entry
+ignition::physics::CompositeData CreateSmallTestData()
+{
+  return CreateSomeData<DoubleData, IntData, FloatData, BoolData, CharData>();
+}
+
+// Mix of small data types and data types that manage their own memory
+ignition::physics::CompositeData CreateMixedTestData()
+{
+  return CreateSomeData<StringData, DoubleData, IntData,
+      FloatData, VectorDoubleData, BoolData, CharData>();
+}
+
+using CreateFnc = ignition::physics::CompositeData(*)();
+
+// Copy into a CompositeData that has no entries yet, so that every entry must
+// be cloned
+// NOLINTNEXTLINE
+void BM_CopyToEmpty(benchmark::State& _st, CreateFnc _create)
+{
+  const std::size_t numTests = _st.range(0);
+  const ignition::physics::CompositeData source = _create();
+
+  for (auto _ : _st)
+  {
+    for (std::size_t i = 0; i < numTests; ++i)
+    {
+      ignition::physics::CompositeData copy(source);
+      benchmark::DoNotOptimize(copy);
+    }
+  }
+}
+
+// Same as BM_CopyToEmpty, but the copies allocate from an arena which is
+// reset after each batch, like it would be at the end of a simulation step
+// NOLINTNEXTLINE
+void BM_CopyToEmptyInArena(benchmark::State& _st, CreateFnc _create)
+{
+  const std::size_t numTests = _st.range(0);
+  const ignition::physics::CompositeData source = _create();
+  ignition::physics::CompositeDataArena arena;
+
+  for (auto _ : _st)
+  {
+    {
+      ignition::physics::CompositeDataArena::Scope scope(arena);
+      for (std::size_t i = 0; i < numTests; ++i)
+      {
+        ignition::physics::CompositeData copy(source);
+        benchmark::DoNotOptimize(copy);
+      }
+    }
+    arena.Reset();
+  }
+}
+
+// Copy into a CompositeData that already has instances of every entry
+// NOLINTNEXTLINE
+void BM_CopyToExisting(benchmark::State& _st, CreateFnc _create)
+{
+  const std::size_t numTests = _st.range(0);
+  const ignition::physics::CompositeData source = _create();
+  ignition::physics::CompositeData copy = _create();
+
+  for (auto _ : _st)
+  {
+    for (std::size_t i = 0; i < numTests; ++i)
+    {
+      copy.Copy(source);
+      benchmark::DoNotOptimize(copy);
+    }
+  }
+}
+
+// Merge into a CompositeData that has no entries yet
+// NOLINTNEXTLINE
+void BM_MergeToEmpty(benchmark::State& _st, CreateFnc _create)
+{
+  const std::size_t numTests = _st.range(0);
+  const ignition::physics::CompositeData source = _create();
+
+  for (auto _ : _st)
+  {
+    for (std::size_t i = 0; i < numTests; ++i)
+    {
+      ignition::physics::CompositeData merged;
+      merged.Merge(source);
+      benchmark::DoNotOptimize(merged);
+    }
+  }
+}
+
+// Move a whole CompositeData into a new one
+// NOLINTNEXTLINE
+void BM_Move(benchmark::State& _st, CreateFnc _create)
+{
+  const std::size_t numTests = _st.range(0);
+  ignition::physics::CompositeData source = _create();
+
+  for (auto _ : _st)
+  {
+    for (std::size_t i = 0; i < numTests; ++i)
+    {
+      ignition::physics::CompositeData moved(std::move(source));
+      source = std::move(moved);
+      benchmark::DoNotOptimize(source);
+    }
+  }
+}
+
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_CopyToEmpty, Small, &CreateSmallTestData)
+    ->Arg(gNumTests);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_CopyToEmpty, Mixed, &CreateMixedTestData)
+    ->Arg(gNumTests);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_CopyToEmptyInArena, Small, &CreateSmallTestData)
+    ->Arg(gNumTests);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_CopyToEmptyInArena, Mixed, &CreateMixedTestData)
+    ->Arg(gNumTests);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_CopyToExisting, Small, &CreateSmallTestData)
+    ->Arg(gNumTests);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_CopyToExisting, Mixed, &CreateMixedTestData)
+    ->Arg(gNumTests);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_MergeToEmpty, Small, &CreateSmallTestData)
+    ->Arg(gNumTests);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_MergeToEmpty, Mixed, &CreateMixedTestData)
+    ->Arg(gNumTests);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_Move, Small, &CreateSmallTestData)
+    ->Arg(gNumTests);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_Move, Mixed, &CreateMixedTestData)
+    ->Arg(gNumTests);
+
+// OSX needs the semicolon, Ubuntu complains that there's an extra ';'
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+BENCHMARK_MAIN();
+#pragma GCC diagnostic pop
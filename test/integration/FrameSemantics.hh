@@ -21,6 +21,7 @@
 #include <gtest/gtest.h>
 #include <cmath>
 #include <string>
+#include <vector>
 
 #include <ignition/plugin/Loader.hh>
 #include <ignition/plugin/PluginPtr.hh>
@@ -877,4 +878,103 @@ void TestRelativeFrameData(const double _tolerance, const std::string &_suffix)
   EXPECT_NEAR(C_O.angularAcceleration[2], 0.0, _tolerance);
 }
 
+/////////////////////////////////////////////////
+template <typename PolicyT>
+void TestResolveArrays(const double _tolerance, const std::string &_suffix)
+{
+  using Scalar = typename PolicyT::Scalar;
+  constexpr std::size_t Dim = PolicyT::Dim;
+
+  // Instantiate an engine that provides Frame Semantics.
+  auto fs =
+      ignition::physics::RequestEngine<PolicyT, mock::MockFrameSemanticsList>
+        ::From(LoadMockFrameSemanticsPlugin(_suffix));
+
+  using Pose = Pose<Scalar, Dim>;
+  using LinearVector = LinearVector<Scalar, Dim>;
+  using RelativeFrameData = RelativeFrameData<Scalar, Dim>;
+  using RelativePose = ignition::physics::RelativePose<Scalar, Dim>;
+  using RelativePosition = ignition::physics::RelativePosition<Scalar, Dim>;
+  using RelativeForce = ignition::physics::RelativeForce<Scalar, Dim>;
+
+  const FrameID World = FrameID::World();
+  const FrameID A = *fs->CreateLink("A", RandomFrameData<Scalar, Dim>());
+  const FrameID B = *fs->CreateLink("B", RandomFrameData<Scalar, Dim>());
+  const FrameID C = *fs->CreateLink("C", RandomFrameData<Scalar, Dim>());
+
+  // Runs of quantities in different parent frames, including the frames that
+  // they are resolved against
+  const FrameID parents[] = {A, A, A, B, B, World, A, C, C, B};
+  constexpr std::size_t count = sizeof(parents)/sizeof(FrameID);
+
+  std::vector<RelativePosition> positions;
+  std::vector<RelativeForce> forces;
+  std::vector<RelativePose> poses;
+  std::vector<RelativeFrameData> frames;
+  for (const FrameID &parent : parents)
+  {
+    positions.emplace_back(parent, RandomVector<LinearVector>(10.0));
+    forces.emplace_back(parent, RandomVector<LinearVector>(10.0));
+    poses.emplace_back(parent, RandomFrameData<Scalar, Dim>().pose);
+    frames.emplace_back(parent, RandomFrameData<Scalar, Dim>());
+  }
+
+  // Each array gives the same values as resolving its quantities one by one
+  const FrameID targets[][2] = {
+    {World, World}, {C, C}, {C, World}, {World, B}, {B, C}};
+  for (const auto &target : targets)
+  {
+    const FrameID &relativeTo = target[0];
+    const FrameID &inCoordinatesOf = target[1];
+
+    std::vector<LinearVector> resolvedPositions(count);
+    fs->Resolve(positions.data(), count, resolvedPositions.data(),
+                relativeTo, inCoordinatesOf);
+
+    std::vector<LinearVector> resolvedForces(count);
+    fs->Resolve(forces.data(), count, resolvedForces.data(),
+                relativeTo, inCoordinatesOf);
+
+    std::vector<Pose> resolvedPoses(count);
+    fs->Resolve(poses.data(), count, resolvedPoses.data(),
+                relativeTo, inCoordinatesOf);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      EXPECT_TRUE(Equal(
+          fs->Resolve(positions[i], relativeTo, inCoordinatesOf),
+          resolvedPositions[i], _tolerance));
+      EXPECT_TRUE(Equal(
+          fs->Resolve(forces[i], relativeTo, inCoordinatesOf),
+          resolvedForces[i], _tolerance));
+      EXPECT_TRUE(Equal(
+          fs->Resolve(poses[i], relativeTo, inCoordinatesOf),
+          resolvedPoses[i], _tolerance));
+    }
+  }
+
+  // The overload without inCoordinatesOf uses the coordinates of relativeTo
+  std::vector<LinearVector> resolvedPositions(count);
+  fs->Resolve(positions.data(), count, resolvedPositions.data(), B);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    EXPECT_TRUE(Equal(fs->Resolve(positions[i], B),
+                      resolvedPositions[i], _tolerance));
+  }
+
+  // Reframing in place gives the same frames as reframing one by one
+  std::vector<RelativeFrameData> reframed = frames;
+  fs->Reframe(reframed.data(), count, reframed.data(), C);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    const RelativeFrameData expected = fs->Reframe(frames[i], C);
+    EXPECT_EQ(C, reframed[i].ParentFrame());
+    EXPECT_TRUE(Equal(expected.RelativeToParent(),
+                      reframed[i].RelativeToParent(), _tolerance));
+  }
+
+  // An empty array is left alone
+  fs->Resolve(positions.data(), 0, resolvedPositions.data(), C);
+}
+
 #endif
@@ -41,6 +41,12 @@ TEST(FrameSemantics_TEST, RelativeQuantities2d)
   TestRelativeQuantities<ignition::physics::FeaturePolicy2d>(1e-11, "2d");
 }
 
+/////////////////////////////////////////////////
+TEST(FrameSemantics_TEST, ResolveArrays2d)
+{
+  TestResolveArrays<ignition::physics::FeaturePolicy2d>(1e-11, "2d");
+}
+
 int main(int argc, char **argv)
 {
   // This seed is arbitrary, but we always use the same seed value to ensure
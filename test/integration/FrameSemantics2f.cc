@@ -41,6 +41,12 @@ TEST(FrameSemantics_TEST, RelativeQuantities2f)
   TestRelativeQuantities<ignition::physics::FeaturePolicy2f>(1e-4, "2f");
 }
 
+/////////////////////////////////////////////////
+TEST(FrameSemantics_TEST, ResolveArrays2f)
+{
+  TestResolveArrays<ignition::physics::FeaturePolicy2f>(1e-4, "2f");
+}
+
 int main(int argc, char **argv)
 {
   // This seed is arbitrary, but we always use the same seed value to ensure
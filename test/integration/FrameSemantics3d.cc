@@ -47,6 +47,12 @@ TEST(FrameSemantics_TEST, RelativeFrameData3d)
   TestRelativeFrameData<ignition::physics::FeaturePolicy3d>(1e-11, "3d");
 }
 
+/////////////////////////////////////////////////
+TEST(FrameSemantics_TEST, ResolveArrays3d)
+{
+  TestResolveArrays<ignition::physics::FeaturePolicy3d>(1e-11, "3d");
+}
+
 int main(int argc, char **argv)
 {
   // This seed is arbitrary, but we always use the same seed value to ensure
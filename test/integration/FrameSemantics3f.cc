@@ -47,6 +47,12 @@ TEST(FrameSemantics_TEST, RelativeFrameData3f)
   TestRelativeFrameData<ignition::physics::FeaturePolicy3f>(1e-2, "3f");
 }
 
+/////////////////////////////////////////////////
+TEST(FrameSemantics_TEST, ResolveArrays3f)
+{
+  TestResolveArrays<ignition::physics::FeaturePolicy3f>(1e-2, "3f");
+}
+
 int main(int argc, char **argv)
 {
   // This seed is arbitrary, but we always use the same seed value to ensure
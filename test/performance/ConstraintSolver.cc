@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ignition/plugin/Loader.hh>
+
+#include <ignition/physics/ForwardStep.hh>
+#include <ignition/physics/GetContacts.hh>
+#include <ignition/physics/RequestEngine.hh>
+#include <ignition/physics/World.hh>
+#include <ignition/physics/sdf/ConstructWorld.hh>
+
+#include <sdf/Root.hh>
+#include <sdf/World.hh>
+
+struct SolverFeatures : ignition::physics::FeatureList<
+    ignition::physics::ForwardStep,
+    ignition::physics::GetContactsFromLastStepFeature,
+    ignition::physics::Solver,
+    ignition::physics::sdf::ConstructSdfWorld
+> { };
+
+using SolverEnginePtr = ignition::physics::Engine3dPtr<SolverFeatures>;
+using SolverWorldPtr = ignition::physics::World3dPtr<SolverFeatures>;
+using ExtraContactData =
+    ignition::physics::World3d<SolverFeatures>::ExtraContactData;
+
+const std::size_t gNumStacks = 10;
+const std::size_t gStackHeight = 8;
+const std::size_t gNumSteps = 1000;
+
+/////////////////////////////////////////////////
+/// \brief Create a world with stacks of boxes resting on a static ground, so
+/// that every step has a large contact problem to solve.
+std::string CreateWorldString()
+{
+  std::stringstream ss;
+  ss << "<?xml version='1.0'?><sdf version='1.7'><world name='stacks'>"
+     << "<model name='ground'><static>true</static>"
+     << "<pose>0 0 -0.5 0 0 0</pose><link name='link'>"
+     << "<collision name='c'><geometry><box><size>100 100 1</size>"
+     << "</box></geometry></collision></link></model>";
+  for (std::size_t i = 0; i < gNumStacks; ++i)
+  {
+    for (std::size_t j = 0; j < gStackHeight; ++j)
+    {
+      ss << "<model name='box_" << i << "_" << j << "'>"
+         << "<pose>" << 2.0*static_cast<double>(i) << " 0 "
+         << 0.25 + 0.5*static_cast<double>(j) << " 0 0 0</pose>"
+         << "<link name='link'>"
+         << "<collision name='c'><geometry><box><size>0.5 0.5 0.5</size>"
+         << "</box></geometry></collision></link>"
+         << "</model>";
+    }
+  }
+  ss << "</world></sdf>";
+  return ss.str();
+}
+
+/////////////////////////////////////////////////
+struct SolverResult
+{
+  /// \brief Steps simulated per second of wall time
+  double stepsPerSecond;
+
+  /// \brief Largest penetration depth among the contacts of the last step
+  double contactError;
+};
+
+/////////////////////////////////////////////////
+SolverResult Simulate(const SolverEnginePtr &_engine,
+                      const sdf::World &_sdfWorld,
+                      const std::string &_solver,
+                      const std::size_t _iterations)
+{
+  SolverWorldPtr world = _engine->ConstructWorld(_sdfWorld);
+  world->SetSolver(_solver);
+  if (_iterations > 0)
+    world->SetSolverIterations(_iterations);
+
+  ignition::physics::ForwardStep::Input input;
+  ignition::physics::ForwardStep::State state;
+  ignition::physics::ForwardStep::Output output;
+
+  const auto start = std::chrono::high_resolution_clock::now();
+  for (std::size_t i = 0; i < gNumSteps; ++i)
+    world->Step(output, state, input);
+  const auto finish = std::chrono::high_resolution_clock::now();
+
+  SolverResult result;
+  result.stepsPerSecond = static_cast<double>(gNumSteps) /
+      std::chrono::duration<double>(finish - start).count();
+
+  result.contactError = 0.0;
+  const auto contacts = world->GetContactsFromLastStep();
+  EXPECT_FALSE(contacts.empty());
+  for (const auto &contact : contacts)
+  {
+    const auto *extra = contact.Query<ExtraContactData>();
+    if (extra)
+      result.contactError = std::max(result.contactError, extra->depth);
+  }
+
+  return result;
+}
+
+/////////////////////////////////////////////////
+TEST(ConstraintSolver, ThroughputVersusContactError)
+{
+  ignition::plugin::Loader loader;
+  loader.LoadLib(dartsim_plugin_LIB);
+
+  ignition::plugin::PluginPtr dartsim =
+      loader.Instantiate("ignition::physics::dartsim::Plugin");
+
+  SolverEnginePtr engine =
+      ignition::physics::RequestEngine3d<SolverFeatures>::From(dartsim);
+  ASSERT_NE(nullptr, engine);
+
+  sdf::Root root;
+  ASSERT_TRUE(root.LoadSdfString(CreateWorldString()).empty());
+  const sdf::World *sdfWorld = root.WorldByIndex(0);
+  ASSERT_NE(nullptr, sdfWorld);
+
+  struct Config
+  {
+    std::string solver;
+    std::size_t iterations;
+  };
+  const std::vector<Config> configs = {
+    // dantzig is not iterative
+    {"dantzig", 0u},
+    {"pgs", 100u},
+    {"pgs", 30u},
+    {"pgs", 10u},
+    {"pgs", 3u}
+  };
+
+  std::cout << " --- Stack " << gNumStacks * gStackHeight << " boxes for "
+            << gNumSteps << " steps ---\n"
+            << std::setw(10) << "solver" << std::setw(12) << "iterations"
+            << std::setw(16) << "steps/second" << std::setw(16)
+            << "contact error\n";
+
+  for (const Config &config : configs)
+  {
+    const SolverResult result =
+        Simulate(engine, *sdfWorld, config.solver, config.iterations);
+
+    // The boxes should not sink far into each other with any of the solvers
+    EXPECT_LT(result.contactError, 0.1);
+
+    std::cout << std::fixed << std::setprecision(6)
+              << std::setw(10) << config.solver
+              << std::setw(12) << config.iterations
+              << std::setw(16) << result.stepsPerSecond
+              << std::setw(16) << result.contactError << "\n";
+  }
+  std::cout << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include <ignition/plugin/Loader.hh>
+
+#include <ignition/physics/FrameSemantics.hh>
+#include <ignition/physics/RequestEngine.hh>
+
+#include "../MockFrameSemantics.hh"
+
+using FrameSemanticsImpl =
+    ignition::physics::FrameSemantics::Implementation<
+      ignition::physics::FeaturePolicy3d>;
+
+const std::size_t gNumCalls = 1000000;
+const std::size_t gNumRuns = 5;
+
+/////////////////////////////////////////////////
+/// \brief Time a number of calls to _call and return the average time per
+/// call, in nanoseconds.
+template <typename CallT>
+double TimeCalls(const CallT &_call)
+{
+  double sum = 0.0;
+  const auto start = std::chrono::high_resolution_clock::now();
+  for (std::size_t i = 0; i < gNumCalls; ++i)
+    sum += _call();
+  const auto finish = std::chrono::high_resolution_clock::now();
+
+  // Use the results so that the calls cannot be optimized away
+  EXPECT_LT(0.0, sum);
+
+  return std::chrono::duration<double, std::nano>(finish - start).count()
+      / static_cast<double>(gNumCalls);
+}
+
+/////////////////////////////////////////////////
+/// \brief Compare calling a feature through an entity, which reads the
+/// implementation from the table of its plugin handle, against querying the
+/// plugin for the implementation before each call.
+TEST(FeatureDispatch, EntityVersusQueryInterface)
+{
+  ignition::plugin::Loader loader;
+  loader.LoadLib(MockFrames_LIB);
+
+  ignition::plugin::PluginPtr plugin =
+      loader.Instantiate("mock::MockFrameSemanticsPlugin3d");
+  ASSERT_FALSE(plugin.IsEmpty());
+
+  auto engine =
+      ignition::physics::RequestEngine3d<mock::MockFrameSemanticsList>
+        ::From(plugin);
+  ASSERT_NE(nullptr, engine);
+
+  ignition::physics::FrameData3d data;
+  data.pose.translation() = Eigen::Vector3d(1.0, 2.0, 3.0);
+  auto link = engine->CreateLink("link", data);
+  ASSERT_NE(nullptr, link);
+  const ignition::physics::FrameID linkID = link->GetFrameID();
+
+  double avgEntity = 0.0;
+  double avgQuery = 0.0;
+  for (std::size_t i = 0; i < gNumRuns; ++i)
+  {
+    avgEntity += TimeCalls([&]()
+    {
+      return link->FrameDataRelativeToWorld().pose.translation().x();
+    });
+
+    avgQuery += TimeCalls([&]()
+    {
+      return plugin->QueryInterface<FrameSemanticsImpl>()
+          ->FrameDataRelativeToWorld(linkID).pose.translation().x();
+    });
+  }
+
+  avgEntity /= static_cast<double>(gNumRuns);
+  avgQuery /= static_cast<double>(gNumRuns);
+
+  EXPECT_LT(avgEntity, avgQuery);
+
+  std::cout << std::fixed << std::setprecision(3)
+            << " --- Call through an entity ---\n"
+            << "Avg time: " << std::setw(10) << avgEntity << " ns\n\n"
+            << " --- Query the interface for each call ---\n"
+            << "Avg time: " << std::setw(10) << avgQuery << " ns\n"
+            << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ignition/plugin/Loader.hh>
+
+#include <ignition/physics/ForwardStep.hh>
+#include <ignition/physics/FrameSemantics.hh>
+#include <ignition/physics/GetEntities.hh>
+#include <ignition/physics/RequestEngine.hh>
+#include <ignition/physics/sdf/ConstructWorld.hh>
+
+#include <sdf/Root.hh>
+#include <sdf/World.hh>
+
+struct ChainFeatures : ignition::physics::FeatureList<
+    ignition::physics::ForwardStep,
+    ignition::physics::GetEntities,
+    ignition::physics::LinkFrameSemantics,
+    ignition::physics::sdf::ConstructSdfWorld
+> { };
+
+using ChainEnginePtr = ignition::physics::Engine3dPtr<ChainFeatures>;
+using ChainWorldPtr = ignition::physics::World3dPtr<ChainFeatures>;
+using ChainLinkPtr = ignition::physics::Link3dPtr<ChainFeatures>;
+
+const std::size_t gNumLinks = 50;
+const std::size_t gNumSteps = 1000;
+const std::size_t gNumRuns = 5;
+
+/////////////////////////////////////////////////
+/// \brief Create a world with a single chain of links that are connected by
+/// revolute joints, and that swings freely under gravity.
+std::string CreateWorldString()
+{
+  std::stringstream ss;
+  ss << "<?xml version='1.0'?><sdf version='1.7'><world name='chain'>"
+     << "<model name='chain'><pose>0 0 10 0 0 0</pose>";
+  for (std::size_t i = 0; i < gNumLinks; ++i)
+  {
+    ss << "<link name='link_" << i << "'>"
+       << "<pose>0 " << 0.1*static_cast<double>(i) << " 0 0 0 0</pose>"
+       << "<inertial><mass>0.1</mass></inertial></link>";
+
+    ss << "<joint name='joint_" << i << "' type='revolute'>"
+       << "<parent>" << (i == 0 ? std::string("world") :
+                         "link_" + std::to_string(i-1)) << "</parent>"
+       << "<child>link_" << i << "</child>"
+       << "<axis><xyz>1 0 0</xyz></axis></joint>";
+  }
+  ss << "</model></world></sdf>";
+  return ss.str();
+}
+
+/////////////////////////////////////////////////
+/// \brief Step a freshly constructed chain, query the pose of every link
+/// after each step with _query, and return the average time per step, in
+/// milliseconds.
+template <typename QueryT>
+double TimeQueries(const ChainEnginePtr &_engine,
+                   const sdf::World &_sdfWorld, const QueryT &_query)
+{
+  ChainWorldPtr world = _engine->ConstructWorld(_sdfWorld);
+  auto model = world->GetModel(0);
+
+  std::vector<ChainLinkPtr> links;
+  for (std::size_t i = 0; i < model->GetLinkCount(); ++i)
+    links.push_back(model->GetLink(i));
+
+  ignition::physics::ForwardStep::Input input;
+  ignition::physics::ForwardStep::State state;
+  ignition::physics::ForwardStep::Output output;
+
+  double sum = 0.0;
+  const auto start = std::chrono::high_resolution_clock::now();
+  for (std::size_t i = 0; i < gNumSteps; ++i)
+  {
+    world->Step(output, state, input);
+    for (const auto &link : links)
+      sum += _query(link).translation().z();
+  }
+  const auto finish = std::chrono::high_resolution_clock::now();
+
+  // Use the results so that the queries cannot be optimized away
+  EXPECT_NE(0.0, sum);
+
+  return std::chrono::duration<double, std::milli>(finish - start).count()
+      / static_cast<double>(gNumSteps);
+}
+
+/////////////////////////////////////////////////
+/// \brief Compare reading the poses of a chain of links from their complete
+/// frame data against resolving their poses, which only asks the engine for
+/// the pose of each link instead of also computing its accelerations.
+TEST(FrameDataFields, PoseOnlyVersusCompleteFrameData)
+{
+  ignition::plugin::Loader loader;
+  loader.LoadLib(dartsim_plugin_LIB);
+
+  ignition::plugin::PluginPtr dartsim =
+      loader.Instantiate("ignition::physics::dartsim::Plugin");
+
+  ChainEnginePtr engine =
+      ignition::physics::RequestEngine3d<ChainFeatures>::From(dartsim);
+  ASSERT_NE(nullptr, engine);
+
+  sdf::Root root;
+  ASSERT_TRUE(root.LoadSdfString(CreateWorldString()).empty());
+  const sdf::World *sdfWorld = root.WorldByIndex(0);
+  ASSERT_NE(nullptr, sdfWorld);
+
+  const auto complete = [](const ChainLinkPtr &_link)
+  {
+    return _link->FrameDataRelativeToWorld().pose;
+  };
+
+  const auto poseOnly = [&engine](const ChainLinkPtr &_link)
+  {
+    return engine->Resolve(
+          ignition::physics::RelativePose3d(
+            _link->GetFrameID(), Eigen::Isometry3d::Identity()),
+          ignition::physics::FrameID::World());
+  };
+
+  double avgComplete = 0.0;
+  double avgPoseOnly = 0.0;
+  for (std::size_t i = 0; i < gNumRuns; ++i)
+  {
+    avgComplete += TimeQueries(engine, *sdfWorld, complete);
+    avgPoseOnly += TimeQueries(engine, *sdfWorld, poseOnly);
+  }
+
+  avgComplete /= static_cast<double>(gNumRuns);
+  avgPoseOnly /= static_cast<double>(gNumRuns);
+
+  EXPECT_LT(avgPoseOnly, avgComplete);
+
+  std::cout << std::fixed << std::setprecision(6)
+            << " --- Step and read " << gNumLinks
+            << " poses from complete frame data ---\n"
+            << "Avg time: " << std::setw(12) << avgComplete << " ms\n\n"
+            << " --- Step and resolve " << gNumLinks << " poses ---\n"
+            << "Avg time: " << std::setw(12) << avgPoseOnly << " ms\n"
+            << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
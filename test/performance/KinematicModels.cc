@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <ignition/plugin/Loader.hh>
+
+#include <ignition/physics/ForwardStep.hh>
+#include <ignition/physics/GetEntities.hh>
+#include <ignition/physics/RequestEngine.hh>
+#include <ignition/physics/sdf/ConstructWorld.hh>
+
+#include <ignition/physics/dartsim/Kinematic.hh>
+
+#include <sdf/Root.hh>
+#include <sdf/World.hh>
+
+struct KinematicFeatures : ignition::physics::FeatureList<
+    ignition::physics::ForwardStep,
+    ignition::physics::GetEntities,
+    ignition::physics::sdf::ConstructSdfWorld,
+    ignition::physics::dartsim::KinematicModelFeature
+> { };
+
+using KinematicEnginePtr = ignition::physics::Engine3dPtr<KinematicFeatures>;
+using KinematicWorldPtr = ignition::physics::World3dPtr<KinematicFeatures>;
+
+const std::size_t gNumModels = 200;
+const std::size_t gNumSteps = 1000;
+const std::size_t gNumRuns = 5;
+
+/////////////////////////////////////////////////
+/// \brief Create a world with many two-link pendulums that swing freely
+/// above the ground.
+std::string CreateWorldString()
+{
+  std::stringstream ss;
+  ss << "<?xml version='1.0'?><sdf version='1.7'><world name='kinematic'>";
+  for (std::size_t i = 0; i < gNumModels; ++i)
+  {
+    ss << "<model name='pendulum_" << i << "'>"
+       << "<pose>" << 2.0*static_cast<double>(i % 20) << " "
+       << 2.0*static_cast<double>(i / 20) << " 2 0 0 0</pose>"
+       << "<link name='base'>"
+       << "<collision name='c'><geometry><box><size>0.2 0.2 0.2</size>"
+       << "</box></geometry></collision></link>"
+       << "<link name='arm'><pose>0 0.5 0 0 0 0</pose>"
+       << "<collision name='c'><geometry><sphere><radius>0.1</radius>"
+       << "</sphere></geometry></collision></link>"
+       << "<joint name='fix' type='fixed'><parent>world</parent>"
+       << "<child>base</child></joint>"
+       << "<joint name='swing' type='revolute'><parent>base</parent>"
+       << "<child>arm</child><axis><xyz>1 0 0</xyz></axis>"
+       << "<pose>0 -0.5 0 0 0 0</pose></joint>"
+       << "</model>";
+  }
+  ss << "</world></sdf>";
+  return ss.str();
+}
+
+/////////////////////////////////////////////////
+/// \brief Step a freshly constructed world and return the average time per
+/// step, in milliseconds.
+double TimeSteps(const KinematicEnginePtr &_engine,
+                 const sdf::World &_sdfWorld, const bool _kinematic)
+{
+  KinematicWorldPtr world = _engine->ConstructWorld(_sdfWorld);
+  for (std::size_t i = 0; i < world->GetModelCount(); ++i)
+    world->GetModel(i)->SetKinematic(_kinematic);
+
+  ignition::physics::ForwardStep::Input input;
+  ignition::physics::ForwardStep::State state;
+  ignition::physics::ForwardStep::Output output;
+
+  const auto start = std::chrono::high_resolution_clock::now();
+  for (std::size_t i = 0; i < gNumSteps; ++i)
+    world->Step(output, state, input);
+  const auto finish = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration<double, std::milli>(finish - start).count()
+      / static_cast<double>(gNumSteps);
+}
+
+/////////////////////////////////////////////////
+TEST(KinematicModels, KinematicVersusDynamic)
+{
+  ignition::plugin::Loader loader;
+  loader.LoadLib(dartsim_plugin_LIB);
+
+  ignition::plugin::PluginPtr dartsim =
+      loader.Instantiate("ignition::physics::dartsim::Plugin");
+
+  KinematicEnginePtr engine =
+      ignition::physics::RequestEngine3d<KinematicFeatures>::From(dartsim);
+  ASSERT_NE(nullptr, engine);
+
+  sdf::Root root;
+  ASSERT_TRUE(root.LoadSdfString(CreateWorldString()).empty());
+  const sdf::World *sdfWorld = root.WorldByIndex(0);
+  ASSERT_NE(nullptr, sdfWorld);
+
+  double avgDynamic = 0.0;
+  double avgKinematic = 0.0;
+  for (std::size_t i = 0; i < gNumRuns; ++i)
+  {
+    avgDynamic += TimeSteps(engine, *sdfWorld, false);
+    avgKinematic += TimeSteps(engine, *sdfWorld, true);
+  }
+
+  avgDynamic /= static_cast<double>(gNumRuns);
+  avgKinematic /= static_cast<double>(gNumRuns);
+
+  EXPECT_LT(avgKinematic, avgDynamic);
+
+  std::cout << std::fixed << std::setprecision(6)
+            << " --- Step " << gNumModels << " dynamic models ---\n"
+            << "Avg time: " << std::setw(12) << avgDynamic << " ms\n\n"
+            << " --- Step " << gNumModels << " kinematic models ---\n"
+            << "Avg time: " << std::setw(12) << avgKinematic << " ms\n"
+            << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
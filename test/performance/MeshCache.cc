@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+#include <ignition/common/MeshManager.hh>
+#include <ignition/plugin/Loader.hh>
+
+#include <ignition/physics/ConstructEmpty.hh>
+#include <ignition/physics/RequestEngine.hh>
+#include <ignition/physics/mesh/MeshShape.hh>
+
+struct MeshFeatures : ignition::physics::FeatureList<
+    ignition::physics::ConstructEmptyWorldFeature,
+    ignition::physics::ConstructEmptyModelFeature,
+    ignition::physics::ConstructEmptyLinkFeature,
+    ignition::physics::mesh::AttachMeshShapeFeature
+> { };
+
+using MeshEnginePtr = ignition::physics::Engine3dPtr<MeshFeatures>;
+
+const std::size_t gNumInstances = 500;
+
+/////////////////////////////////////////////////
+/// \brief Resident set size of this process in kilobytes. This is only
+/// measured on Linux; other platforms report 0.
+double ResidentMemory()
+{
+#ifdef __linux__
+  std::size_t pages = 0;
+  std::size_t resident = 0;
+  std::ifstream statm("/proc/self/statm");
+  statm >> pages >> resident;
+
+  return static_cast<double>(resident)
+      * static_cast<double>(sysconf(_SC_PAGESIZE)) / 1024.0;
+#else
+  return 0.0;
+#endif
+}
+
+/////////////////////////////////////////////////
+struct Result
+{
+  double time;
+  double memory;
+};
+
+/////////////////////////////////////////////////
+/// \brief Attach gNumInstances spheres to a fresh world. If _shared is true,
+/// every instance uses the same mesh, otherwise each instance has a distinct
+/// mesh with identical contents.
+Result AttachInstances(const MeshEnginePtr &_engine, const bool _shared)
+{
+  auto &meshManager = *ignition::common::MeshManager::Instance();
+  const std::string prefix = _shared ? "shared_sphere" : "unique_sphere";
+  for (std::size_t i = 0; i < gNumInstances; ++i)
+  {
+    const std::string name = _shared ? prefix : prefix + std::to_string(i);
+    if (!meshManager.HasMesh(name))
+      meshManager.CreateSphere(name, 0.5, 64, 64);
+  }
+
+  const double memoryBefore = ResidentMemory();
+  const auto start = std::chrono::high_resolution_clock::now();
+
+  auto world = _engine->ConstructEmptyWorld(prefix + "_world");
+  auto model = world->ConstructEmptyModel("shelves");
+  for (std::size_t i = 0; i < gNumInstances; ++i)
+  {
+    const std::string name = _shared ? prefix : prefix + std::to_string(i);
+    auto link = model->ConstructEmptyLink("shelf_" + std::to_string(i));
+    link->AttachMeshShape("mesh", *meshManager.MeshByName(name));
+  }
+
+  const auto finish = std::chrono::high_resolution_clock::now();
+
+  return {std::chrono::duration<double, std::milli>(finish - start).count(),
+          ResidentMemory() - memoryBefore};
+}
+
+/////////////////////////////////////////////////
+TEST(MeshCache, ManyInstances)
+{
+  ignition::plugin::Loader loader;
+  loader.LoadLib(dartsim_plugin_LIB);
+
+  ignition::plugin::PluginPtr dartsim =
+      loader.Instantiate("ignition::physics::dartsim::Plugin");
+
+  MeshEnginePtr engine =
+      ignition::physics::RequestEngine3d<MeshFeatures>::From(dartsim);
+  ASSERT_NE(nullptr, engine);
+
+  const Result unique = AttachInstances(engine, false);
+  const Result shared = AttachInstances(engine, true);
+
+  EXPECT_LT(shared.time, unique.time);
+#ifdef __linux__
+  EXPECT_LT(shared.memory, unique.memory);
+#endif
+
+  std::cout << std::fixed << std::setprecision(3)
+            << " --- " << gNumInstances << " distinct meshes ---\n"
+            << "Time:   " << std::setw(12) << unique.time << " ms\n"
+            << "Memory: " << std::setw(12) << unique.memory << " kB\n\n"
+            << " --- " << gNumInstances << " instances of one mesh ---\n"
+            << "Time:   " << std::setw(12) << shared.time << " ms\n"
+            << "Memory: " << std::setw(12) << shared.memory << " kB\n"
+            << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
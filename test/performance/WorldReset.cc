@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <ignition/plugin/Loader.hh>
+
+#include <ignition/physics/ForwardStep.hh>
+#include <ignition/physics/RequestEngine.hh>
+#include <ignition/physics/ResetWorld.hh>
+#include <ignition/physics/sdf/ConstructWorld.hh>
+
+#include <sdf/Root.hh>
+#include <sdf/World.hh>
+
+struct ResetFeatures : ignition::physics::FeatureList<
+    ignition::physics::ForwardStep,
+    ignition::physics::ResetWorldFeature,
+    ignition::physics::sdf::ConstructSdfWorld
+> { };
+
+using ResetEnginePtr = ignition::physics::Engine3dPtr<ResetFeatures>;
+using ResetWorldPtr = ignition::physics::World3dPtr<ResetFeatures>;
+
+const std::size_t gNumModels = 200;
+const std::size_t gNumSteps = 100;
+const std::size_t gNumRuns = 10;
+
+/////////////////////////////////////////////////
+/// \brief Create a world with many two-link pendulums resting above the
+/// ground so that each episode has some dynamics to undo.
+std::string CreateWorldString()
+{
+  std::stringstream ss;
+  ss << "<?xml version='1.0'?><sdf version='1.7'><world name='reset'>";
+  for (std::size_t i = 0; i < gNumModels; ++i)
+  {
+    ss << "<model name='pendulum_" << i << "'>"
+       << "<pose>" << 2.0*static_cast<double>(i % 20) << " "
+       << 2.0*static_cast<double>(i / 20) << " 2 0 0 0</pose>"
+       << "<link name='base'>"
+       << "<collision name='c'><geometry><box><size>0.2 0.2 0.2</size>"
+       << "</box></geometry></collision></link>"
+       << "<link name='arm'><pose>0 0 -0.5 0 0 0</pose>"
+       << "<collision name='c'><geometry><sphere><radius>0.1</radius>"
+       << "</sphere></geometry></collision></link>"
+       << "<joint name='fix' type='fixed'><parent>world</parent>"
+       << "<child>base</child></joint>"
+       << "<joint name='swing' type='revolute'><parent>base</parent>"
+       << "<child>arm</child><axis><xyz>1 0 0</xyz></axis>"
+       << "<pose>0 0 0.5 0 0 0</pose></joint>"
+       << "</model>";
+  }
+  ss << "</world></sdf>";
+  return ss.str();
+}
+
+/////////////////////////////////////////////////
+void Step(const ResetWorldPtr &_world)
+{
+  ignition::physics::ForwardStep::Input input;
+  ignition::physics::ForwardStep::State state;
+  ignition::physics::ForwardStep::Output output;
+
+  for (std::size_t i = 0; i < gNumSteps; ++i)
+    _world->Step(output, state, input);
+}
+
+/////////////////////////////////////////////////
+TEST(WorldReset, ResetVersusReload)
+{
+  ignition::plugin::Loader loader;
+  loader.LoadLib(dartsim_plugin_LIB);
+
+  ignition::plugin::PluginPtr dartsim =
+      loader.Instantiate("ignition::physics::dartsim::Plugin");
+
+  ResetEnginePtr engine =
+      ignition::physics::RequestEngine3d<ResetFeatures>::From(dartsim);
+  ASSERT_NE(nullptr, engine);
+
+  sdf::Root root;
+  ASSERT_TRUE(root.LoadSdfString(CreateWorldString()).empty());
+  const sdf::World *sdfWorld = root.WorldByIndex(0);
+  ASSERT_NE(nullptr, sdfWorld);
+
+  double avgReload = 0.0;
+  double avgReset = 0.0;
+
+  ResetWorldPtr world = engine->ConstructWorld(*sdfWorld);
+  for (std::size_t i = 0; i < gNumRuns; ++i)
+  {
+    Step(world);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    world = engine->ConstructWorld(*sdfWorld);
+    auto finish = std::chrono::high_resolution_clock::now();
+    avgReload += std::chrono::duration<double, std::milli>(
+          finish - start).count();
+
+    Step(world);
+
+    start = std::chrono::high_resolution_clock::now();
+    world->Reset();
+    finish = std::chrono::high_resolution_clock::now();
+    avgReset += std::chrono::duration<double, std::milli>(
+          finish - start).count();
+  }
+
+  avgReload /= static_cast<double>(gNumRuns);
+  avgReset /= static_cast<double>(gNumRuns);
+
+  EXPECT_LT(avgReset, avgReload);
+
+  std::cout << std::fixed << std::setprecision(6)
+            << " --- Reload world with " << gNumModels << " models ---\n"
+            << "Avg time: " << std::setw(12) << avgReload << " ms\n\n"
+            << " --- Reset world with " << gNumModels << " models ---\n"
+            << "Avg time: " << std::setw(12) << avgReset << " ms\n"
+            << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
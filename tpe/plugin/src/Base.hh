@@ -18,11 +18,14 @@
 #ifndef IGNITION_PHYSICS_TPE_PLUGIN_SRC_BASE_HH_
 #define IGNITION_PHYSICS_TPE_PLUGIN_SRC_BASE_HH_
 
+#include <ignition/physics/ChangedWorldPoses.hh>
 #include <ignition/physics/Implements.hh>
 
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "lib/src/World.hh"
 #include "lib/src/Engine.hh"
@@ -42,21 +45,57 @@ namespace tpeplugin {
 struct WorldInfo
 {
   std::shared_ptr<tpelib::World> world;
+
+  /// \brief Slot that the identities of this entity refer to
+  detail::ReferenceSlot *slot = nullptr;
 };
 
 struct ModelInfo
 {
   tpelib::Model *model;
+
+  /// \brief ID of the world that the model belongs to, directly or through
+  /// its parent models
+  std::size_t worldId = -1;
+
+  /// \brief Slot that the identities of this entity refer to
+  detail::ReferenceSlot *slot = nullptr;
 };
 
 struct LinkInfo
 {
   tpelib::Link *link;
+
+  /// \brief ID of the world that the link belongs to
+  std::size_t worldId = -1;
+
+  /// \brief Slot that the identities of this entity refer to
+  detail::ReferenceSlot *slot = nullptr;
 };
 
 struct CollisionInfo
 {
   tpelib::Collision *collision;
+
+  /// \brief Slot that the identities of this entity refer to
+  detail::ReferenceSlot *slot = nullptr;
+};
+
+/// \brief The poses that were last reported for the links and models of a
+/// world, used to find the entities that moved during a step
+struct WorldPoseTracker
+{
+  /// \brief Distance an entity must move to be reported as changed
+  double linearTolerance = 1e-6;
+
+  /// \brief Angle an entity must turn to be reported as changed
+  double angularTolerance = 1e-6;
+
+  /// \brief Map from an entity ID to the world pose last reported for it
+  std::unordered_map<std::size_t, math::Pose3d> reported;
+
+  /// \brief The entities that changed during the last step
+  WorldPoseChanges changes;
 };
 
 class Base : public Implements3d<FeatureList<Feature>>
@@ -111,38 +150,135 @@ class Base : public Implements3d<FeatureList<Feature>>
   }
 
 
+  /// \brief Find the world that an entity belongs to, following the parents
+  /// of nested models
+  /// \param[in] _id ID of a model, link or collision
+  /// \return ID of the world, or an invalid ID if the entity was removed
+  public: inline std::size_t WorldIdOf(std::size_t _id) const
+  {
+    auto it = this->childIdToParentId.find(_id);
+    while (it != this->childIdToParentId.end() &&
+        this->worlds.find(it->second) == this->worlds.end())
+    {
+      it = this->childIdToParentId.find(it->second);
+    }
+
+    if (it == this->childIdToParentId.end())
+      return -1;
+    return it->second;
+  }
+
+  /// \brief Forget the poses reported for a model and its links, before the
+  /// model is removed
+  /// \param[in] _modelId ID of the model
+  public: inline void ForgetReportedPoses(std::size_t _modelId)
+  {
+    const auto trackerIt = this->worldPoseTrackers.find(
+        this->WorldIdOf(_modelId));
+    if (trackerIt == this->worldPoseTrackers.end())
+      return;
+
+    auto &reported = trackerIt->second.reported;
+    reported.erase(_modelId);
+    for (const auto &pair : this->childIdToParentId)
+    {
+      if (pair.second == _modelId)
+        reported.erase(pair.first);
+    }
+  }
+
+  /// \brief Forget a model that is being removed, together with its nested
+  /// models, links and collisions. Identities of these entities resolve to
+  /// nullptr from then on.
+  /// \param[in] _modelId ID of the model
+  public: inline void EraseModel(std::size_t _modelId)
+  {
+    // Collect the entities of the model, breadth first
+    std::vector<std::size_t> erased = {_modelId};
+    for (std::size_t i = 0; i < erased.size(); ++i)
+    {
+      const std::size_t parentId = erased[i];
+      for (const auto &pair : this->childIdToParentId)
+      {
+        if (pair.second == parentId)
+          erased.push_back(pair.first);
+      }
+    }
+
+    for (const std::size_t id : erased)
+    {
+      this->EraseEntity(this->models, id);
+      this->EraseEntity(this->links, id);
+      this->EraseEntity(this->collisions, id);
+      this->childIdToParentId.erase(id);
+    }
+  }
+
+  /// \brief Forget an entity and release its slot, if _entities has it
+  /// \param[in] _entities The map of the entity type
+  /// \param[in] _id ID of the entity
+  private: template <typename InfoT>
+  void EraseEntity(
+      std::map<std::size_t, std::shared_ptr<InfoT>> &_entities,
+      std::size_t _id)
+  {
+    const auto it = _entities.find(_id);
+    if (it == _entities.end())
+      return;
+
+    if (it->second != nullptr && it->second->slot != nullptr)
+      this->referenceSlots.Release(*it->second->slot);
+    _entities.erase(it);
+  }
+
   public: inline Identity AddWorld(std::shared_ptr<tpelib::World> _world)
   {
     size_t worldId = _world->GetId();
     auto worldPtr = std::make_shared<WorldInfo>();
     worldPtr->world = _world;
+    worldPtr->slot = &this->referenceSlots.Acquire(worldPtr.get());
     this->worlds.insert({worldId, worldPtr});
     this->childIdToParentId.insert({worldId, -1});
-    return this->GenerateIdentity(worldId, worldPtr);
+    return this->GenerateIdentity(worldId, *worldPtr->slot);
   }
 
   public: inline Identity AddModel(std::size_t _parentId, tpelib::Model &_model)
   {
     auto modelPtr = std::make_shared<ModelInfo>();
     modelPtr->model = &_model;
+    modelPtr->slot = &this->referenceSlots.Acquire(modelPtr.get());
     size_t modelId = _model.GetId();
+    if (this->worlds.find(_parentId) != this->worlds.end())
+    {
+      modelPtr->worldId = _parentId;
+    }
+    else
+    {
+      auto parentIt = this->models.find(_parentId);
+      if (parentIt != this->models.end())
+        modelPtr->worldId = parentIt->second->worldId;
+    }
     this->models.insert({modelId, modelPtr});
     // keep track of model's corresponding world
     this->childIdToParentId.insert({modelId, _parentId});
 
-    return this->GenerateIdentity(modelId, modelPtr);
+    return this->GenerateIdentity(modelId, *modelPtr->slot);
   }
 
   public: inline Identity AddLink(std::size_t _modelId, tpelib::Link &_link)
   {
     auto linkPtr = std::make_shared<LinkInfo>();
     linkPtr->link = &_link;
+    linkPtr->slot = &this->referenceSlots.Acquire(linkPtr.get());
     size_t linkId = _link.GetId();
+    auto modelIt = this->models.find(_modelId);
+    if (modelIt != this->models.end())
+      linkPtr->worldId = modelIt->second->worldId;
     this->links.insert({linkId, linkPtr});
     // keep track of link's corresponding model
     this->childIdToParentId.insert({linkId, _modelId});
 
-    return this->GenerateIdentity(linkId, linkPtr);
+    return this->GenerateIdentity(linkId, *linkPtr->slot);
   }
 
   public: inline Identity AddCollision(std::size_t _linkId,
@@ -150,12 +286,13 @@ class Base : public Implements3d<FeatureList<Feature>>
   {
     auto collisionPtr = std::make_shared<CollisionInfo>();
     collisionPtr->collision = &_collision;
+    collisionPtr->slot = &this->referenceSlots.Acquire(collisionPtr.get());
     size_t collisionId = _collision.GetId();
     this->collisions.insert({collisionId, collisionPtr});
     // keep track of collision's corresponding link
     this->childIdToParentId.insert({collisionId, _linkId});
 
-    return this->GenerateIdentity(collisionId, collisionPtr);
+    return this->GenerateIdentity(collisionId, *collisionPtr->slot);
   }
 
   public: std::map<std::size_t, std::shared_ptr<WorldInfo>> worlds;
@@ -163,6 +300,15 @@ class Base : public Implements3d<FeatureList<Feature>>
   public: std::map<std::size_t, std::shared_ptr<LinkInfo>> links;
   public: std::map<std::size_t, std::shared_ptr<CollisionInfo>> collisions;
   public: std::map<std::size_t, std::size_t> childIdToParentId;
+
+  /// \brief Slots of the entities above. The identities that this plugin
+  /// generates refer to these slots instead of holding a shared_ptr to the
+  /// entities, so creating and copying them does not touch a reference count.
+  public: detail::ReferenceSlots referenceSlots;
+
+  /// \brief Map from a world ID to the poses last reported for its entities.
+  /// Only worlds whose pose changes have been requested have an entry.
+  public: std::map<std::size_t, WorldPoseTracker> worldPoseTrackers;
 };
 
 }
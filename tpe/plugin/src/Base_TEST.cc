@@ -34,6 +34,16 @@
 
 using namespace ignition::physics;
 
+/// \brief Exposes how the plugin resolves the identities of its entities
+class TestEntityManagement : public tpeplugin::EntityManagementFeatures
+{
+  public: template <typename T>
+  T *Resolve(const Identity &_identity) const
+  {
+    return this->ReferenceInterface<T>(_identity);
+  }
+};
+
 TEST(BaseClass, AddEntities)
 {
   tpeplugin::Base base;
@@ -98,6 +108,8 @@ TEST(BaseClass, AddEntities)
   EXPECT_EQ(
     link1->GetName(), base.links.find(linkId1)->second->link->GetName());
   EXPECT_EQ(modelId1, base.childIdToParentId.find(linkId1)->second);
+  EXPECT_EQ(worldId, base.models.find(modelId1)->second->worldId);
+  EXPECT_EQ(worldId, base.links.find(linkId1)->second->worldId);
 
   // add second link to model2
   auto &linkEnt2 = model2->AddLink();
@@ -178,6 +190,38 @@ TEST(BaseClass, AddEntities)
   EXPECT_EQ(cylinderId, base.indexInContainerToId(linkId2, 0u));
 }
 
+// Test that removing a model releases its links and collisions, so that
+// identities which are held across the removal no longer resolve
+TEST(BaseClass, RemoveModelReleasesChildren)
+{
+  TestEntityManagement plugin;
+  const Identity engineID = plugin.InitiateEngine(0);
+  const Identity worldID = plugin.ConstructEmptyWorld(engineID, "default");
+  const Identity modelID = plugin.ConstructEmptyModel(worldID, "box");
+  const Identity linkID = plugin.ConstructEmptyLink(modelID, "box_link");
+
+  auto *linkInfo = plugin.Resolve<tpeplugin::LinkInfo>(linkID);
+  ASSERT_NE(nullptr, linkInfo);
+  auto &collisionEnt = linkInfo->link->AddCollision();
+  const Identity shapeID = plugin.AddCollision(
+      linkID.id, static_cast<tpelib::Collision &>(collisionEnt));
+  ASSERT_NE(nullptr, plugin.Resolve<tpeplugin::CollisionInfo>(shapeID));
+  EXPECT_TRUE(plugin.GetLinkOfShape(shapeID));
+
+  EXPECT_TRUE(plugin.RemoveModel(modelID));
+  EXPECT_TRUE(plugin.ModelRemoved(modelID));
+
+  EXPECT_EQ(nullptr, plugin.Resolve<tpeplugin::ModelInfo>(modelID));
+  EXPECT_EQ(nullptr, plugin.Resolve<tpeplugin::LinkInfo>(linkID));
+  EXPECT_EQ(nullptr, plugin.Resolve<tpeplugin::CollisionInfo>(shapeID));
+  EXPECT_FALSE(plugin.GetLinkOfShape(shapeID));
+
+  EXPECT_TRUE(plugin.links.empty());
+  EXPECT_TRUE(plugin.collisions.empty());
+  EXPECT_EQ(0u, plugin.childIdToParentId.count(linkID.id));
+  EXPECT_EQ(0u, plugin.childIdToParentId.count(shapeID.id));
+}
+
 int main(int argc, char *argv[])
 {
   ::testing::InitGoogleTest(&argc, argv);
@@ -55,7 +55,7 @@ Identity EntityManagementFeatures::GetWorld(
   std::advance(it, _worldIndex);
   if (it != this->worlds.end() && it->second != nullptr)
   {
-    return this->GenerateIdentity(it->first, it->second);
+    return this->GenerateIdentity(it->first, *it->second->slot);
   }
   return this->GenerateInvalidId();
 }
@@ -70,7 +70,7 @@ Identity EntityManagementFeatures::GetWorld(
     {
       if (it->second->world->GetName() == _worldName)
       {
-        return this->GenerateIdentity(it->first, it->second);
+        return this->GenerateIdentity(it->first, *it->second->slot);
       }
     }
   }
@@ -114,7 +114,7 @@ Identity EntityManagementFeatures::GetModel(
   auto it = this->models.find(modelId);
   if (it != this->models.end() && it->second != nullptr)
   {
-    return this->GenerateIdentity(modelId, it->second);
+    return this->GenerateIdentity(modelId, *it->second->slot);
   }
   return this->GenerateInvalidId();
 }
@@ -134,7 +134,7 @@ Identity EntityManagementFeatures::GetModel(
         std::string name = it->second->model->GetName();
         if (it->first == modelEnt.GetId() && name == modelEnt.GetName())
         {
-          return this->GenerateIdentity(it->first, it->second);
+          return this->GenerateIdentity(it->first, *it->second->slot);
         }
       }
     }
@@ -166,7 +166,7 @@ Identity EntityManagementFeatures::GetWorldOfModel(
     auto worldIt = this->worlds.find(it->second);
     if (worldIt != this->worlds.end() && worldIt->second != nullptr)
     {
-      return this->GenerateIdentity(it->second, worldIt->second);
+      return this->GenerateIdentity(it->second, *worldIt->second->slot);
     }
   }
   return this->GenerateInvalidId();
@@ -187,7 +187,7 @@ Identity EntityManagementFeatures::GetLink(
   auto it = this->links.find(linkId);
   if (it != this->links.end() && it->second != nullptr)
   {
-    return this->GenerateIdentity(it->first, it->second);
+    return this->GenerateIdentity(it->first, *it->second->slot);
   }
   return this->GenerateInvalidId();
 }
@@ -207,7 +207,7 @@ Identity EntityManagementFeatures::GetLink(
         std::string name = it->second->link->GetName();
         if (it->first == linkEnt.GetId() && name == linkEnt.GetName())
         {
-          return this->GenerateIdentity(it->first, it->second);
+          return this->GenerateIdentity(it->first, *it->second->slot);
         }
       }
     }
@@ -239,7 +239,7 @@ Identity EntityManagementFeatures::GetModelOfLink(
     auto modelIt = this->models.find(it->second);
     if (modelIt != this->models.end() && modelIt->second != nullptr)
     {
-      return this->GenerateIdentity(it->second, modelIt->second);
+      return this->GenerateIdentity(it->second, *modelIt->second->slot);
     }
   }
   return this->GenerateInvalidId();
@@ -260,7 +260,7 @@ Identity EntityManagementFeatures::GetShape(
   auto it = this->collisions.find(shapeId);
   if (it != this->collisions.end() && it->second != nullptr)
   {
-    return this->GenerateIdentity(it->first, it->second);
+    return this->GenerateIdentity(it->first, *it->second->slot);
   }
   return this->GenerateInvalidId();
 }
@@ -282,7 +282,7 @@ Identity EntityManagementFeatures::GetShape(
         std::string name = it->second->collision->GetName();
         if (it->first == shapeEnt.GetId() && name == shapeEnt.GetName())
         {
-          return this->GenerateIdentity(it->first, it->second);
+          return this->GenerateIdentity(it->first, *it->second->slot);
         }
       }
     }
@@ -315,7 +315,7 @@ Identity EntityManagementFeatures::GetLinkOfShape(
     auto linkIt = this->links.find(it->second);
     if (linkIt != this->links.end() && linkIt->second != nullptr)
     {
-      return this->GenerateIdentity(it->second, linkIt->second);
+      return this->GenerateIdentity(it->second, *linkIt->second->slot);
     }
   }
   return this->GenerateInvalidId();
@@ -331,8 +331,8 @@ bool EntityManagementFeatures::RemoveModelByIndex(
     auto modelId = this->indexInContainerToId(_worldID.id, _modelIndex);
     if (this->models.find(modelId) != this->models.end())
     {
-      this->models.erase(modelId);
-      this->childIdToParentId.erase(modelId);
+      this->ForgetReportedPoses(modelId);
+      this->EraseModel(modelId);
       return worldInfo->world->RemoveChildById(modelId);
     }
   }
@@ -348,8 +348,8 @@ bool EntityManagementFeatures::RemoveModelByName(
   {
     std::size_t modelId =
       worldInfo->world->GetChildByName(_modelName).GetId();
-    this->models.erase(modelId);
-    this->childIdToParentId.erase(modelId);
+    this->ForgetReportedPoses(modelId);
+    this->EraseModel(modelId);
     return worldInfo->world->RemoveChildById(modelId);
   }
   return false;
@@ -364,8 +364,8 @@ bool EntityManagementFeatures::RemoveModel(const Identity &_modelID)
     auto worldIt = this->worlds.find(it->second);
     if (worldIt != this->worlds.end() && worldIt->second != nullptr)
     {
-      this->models.erase(_modelID.id);
-      this->childIdToParentId.erase(_modelID.id);
+      this->ForgetReportedPoses(_modelID.id);
+      this->EraseModel(_modelID.id);
       return worldIt->second->world->RemoveChildById(_modelID.id);
     }
   }
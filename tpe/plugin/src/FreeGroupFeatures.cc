@@ -50,7 +50,7 @@ Identity FreeGroupFeatures::FindFreeGroupForLink(
 {
   auto it = this->links.find(_linkID.id);
   if (it != this->links.end() && it->second != nullptr)
-    return this->GenerateIdentity(_linkID.id, it->second);
+    return this->GenerateIdentity(_linkID.id, *it->second->slot);
   return this->GenerateInvalidId();
 }
 
@@ -65,9 +65,9 @@ Identity FreeGroupFeatures::GetFreeGroupCanonicalLink(
   {
     // assume canonical link is the first link in model
     tpelib::Entity &link = modelIt->second->model->GetCanonicalLink();
-    auto linkPtr = std::make_shared<LinkInfo>();
-    linkPtr->link = static_cast<tpelib::Link *>(&link);
-    return this->GenerateIdentity(link.GetId(), linkPtr);
+    const auto linkIt = this->links.find(link.GetId());
+    if (linkIt != this->links.end() && linkIt->second != nullptr)
+      return this->GenerateIdentity(linkIt->first, *linkIt->second->slot);
   }
   return this->GenerateInvalidId();
 }
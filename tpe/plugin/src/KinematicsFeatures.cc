@@ -15,6 +15,9 @@
  *
 */
 
+#include <unordered_map>
+#include <vector>
+
 #include <ignition/common/Console.hh>
 #include <ignition/math/eigen3/Conversions.hh>
 
@@ -75,3 +78,74 @@ FrameData3d KinematicsFeatures::FrameDataRelativeToWorld(
   }
   return data;
 }
+
+/////////////////////////////////////////////////
+void KinematicsFeatures::GetWorldLinkFrameData(
+  const Identity &_worldID,
+  std::vector<FrameData3d> &_data,
+  const unsigned int _fields) const
+{
+  // The children of an entity are indexed in the order of their IDs, which is
+  // the order of childIdToParentId. One pass finds the models of the world in
+  // index order, and a second one sorts the links by the index of their model.
+  std::unordered_map<std::size_t, std::size_t> modelIndices;
+  for (const auto &[child, parent] : this->childIdToParentId)
+  {
+    if (parent == _worldID.id && this->models.count(child))
+      modelIndices.emplace(child, modelIndices.size());
+  }
+
+  std::vector<std::vector<const tpelib::Link *>> modelLinks(
+    modelIndices.size());
+  std::size_t linkCount = 0;
+  for (const auto &[child, parent] : this->childIdToParentId)
+  {
+    const auto modelIt = modelIndices.find(parent);
+    if (modelIt == modelIndices.end())
+      continue;
+
+    const auto linkIt = this->links.find(child);
+    if (linkIt != this->links.end())
+    {
+      modelLinks[modelIt->second].push_back(linkIt->second->link);
+      ++linkCount;
+    }
+  }
+
+  _data.clear();
+  _data.reserve(linkCount);
+  for (const auto &links : modelLinks)
+  {
+    for (const tpelib::Link *link : links)
+    {
+      _data.emplace_back();
+      if (_fields & FRAME_DATA_POSE)
+        _data.back().pose = math::eigen3::convert(link->GetWorldPose());
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+void KinematicsFeatures::GetModelLinkFrameData(
+  const Identity &_modelID,
+  std::vector<FrameData3d> &_data,
+  const unsigned int _fields) const
+{
+  _data.clear();
+  for (const auto &[child, parent] : this->childIdToParentId)
+  {
+    if (parent != _modelID.id)
+      continue;
+
+    const auto linkIt = this->links.find(child);
+    if (linkIt == this->links.end())
+      continue;
+
+    _data.emplace_back();
+    if (_fields & FRAME_DATA_POSE)
+    {
+      _data.back().pose =
+        math::eigen3::convert(linkIt->second->link->GetWorldPose());
+    }
+  }
+}
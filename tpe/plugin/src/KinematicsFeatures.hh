@@ -18,7 +18,10 @@
 #ifndef IGNITION_PHYSICS_TPE_PLUGIN_SRC_KINEMATICSFEATURES_HH_
 #define IGNITION_PHYSICS_TPE_PLUGIN_SRC_KINEMATICSFEATURES_HH_
 
+#include <vector>
+
 #include <ignition/physics/FrameSemantics.hh>
+#include <ignition/physics/LinkFrameData.hh>
 
 #include "Base.hh"
 
@@ -27,7 +30,8 @@ namespace physics {
 namespace tpeplugin {
 
 struct KinematicsFeatureList : FeatureList<
-  LinkFrameSemantics
+  LinkFrameSemantics,
+  GetLinkFrameDataFeature
 > { };
 
 class KinematicsFeatures :
@@ -36,6 +40,17 @@ class KinematicsFeatures :
 {
   public: FrameData3d FrameDataRelativeToWorld(
     const FrameID &_id) const override;
+
+  // TPE links only have a pose, so the other fields are always zero
+  public: void GetWorldLinkFrameData(
+    const Identity &_worldID,
+    std::vector<FrameData3d> &_data,
+    unsigned int _fields) const override;
+
+  public: void GetModelLinkFrameData(
+    const Identity &_modelID,
+    std::vector<FrameData3d> &_data,
+    unsigned int _fields) const override;
 };
 
 }
@@ -34,7 +34,7 @@ Identity ShapeFeatures::CastToBoxShape(const Identity &_shapeID) const
   {
     auto *shape = it->second->collision->GetShape();
     if (shape != nullptr && dynamic_cast<tpelib::BoxShape*>(shape))
-      return this->GenerateIdentity(_shapeID, it->second);
+      return this->GenerateIdentity(_shapeID, *it->second->slot);
   }
   return this->GenerateInvalidId();
 }
@@ -90,7 +90,7 @@ Identity ShapeFeatures::CastToCylinderShape(const Identity &_shapeID) const
   {
     auto *shape = it->second->collision->GetShape();
     if (shape != nullptr && dynamic_cast<tpelib::CylinderShape*>(shape))
-      return this->GenerateIdentity(_shapeID, it->second);
+      return this->GenerateIdentity(_shapeID, *it->second->slot);
   }
   return this->GenerateInvalidId();
 }
@@ -168,7 +168,7 @@ Identity ShapeFeatures::CastToSphereShape(
   {
     auto *shape = it->second->collision->GetShape();
     if (shape != nullptr && dynamic_cast<tpelib::SphereShape*>(shape))
-      return this->GenerateIdentity(_shapeID, it->second);
+      return this->GenerateIdentity(_shapeID, *it->second->slot);
   }
   return this->GenerateInvalidId();
 }
@@ -223,7 +223,7 @@ Identity ShapeFeatures::CastToMeshShape(
   {
     auto *shape = it->second->collision->GetShape();
     if (shape != nullptr && dynamic_cast<tpelib::MeshShape*>(shape))
-      return this->GenerateIdentity(_shapeID, it->second);
+      return this->GenerateIdentity(_shapeID, *it->second->slot);
   }
   return this->GenerateInvalidId();
 }
@@ -15,6 +15,8 @@
  *
 */
 
+#include <cmath>
+
 #include "SimulationFeatures.hh"
 
 #include <ignition/common/Console.hh>
@@ -29,7 +31,7 @@ using namespace tpeplugin;
 
 void SimulationFeatures::WorldForwardStep(
   const Identity &_worldID,
-  ForwardStep::Output & /*_h*/,
+  ForwardStep::Output &_h,
   ForwardStep::State & /*_x*/,
   const ForwardStep::Input & _u)
 {
@@ -57,7 +59,126 @@ void SimulationFeatures::WorldForwardStep(
         << std::endl;
     }
   }
+  // TPE is purely kinematic and has no joints, so the force and command
+  // inputs do not apply to it
   world->Step();
+
+  auto trackerIt = this->worldPoseTrackers.find(_worldID);
+  if (trackerIt != this->worldPoseTrackers.end())
+    this->UpdatePoseChanges(_worldID, trackerIt->second);
+
+  this->WriteStepOutput(_worldID, *world, _h);
+}
+
+void SimulationFeatures::WriteStepOutput(
+  const std::size_t _worldID,
+  const tpelib::World &_world,
+  ForwardStep::Output &_h) const
+{
+  IGN_PROFILE("SimulationFeatures::WriteStepOutput");
+  WorldPoses &poses = _h.Get<WorldPoses>();
+  poses.entries.clear();
+  for (const auto &link : this->links)
+  {
+    if (link.second->worldId == _worldID)
+      poses.entries.push_back({link.second->link->GetWorldPose(), link.first});
+  }
+
+  if (auto *positions = _h.Query<JointPositions>())
+  {
+    positions->dofs.clear();
+    positions->positions.clear();
+  }
+
+  if (auto *contacts = _h.Query<Contacts>())
+  {
+    // Share the contacts of GetContactsFromLastStep. TPE does not compute
+    // the force, normal or depth of a contact, so they are left at zero.
+    contacts->entries.clear();
+    for (const auto &c : _world.GetContacts())
+    {
+      contacts->entries.push_back(
+          {this->GetModelCollision(c.entity1).GetId(),
+           this->GetModelCollision(c.entity2).GetId(),
+           c.point, math::Vector3d::Zero, math::Vector3d::Zero, 0.0});
+    }
+  }
+}
+
+WorldPoseChanges SimulationFeatures::GetChangedWorldPoses(
+  const Identity &_worldID)
+{
+  auto trackerIt = this->worldPoseTrackers.find(_worldID);
+  if (trackerIt == this->worldPoseTrackers.end())
+  {
+    // Start tracking this world. Nothing has been reported yet, so every
+    // entity counts as changed.
+    trackerIt = this->worldPoseTrackers.emplace(
+      _worldID, WorldPoseTracker()).first;
+    this->UpdatePoseChanges(_worldID, trackerIt->second);
+  }
+
+  return trackerIt->second.changes;
+}
+
+void SimulationFeatures::SetPoseChangeTolerance(
+  const Identity &_worldID, const double _linear, const double _angular)
+{
+  WorldPoseTracker &tracker = this->worldPoseTrackers[_worldID];
+  tracker.linearTolerance = _linear;
+  tracker.angularTolerance = _angular;
+}
+
+void SimulationFeatures::UpdatePoseChanges(
+  const std::size_t _worldID, WorldPoseTracker &_tracker)
+{
+  IGN_PROFILE("SimulationFeatures::UpdatePoseChanges");
+  _tracker.changes.links.clear();
+  _tracker.changes.models.clear();
+
+  // Record a pose if it is new or moved beyond the tolerance
+  const auto track = [&_tracker](
+    const std::size_t _id, const math::Pose3d &_pose,
+    std::vector<WorldPose> &_changes)
+  {
+    auto reportedIt = _tracker.reported.find(_id);
+    if (reportedIt == _tracker.reported.end())
+    {
+      _tracker.reported.emplace(_id, _pose);
+    }
+    else if (
+      (_pose.Pos() - reportedIt->second.Pos()).Length() >
+        _tracker.linearTolerance ||
+      std::fabs((reportedIt->second.Rot().Inverse() * _pose.Rot()).W()) <
+        std::cos(0.5 * _tracker.angularTolerance))
+    {
+      reportedIt->second = _pose;
+    }
+    else
+    {
+      return;
+    }
+
+    _changes.push_back({_pose, _id});
+  };
+
+  for (const auto &model : this->models)
+  {
+    if (model.second->worldId == _worldID)
+    {
+      track(model.first, model.second->model->GetWorldPose(),
+        _tracker.changes.models);
+    }
+  }
+
+  for (const auto &link : this->links)
+  {
+    if (link.second->worldId == _worldID)
+    {
+      track(link.first, link.second->link->GetWorldPose(),
+        _tracker.changes.links);
+    }
+  }
 }
 
 std::vector<SimulationFeatures::ContactInternal>
@@ -79,8 +200,10 @@ SimulationFeatures::GetContactsFromLastStep(const Identity &_worldID) const
     auto s2 = this->GetModelCollision(c.entity2);
 
     outContacts.push_back(
-        {this->GenerateIdentity(s1.GetId(), this->collisions.at(s1.GetId())),
-         this->GenerateIdentity(s2.GetId(), this->collisions.at(s2.GetId())),
+        {this->GenerateIdentity(
+           s1.GetId(), *this->collisions.at(s1.GetId())->slot),
+         this->GenerateIdentity(
+           s2.GetId(), *this->collisions.at(s2.GetId())->slot),
          math::eigen3::convert(c.point), extraData});
   }
 
@@ -19,6 +19,7 @@
 #define IGNITION_PHYSICS_TPE_PLUGIN_SRC_SIMULATIONFEATURES_HH_
 
 #include <vector>
+#include <ignition/physics/ChangedWorldPoses.hh>
 #include <ignition/physics/ForwardStep.hh>
 #include <ignition/physics/GetContacts.hh>
 
@@ -30,6 +31,7 @@ namespace tpeplugin {
 
 struct SimulationFeatureList : FeatureList<
   ForwardStep,
+  GetChangedWorldPosesFeature,
   GetContactsFromLastStepFeature
 > { };
 
@@ -46,10 +48,33 @@ class SimulationFeatures :
   public: std::vector<ContactInternal> GetContactsFromLastStep(
     const Identity &_worldID) const override;
 
+  public: WorldPoseChanges GetChangedWorldPoses(
+    const Identity &_worldID) override;
+
+  public: void SetPoseChangeTolerance(
+    const Identity &_worldID, double _linear, double _angular) override;
+
+  /// \brief Find the links and models of a world whose pose moved beyond
+  /// the tolerance since it was last reported, and record their new poses
+  /// \param[in] _worldID ID of the world
+  /// \param[in] _tracker Poses last reported for the world
+  private: void UpdatePoseChanges(
+    std::size_t _worldID, WorldPoseTracker &_tracker);
+
   /// \brief Get a collision from the canonical link of a model
   /// \param[in] _id Model ID
   /// \return Collision entity
   private: tpelib::Entity &GetModelCollision(std::size_t _id) const;
+
+  /// \brief Fill in the Output of a ForwardStep after a world has been
+  /// stepped
+  /// \param[in] _worldID ID of the world that was stepped
+  /// \param[in] _world The world that was stepped
+  /// \param[out] _h The Output to fill in
+  private: void WriteStepOutput(
+    std::size_t _worldID,
+    const tpelib::World &_world,
+    ForwardStep::Output &_h) const;
 };
 
 }
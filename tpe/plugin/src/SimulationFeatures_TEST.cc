@@ -27,6 +27,7 @@
 #include <ignition/physics/FindFeatures.hh>
 #include <ignition/physics/GetBoundingBox.hh>
 #include <ignition/physics/FrameSemantics.hh>
+#include <ignition/physics/LinkFrameData.hh>
 #include <ignition/physics/RequestEngine.hh>
 #include <ignition/physics/sdf/ConstructWorld.hh>
 
@@ -48,6 +49,7 @@ struct TestFeatureList : ignition::physics::FeatureList<
   ignition::physics::tpeplugin::FreeGroupFeatureList,
   ignition::physics::GetContactsFromLastStepFeature,
   ignition::physics::LinkFrameSemantics,
+  ignition::physics::GetLinkFrameDataFeature,
   ignition::physics::GetModelBoundingBox,
   ignition::physics::sdf::ConstructSdfWorld
 > { };
@@ -409,6 +411,158 @@ TEST_P(SimulationFeatures_TEST, RetrieveContacts)
   }
 }
 
+TEST_P(SimulationFeatures_TEST, StepOutput)
+{
+  const std::string library = GetParam();
+  if (library.empty())
+    return;
+
+  auto worlds = LoadWorlds(library, TEST_WORLD_DIR "/shapes.world");
+
+  for (const auto &world : worlds)
+  {
+    ignition::physics::ForwardStep::Input input;
+    ignition::physics::ForwardStep::State state;
+    ignition::physics::ForwardStep::Output output;
+
+    // Contacts are only reported when they are requested
+    world->Step(output, state, input);
+    EXPECT_FALSE(output.Has<ignition::physics::Contacts>());
+
+    output.Get<ignition::physics::Contacts>();
+    world->Step(output, state, input);
+
+    // Every link of the world has an up-to-date pose
+    const auto &poses = output.Get<ignition::physics::WorldPoses>();
+    std::size_t linkCount = 0;
+    for (std::size_t i = 0; i < world->GetModelCount(); ++i)
+    {
+      auto model = world->GetModel(i);
+      for (std::size_t j = 0; j < model->GetLinkCount(); ++j)
+      {
+        auto link = model->GetLink(j);
+        ++linkCount;
+
+        bool found = false;
+        for (const auto &entry : poses.entries)
+        {
+          if (entry.body != link->EntityID())
+            continue;
+
+          found = true;
+          EXPECT_EQ(ignition::math::eigen3::convert(
+              link->FrameDataRelativeToWorld().pose), entry.pose);
+        }
+        EXPECT_TRUE(found) << link->GetName();
+      }
+    }
+    EXPECT_EQ(linkCount, poses.entries.size());
+
+    // The large box in the middle is touching the sphere and the cylinder.
+    // Stepping again overwrites the previous contacts.
+    world->Step(output, state, input);
+    const auto &contacts = output.Get<ignition::physics::Contacts>();
+    const auto lastStepContacts = world->GetContactsFromLastStep();
+    ASSERT_EQ(2u, contacts.entries.size());
+    ASSERT_EQ(lastStepContacts.size(), contacts.entries.size());
+    for (std::size_t i = 0; i < contacts.entries.size(); ++i)
+    {
+      const auto &contactPoint = lastStepContacts[i].Get<::ContactPoint>();
+      EXPECT_EQ(contactPoint.collision1->EntityID(),
+                contacts.entries[i].collision1);
+      EXPECT_EQ(contactPoint.collision2->EntityID(),
+                contacts.entries[i].collision2);
+      EXPECT_EQ(ignition::math::eigen3::convert(contactPoint.point),
+                contacts.entries[i].point);
+    }
+  }
+}
+
+TEST_P(SimulationFeatures_TEST, ChangedWorldPoses)
+{
+  const std::string library = GetParam();
+  if (library.empty())
+    return;
+
+  auto worlds = LoadWorlds(library, TEST_WORLD_DIR "/shapes.world");
+
+  for (const auto &world : worlds)
+  {
+    // The first request reports every entity
+    auto changes = world->GetChangedWorldPoses();
+    EXPECT_EQ(world->GetModelCount(), changes.models.size());
+    EXPECT_FALSE(changes.links.empty());
+
+    // Nothing moves on its own
+    StepWorld(world, 1);
+    changes = world->GetChangedWorldPoses();
+    EXPECT_TRUE(changes.models.empty());
+    EXPECT_TRUE(changes.links.empty());
+
+    // Only the sphere is reported after it is moved
+    auto sphere = world->GetModel("sphere");
+    sphere->FindFreeGroup()->SetWorldPose(ignition::math::eigen3::convert(
+        ignition::math::Pose3d(0, 100, 0.5, 0, 0, 0)));
+    StepWorld(world, 1);
+    changes = world->GetChangedWorldPoses();
+    ASSERT_EQ(1u, changes.models.size());
+    EXPECT_EQ(sphere->EntityID(), changes.models[0].body);
+    EXPECT_EQ(ignition::math::Pose3d(0, 100, 0.5, 0, 0, 0),
+              changes.models[0].pose);
+    ASSERT_EQ(1u, changes.links.size());
+    EXPECT_EQ(sphere->GetLink(0)->EntityID(), changes.links[0].body);
+  }
+}
+
+TEST_P(SimulationFeatures_TEST, LinkFrameData)
+{
+  const std::string library = GetParam();
+  if (library.empty())
+    return;
+
+  auto worlds = LoadWorlds(library, TEST_WORLD_DIR "/shapes.world");
+
+  for (const auto &world : worlds)
+  {
+    auto sphere = world->GetModel("sphere");
+    sphere->FindFreeGroup()->SetWorldPose(ignition::math::eigen3::convert(
+        ignition::math::Pose3d(0, 100, 0.5, 0, 0, 0)));
+
+    // The links of the world are ordered by model, then by link
+    std::vector<ignition::physics::FrameData3d> data;
+    world->GetLinkFrameData(data);
+
+    std::size_t entry = 0;
+    for (std::size_t i = 0; i < world->GetModelCount(); ++i)
+    {
+      auto model = world->GetModel(i);
+
+      std::vector<ignition::physics::FrameData3d> modelData;
+      model->GetLinkFrameData(modelData);
+      ASSERT_EQ(model->GetLinkCount(), modelData.size());
+
+      for (std::size_t j = 0; j < model->GetLinkCount(); ++j, ++entry)
+      {
+        const auto expected = model->GetLink(j)->FrameDataRelativeToWorld();
+        ASSERT_LT(entry, data.size());
+        EXPECT_TRUE(ignition::physics::test::Equal(
+            expected, data[entry], 1e-12));
+        EXPECT_TRUE(ignition::physics::test::Equal(
+            expected, modelData[j], 1e-12));
+      }
+    }
+    EXPECT_EQ(entry, data.size());
+
+    // Fields that are not requested are left at zero
+    world->GetLinkFrameData(data, ignition::physics::FRAME_DATA_VELOCITIES);
+    for (const auto &frameData : data)
+    {
+      EXPECT_TRUE(ignition::physics::test::Equal(
+          ignition::physics::FrameData3d(), frameData, 1e-12));
+    }
+  }
+}
+
 INSTANTIATE_TEST_CASE_P(PhysicsPlugins, SimulationFeatures_TEST,
   ::testing::ValuesIn(ignition::physics::test::g_PhysicsPluginLibraries),); // NOLINT
 